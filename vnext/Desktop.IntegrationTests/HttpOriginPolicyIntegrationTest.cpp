@@ -9,7 +9,9 @@
 #include <Test/HttpServer.h>
 
 // Standard Library
+#include <atomic>
 #include <future>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -821,6 +823,132 @@ TEST_CLASS(HttpOriginPolicyIntegrationTest)
 
     TestOriginPolicy(serverArgs, clientArgs, s_shouldFail);
   }// RequestWithProxyAuthorizationHeaderFails
+
+  // Sends one request per Content-Type value through one resource and returns the number of OPTIONS requests the server got.
+  // Collects one error message per request; successful requests get an empty message.
+  size_t SendRequestsAndCountPreflights(ServerParams& serverArgs, const std::vector<string>& contentTypes, std::vector<string>& errorMessages)
+  {
+    std::atomic<size_t> preflightCount{0};
+    auto server = make_shared<HttpServer>(serverArgs.Port);
+    server->Callbacks().OnOptions = [&serverArgs, &preflightCount](const DynamicRequest& request) -> ResponseWrapper
+    {
+      ++preflightCount;
+      // Don't use move constructor in case of multiple requests
+      return { serverArgs.Preflight };
+    };
+    server->Callbacks().OnPatch = [&serverArgs](const DynamicRequest& request) -> ResponseWrapper
+    {
+      return { serverArgs.Response };
+    };
+    server->Start();
+
+    auto resource = IHttpResource::Make();
+    for (size_t i = 0; i < contentTypes.size(); ++i)
+    {
+      ClientParams clientArgs(http::verb::patch, { {"Content-Type", contentTypes[i]}, {"ArbitraryHeader", "AnyValue"} });
+      resource->SetOnResponse([&clientArgs](int64_t, IHttpResource::Response&& res)
+      {
+        clientArgs.Response = std::move(res);
+      });
+      resource->SetOnData([&clientArgs](int64_t, string&& content)
+      {
+        clientArgs.ResponseContent = std::move(content);
+        clientArgs.ContentPromise.set_value();
+      });
+      resource->SetOnError([&clientArgs](int64_t, string&& message, bool)
+      {
+        clientArgs.ErrorMessage = std::move(message);
+        clientArgs.ContentPromise.set_value();
+      });
+
+      resource->SendRequest(
+        string{http::to_string(clientArgs.Method).data()},
+        string{serverArgs.Url},
+        static_cast<int64_t>(i),    /*requestId*/
+        std::move(clientArgs.RequestHeaders),
+        dynamic::object("string", ""),  /*data*/
+        "text",
+        false,                      /*useIncrementalUpdates*/
+        0,                          /*timeout*/
+        false,                      /*withCredentials*/
+        [](int64_t) {}              /*reactCallback*/
+      );
+
+      clientArgs.ContentPromise.get_future().wait();
+
+      if (clientArgs.ErrorMessage.empty())
+        Assert::AreEqual({"RESPONSE_CONTENT"}, clientArgs.ResponseContent);
+      errorMessages.emplace_back(std::move(clientArgs.ErrorMessage));
+    }
+
+    server->Stop();
+
+    return preflightCount;
+  }
+
+  // Sends requestCount identical requests that are all expected to succeed.
+  size_t SendRequestsAndCountPreflights(ServerParams& serverArgs, size_t requestCount)
+  {
+    std::vector<string> errorMessages;
+    auto preflightCount = SendRequestsAndCountPreflights(serverArgs, std::vector<string>(requestCount, "text/plain"), errorMessages);
+    for (const auto& message : errorMessages)
+      Assert::AreEqual({}, message);
+
+    return preflightCount;
+  }
+
+  TEST_METHOD(FullCorsPreflightIsCachedForMaxAge)
+  {
+    ServerParams serverArgs(s_port);
+    serverArgs.Preflight.set(http::field::access_control_allow_headers,   "ArbitraryHeader");
+    serverArgs.Preflight.set(http::field::access_control_allow_origin,    s_crossOriginUrl);
+    serverArgs.Preflight.set(http::field::access_control_max_age,         "60");
+    serverArgs.Response.result(http::status::ok);
+    serverArgs.Response.set(http::field::access_control_allow_origin,     s_crossOriginUrl);
+
+    SetRuntimeOptionString("Http.GlobalOrigin", s_crossOriginUrl);
+    SetRuntimeOptionInt("Http.OriginPolicy", static_cast<int32_t>(OriginPolicy::CrossOriginResourceSharing));
+
+    Assert::AreEqual(size_t{1}, SendRequestsAndCountPreflights(serverArgs, 3));
+  }// FullCorsPreflightIsCachedForMaxAge
+
+  TEST_METHOD(FullCorsPreflightWithZeroMaxAgeIsNotCached)
+  {
+    ServerParams serverArgs(s_port);
+    serverArgs.Preflight.set(http::field::access_control_allow_headers,   "ArbitraryHeader");
+    serverArgs.Preflight.set(http::field::access_control_allow_origin,    s_crossOriginUrl);
+    serverArgs.Preflight.set(http::field::access_control_max_age,         "0");
+    serverArgs.Response.result(http::status::ok);
+    serverArgs.Response.set(http::field::access_control_allow_origin,     s_crossOriginUrl);
+
+    SetRuntimeOptionString("Http.GlobalOrigin", s_crossOriginUrl);
+    SetRuntimeOptionInt("Http.OriginPolicy", static_cast<int32_t>(OriginPolicy::CrossOriginResourceSharing));
+
+    Assert::AreEqual(size_t{3}, SendRequestsAndCountPreflights(serverArgs, 3));
+  }// FullCorsPreflightWithZeroMaxAgeIsNotCached
+
+  // A cached preflight must not allow a header whose new value makes it CORS-unsafe.
+  TEST_METHOD(FullCorsCachedPreflightRechecksHeaderValues)
+  {
+    ServerParams serverArgs(s_port);
+    serverArgs.Preflight.set(http::field::access_control_allow_headers,   "ArbitraryHeader");
+    serverArgs.Preflight.set(http::field::access_control_allow_origin,    s_crossOriginUrl);
+    serverArgs.Preflight.set(http::field::access_control_max_age,         "60");
+    serverArgs.Response.result(http::status::ok);
+    serverArgs.Response.set(http::field::access_control_allow_origin,     s_crossOriginUrl);
+
+    SetRuntimeOptionString("Http.GlobalOrigin", s_crossOriginUrl);
+    SetRuntimeOptionInt("Http.OriginPolicy", static_cast<int32_t>(OriginPolicy::CrossOriginResourceSharing));
+
+    // text/plain is safelisted, application/json is not and Content-Type is not in Access-Control-Allow-Headers.
+    std::vector<string> errorMessages;
+    auto preflightCount = SendRequestsAndCountPreflights(serverArgs, { "text/plain", "application/json" }, errorMessages);
+
+    Assert::AreEqual(size_t{2}, preflightCount);
+    Assert::AreEqual(size_t{2}, errorMessages.size());
+    Assert::AreEqual({}, errorMessages[0]);
+    Assert::IsFalse(errorMessages[1].empty());
+  }// FullCorsCachedPreflightRechecksHeaderValues
 };
 
 uint16_t HttpOriginPolicyIntegrationTest::s_port = 7777;
@@ -15,6 +15,9 @@
 // Boost Library
 #include <boost/beast/http.hpp>
 
+// Windows API
+#include <winrt/Windows.Security.Cryptography.h>
+
 // Standard Library
 #include <future>
 
@@ -654,6 +657,131 @@ TEST_CLASS (HttpResourceIntegrationTest) {
     Assert::AreEqual({"[0x800705b4] This operation returned because the timeout period expired."}, error);
     Assert::AreEqual(0, statusCode);
   }
+
+  TEST_METHOD(IncrementalTextSucceeds) {
+    string url = "http://localhost:" + std::to_string(s_port);
+
+    // Multi-byte characters, so that some of them are split between the response segments.
+    string expected;
+    while (expected.size() < 3 * 1024 * 1024) {
+      expected += "incremental \xE2\x82\xAC \xF0\x9F\x98\x80 ";
+    }
+
+    promise<void> donePromise;
+    string error;
+    string content;
+    size_t segmentCount = 0;
+    int64_t lastProgress = 0;
+    int64_t lastTotal = 0;
+
+    auto server = make_shared<HttpServer>(s_port);
+    server->Callbacks().OnGet = [&expected](const DynamicRequest &) -> ResponseWrapper {
+      DynamicResponse response;
+      response.result(http::status::ok);
+      response.body() = Test::CreateStringResponseBody(string{expected});
+
+      return {std::move(response)};
+    };
+    server->Start();
+
+    auto resource = IHttpResource::Make();
+    resource->SetOnData([&donePromise, &error](int64_t, string &&) {
+      error = "Incremental text must not be passed to the data handler";
+      donePromise.set_value();
+    });
+    resource->SetOnIncrementalData(
+        [&content, &segmentCount, &lastProgress, &lastTotal](
+            int64_t, string &&responseData, int64_t progress, int64_t total) {
+          content += responseData;
+          ++segmentCount;
+          lastProgress = progress;
+          lastTotal = total;
+        });
+    resource->SetOnRequestSuccess([&donePromise](int64_t) { donePromise.set_value(); });
+    resource->SetOnError([&donePromise, &error](int64_t, string &&message, bool) {
+      error = std::move(message);
+      donePromise.set_value();
+    });
+    resource->SendRequest(
+        "GET",
+        std::move(url),
+        0, /*requestId*/
+        {}, /*headers*/
+        {}, /*data*/
+        "text", /*responseType*/
+        true, /*useIncrementalUpdates*/
+        0, /*timeout*/
+        false, /*withCredentials*/
+        [](int64_t) {} /*callback*/);
+
+    donePromise.get_future().wait();
+    server->Stop();
+
+    Assert::AreEqual({}, error);
+    Assert::IsTrue(segmentCount > 1);
+    Assert::IsTrue(expected == content);
+    Assert::AreEqual(static_cast<int64_t>(expected.size()), lastProgress);
+    Assert::AreEqual(static_cast<int64_t>(expected.size()), lastTotal);
+  }
+
+  TEST_METHOD(IncrementalBase64Succeeds) {
+    string url = "http://localhost:" + std::to_string(s_port);
+
+    // The length is not a multiple of 3, so the segments cannot be encoded separately.
+    string body(3 * 1024 * 1024 + 1, '\0');
+    for (size_t i = 0; i < body.size(); ++i) {
+      body[i] = static_cast<char>(i % 251);
+    }
+
+    promise<void> donePromise;
+    string error;
+    string content;
+    size_t progressCount = 0;
+
+    auto server = make_shared<HttpServer>(s_port);
+    server->Callbacks().OnGet = [&body](const DynamicRequest &) -> ResponseWrapper {
+      DynamicResponse response;
+      response.result(http::status::ok);
+      response.body() = Test::CreateStringResponseBody(string{body});
+
+      return {std::move(response)};
+    };
+    server->Start();
+
+    auto resource = IHttpResource::Make();
+    resource->SetOnDataProgress([&progressCount](int64_t, int64_t, int64_t) { ++progressCount; });
+    resource->SetOnData([&donePromise, &content](int64_t, string &&responseData) {
+      content = std::move(responseData);
+      donePromise.set_value();
+    });
+    resource->SetOnError([&donePromise, &error](int64_t, string &&message, bool) {
+      error = std::move(message);
+      donePromise.set_value();
+    });
+    resource->SendRequest(
+        "GET",
+        std::move(url),
+        0, /*requestId*/
+        {}, /*headers*/
+        {}, /*data*/
+        "base64", /*responseType*/
+        true, /*useIncrementalUpdates*/
+        0, /*timeout*/
+        false, /*withCredentials*/
+        [](int64_t) {} /*callback*/);
+
+    donePromise.get_future().wait();
+    server->Stop();
+
+    using winrt::Windows::Security::Cryptography::CryptographicBuffer;
+    auto bodyBytes = reinterpret_cast<const uint8_t *>(body.data());
+    auto expected = CryptographicBuffer::EncodeToBase64String(
+        CryptographicBuffer::CreateFromByteArray({bodyBytes, bodyBytes + body.size()}));
+
+    Assert::AreEqual({}, error);
+    Assert::IsTrue(progressCount > 0);
+    Assert::AreEqual(winrt::to_string(expected), content);
+  }
 };
 
 /*static*/ uint16_t HttpResourceIntegrationTest::s_port = 4444;
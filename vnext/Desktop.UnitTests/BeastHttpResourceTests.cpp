@@ -0,0 +1,282 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <BeastHttpResource.h>
+#include <CppRuntimeOptions.h>
+#include <CppUnitTest.h>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace boost::beast;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using boost::asio::ip::tcp;
+using std::promise;
+using std::string;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+// Keep-alive HTTP server that counts the connections and requests it accepts.
+// Responds with the request target after waiting for the time given in the "Delay" request header.
+// Closes the connection without a response if the request has a "Drop" header.
+class TestHttpServer {
+  boost::asio::io_context m_context;
+  tcp::acceptor m_acceptor;
+  std::thread m_acceptThread;
+  std::atomic<size_t> m_connectionCount{0};
+  std::atomic<size_t> m_requestCount{0};
+
+  // The sockets belong to m_context, so the threads serving them are joined before it is destroyed.
+  std::mutex m_serveMutex;
+  std::vector<std::shared_ptr<tcp::socket>> m_sockets;
+  std::vector<std::thread> m_serveThreads;
+
+  void Serve(std::shared_ptr<tcp::socket> socket) {
+    boost::system::error_code ec;
+    flat_buffer buffer;
+    while (true) {
+      http::request<http::string_body> request;
+      http::read(*socket, buffer, request, ec);
+      if (ec)
+        break;
+
+      ++m_requestCount;
+      if (request.find("Drop") != request.end())
+        break;
+
+      if (auto it = request.find("Delay"); it != request.end())
+        std::this_thread::sleep_for(std::chrono::milliseconds{std::stoi(string{it->value()})});
+
+      http::response<http::string_body> response{http::status::ok, request.version()};
+      response.set(http::field::content_type, "text/plain");
+      response.keep_alive(request.keep_alive());
+      response.body() = string{request.target()};
+      response.prepare_payload();
+      http::write(*socket, response, ec);
+      if (ec || !response.keep_alive())
+        break;
+    }
+
+    socket->shutdown(tcp::socket::shutdown_both, ec);
+  }
+
+ public:
+  TestHttpServer() : m_acceptor{m_context, {boost::asio::ip::make_address("127.0.0.1"), 0}} {
+    m_acceptThread = std::thread([this]() {
+      while (true) {
+        boost::system::error_code ec;
+        auto socket = std::make_shared<tcp::socket>(m_context);
+        m_acceptor.accept(*socket, ec);
+        if (ec)
+          break;
+
+        ++m_connectionCount;
+        std::scoped_lock lock{m_serveMutex};
+        m_sockets.push_back(socket);
+        m_serveThreads.emplace_back(&TestHttpServer::Serve, this, std::move(socket));
+      }
+    });
+  }
+
+  ~TestHttpServer() {
+    boost::system::error_code ec;
+    m_acceptor.close(ec);
+    m_acceptThread.join();
+
+    // Unblock the pending reads, then wait for the connections to finish.
+    for (auto &socket : m_sockets) {
+      socket->shutdown(tcp::socket::shutdown_both, ec);
+    }
+    for (auto &thread : m_serveThreads) {
+      thread.join();
+    }
+  }
+
+  string Url(const string &path) const {
+    return "http://127.0.0.1:" + std::to_string(m_acceptor.local_endpoint().port()) + path;
+  }
+
+  size_t ConnectionCount() const noexcept {
+    return m_connectionCount;
+  }
+
+  size_t RequestCount() const noexcept {
+    return m_requestCount;
+  }
+};
+
+struct TestResult {
+  string Data;
+  string Error;
+  bool IsTimeout{false};
+};
+
+// Sends the requests at the same time and waits for all of them to complete.
+std::vector<TestResult> SendRequests(
+    BeastHttpResource &resource,
+    const std::vector<string> &urls,
+    Networking::IHttpResource::Headers headers = {},
+    int64_t timeout = 0,
+    const string &method = "GET") {
+  std::mutex mutex;
+  std::vector<TestResult> results(urls.size());
+  std::vector<promise<void>> completed(urls.size());
+
+  resource.SetOnData([&](int64_t requestId, string &&responseData) {
+    std::scoped_lock lock{mutex};
+    results[static_cast<size_t>(requestId)].Data = std::move(responseData);
+    completed[static_cast<size_t>(requestId)].set_value();
+  });
+  resource.SetOnError([&](int64_t requestId, string &&errorMessage, bool isTimeout) {
+    std::scoped_lock lock{mutex};
+    results[static_cast<size_t>(requestId)].Error = std::move(errorMessage);
+    results[static_cast<size_t>(requestId)].IsTimeout = isTimeout;
+    completed[static_cast<size_t>(requestId)].set_value();
+  });
+
+  for (size_t i = 0; i < urls.size(); ++i) {
+    resource.SendRequest(
+        string{method},
+        string{urls[i]},
+        static_cast<int64_t>(i),
+        Networking::IHttpResource::Headers{headers},
+        {} /*data*/,
+        "text",
+        false /*useIncrementalUpdates*/,
+        timeout,
+        false /*withCredentials*/,
+        [](int64_t) {});
+  }
+
+  for (auto &promise : completed) {
+    promise.get_future().wait();
+  }
+
+  return results;
+}
+
+} // namespace
+
+TEST_CLASS (BeastHttpResourceTests) {
+  TEST_METHOD(SequentialRequestsReuseConnection) {
+    TestHttpServer server;
+    auto resource = std::make_shared<BeastHttpResource>();
+
+    for (auto path : {"/a", "/b", "/c"}) {
+      auto results = SendRequests(*resource, {server.Url(path)});
+      Assert::AreEqual({}, results[0].Error);
+      Assert::AreEqual(string{path}, results[0].Data);
+    }
+
+    Assert::AreEqual(size_t{1}, server.ConnectionCount());
+  }
+
+  TEST_METHOD(ConcurrentRequestsRespectConnectionLimit) {
+    SetRuntimeOptionInt("Http.MaxConnectionsPerHost", 2);
+    TestHttpServer server;
+    auto resource = std::make_shared<BeastHttpResource>();
+    SetRuntimeOptionInt("Http.MaxConnectionsPerHost", 0);
+
+    std::vector<string> urls;
+    for (int i = 0; i < 6; ++i) {
+      urls.push_back(server.Url("/" + std::to_string(i)));
+    }
+
+    auto results = SendRequests(*resource, urls, {{"Delay", "50"}});
+    for (size_t i = 0; i < urls.size(); ++i) {
+      Assert::AreEqual({}, results[i].Error);
+      Assert::AreEqual("/" + std::to_string(i), results[i].Data);
+    }
+
+    Assert::AreEqual(size_t{2}, server.ConnectionCount());
+  }
+
+  TEST_METHOD(PipelinedRequestsShareConnection) {
+    SetRuntimeOptionInt("Http.MaxConnectionsPerHost", 1);
+    SetRuntimeOptionInt("Http.MaxPipelinedRequests", 4);
+    TestHttpServer server;
+    auto resource = std::make_shared<BeastHttpResource>();
+    SetRuntimeOptionInt("Http.MaxConnectionsPerHost", 0);
+    SetRuntimeOptionInt("Http.MaxPipelinedRequests", 0);
+
+    std::vector<string> urls;
+    for (int i = 0; i < 8; ++i) {
+      urls.push_back(server.Url("/" + std::to_string(i)));
+    }
+
+    // Responses must be matched to the requests in the order they were written.
+    auto results = SendRequests(*resource, urls);
+    for (size_t i = 0; i < urls.size(); ++i) {
+      Assert::AreEqual({}, results[i].Error);
+      Assert::AreEqual("/" + std::to_string(i), results[i].Data);
+    }
+
+    Assert::AreEqual(size_t{1}, server.ConnectionCount());
+  }
+
+  TEST_METHOD(TimeoutFailsRequest) {
+    TestHttpServer server;
+    auto resource = std::make_shared<BeastHttpResource>();
+
+    auto results = SendRequests(*resource, {server.Url("/slow")}, {{"Delay", "1000"}}, 100 /*timeout*/);
+    Assert::IsTrue(results[0].IsTimeout);
+    Assert::AreEqual({}, results[0].Data);
+  }
+
+  TEST_METHOD(IdempotentRequestIsResentOnce) {
+    TestHttpServer server;
+    auto resource = std::make_shared<BeastHttpResource>();
+
+    // A keep-alive connection that received a response may be closed by the server before the next response.
+    auto results = SendRequests(*resource, {server.Url("/a")});
+    Assert::AreEqual({}, results[0].Error);
+
+    results = SendRequests(*resource, {server.Url("/b")}, {{"Drop", "1"}}, 0, "PUT");
+    Assert::IsFalse(results[0].Error.empty());
+    Assert::AreEqual(size_t{3}, server.RequestCount());
+  }
+
+  TEST_METHOD(NonIdempotentRequestIsNotResent) {
+    TestHttpServer server;
+    auto resource = std::make_shared<BeastHttpResource>();
+
+    auto results = SendRequests(*resource, {server.Url("/a")});
+    Assert::AreEqual({}, results[0].Error);
+
+    // The server may have processed the request, so it fails with the connection error.
+    results = SendRequests(*resource, {server.Url("/b")}, {{"Drop", "1"}}, 0, "POST");
+    Assert::IsFalse(results[0].Error.empty());
+    Assert::AreEqual(size_t{2}, server.RequestCount());
+  }
+
+  TEST_METHOD(DestroyedResourceDoesNotStopSharedThread) {
+    TestHttpServer server;
+    auto resource = std::make_shared<BeastHttpResource>();
+    auto otherResource = std::make_shared<BeastHttpResource>();
+
+    auto results = SendRequests(*otherResource, {server.Url("/a")});
+    Assert::AreEqual({}, results[0].Error);
+    otherResource.reset();
+
+    // The resources run on the same context thread, which keeps running for the remaining resource.
+    results = SendRequests(*resource, {server.Url("/b")});
+    Assert::AreEqual({}, results[0].Error);
+    Assert::AreEqual(string{"/b"}, results[0].Data);
+  }
+
+  TEST_METHOD(UnsupportedSchemeFails) {
+    auto resource = std::make_shared<BeastHttpResource>();
+
+    auto results = SendRequests(*resource, {"https://localhost/"});
+    Assert::IsFalse(results[0].Error.empty());
+    Assert::IsFalse(results[0].IsTimeout);
+  }
+};
+
+} // namespace Microsoft::React::Test
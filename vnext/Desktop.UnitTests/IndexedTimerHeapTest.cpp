@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Utils/IndexedTimerHeap.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <windows.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+struct TestTimer {
+  int64_t Id;
+  int64_t DueTime;
+};
+
+using TestTimerHeap = IndexedTimerHeap<TestTimer, &TestTimer::Id, &TestTimer::DueTime>;
+
+} // namespace
+
+TEST_CLASS (IndexedTimerHeapTest) {
+  TEST_METHOD(IndexedTimerHeap_PopsInDueTimeOrder) {
+    TestTimerHeap timers;
+    timers.Push(TestTimer{1, 100});
+    timers.Push(TestTimer{2, 20});
+    timers.Push(TestTimer{3, 50});
+
+    Assert::AreEqual(size_t{3}, timers.Size());
+    Assert::AreEqual(int64_t{2}, timers.Pop().Id);
+    Assert::AreEqual(int64_t{3}, timers.Pop().Id);
+    Assert::AreEqual(int64_t{1}, timers.Pop().Id);
+    Assert::IsTrue(timers.IsEmpty());
+  }
+
+  TEST_METHOD(IndexedTimerHeap_EqualDueTimesKeepPushOrder) {
+    TestTimerHeap timers;
+    for (int64_t id = 0; id < 100; id++) {
+      timers.Push(TestTimer{id, 10});
+    }
+
+    for (int64_t id = 0; id < 100; id++) {
+      Assert::AreEqual(id, timers.Pop().Id);
+    }
+  }
+
+  TEST_METHOD(IndexedTimerHeap_RemoveAndFind) {
+    TestTimerHeap timers;
+    timers.Push(TestTimer{1, 100});
+    timers.Push(TestTimer{2, 20});
+
+    Assert::IsNotNull(timers.Find(1));
+    Assert::AreEqual(int64_t{100}, timers.Find(1)->DueTime);
+
+    Assert::IsTrue(timers.Remove(2));
+    Assert::IsFalse(timers.Remove(2));
+    Assert::IsNull(timers.Find(2));
+    Assert::AreEqual(int64_t{1}, timers.Front().Id);
+  }
+
+  TEST_METHOD(IndexedTimerHeap_PushReplacesSameId) {
+    TestTimerHeap timers;
+    timers.Push(TestTimer{1, 100});
+    timers.Push(TestTimer{2, 50});
+    timers.Push(TestTimer{1, 10});
+
+    Assert::AreEqual(size_t{2}, timers.Size());
+    Assert::AreEqual(int64_t{1}, timers.Front().Id);
+    Assert::AreEqual(int64_t{10}, timers.Front().DueTime);
+  }
+
+  TEST_METHOD(IndexedTimerHeap_MatchesOrderedMap) {
+    TestTimerHeap timers;
+    std::map<std::pair<int64_t, int64_t>, int64_t> expected; // (due time, push order) -> id
+    std::map<int64_t, std::pair<int64_t, int64_t>> expectedById;
+    std::mt19937 random{42};
+    int64_t pushOrder = 0;
+
+    for (int i = 0; i < 100000; i++) {
+      const int64_t id = random() % 500;
+      switch (random() % 4) {
+        case 0:
+        case 1: {
+          const int64_t dueTime = random() % 1000;
+          timers.Push(TestTimer{id, dueTime});
+          if (expectedById.count(id))
+            expected.erase(expectedById[id]);
+          expectedById[id] = {dueTime, pushOrder++};
+          expected[expectedById[id]] = id;
+          break;
+        }
+        case 2: {
+          const bool removed = timers.Remove(id);
+          Assert::AreEqual(expectedById.count(id) != 0, removed);
+          if (removed) {
+            expected.erase(expectedById[id]);
+            expectedById.erase(id);
+          }
+          break;
+        }
+        default:
+          if (!expected.empty()) {
+            const auto timer = timers.Pop();
+            Assert::AreEqual(expected.begin()->second, timer.Id);
+            expectedById.erase(timer.Id);
+            expected.erase(expected.begin());
+          }
+          break;
+      }
+
+      Assert::AreEqual(expected.size(), timers.Size());
+    }
+  }
+};
+
+#ifdef PERF_TESTS
+
+TEST_CLASS (IndexedTimerHeapPerfTests) {
+  // Debounce pattern: every iteration clears a random live timer and sets a
+  // new one, with a steady number of timers pending. Compared against the
+  // previous TimerQueue, which removed timers with a linear search followed by
+  // a full heap rebuild.
+  TEST_METHOD(IndexedTimerHeapPerf_SetAndClear) {
+    static const int iterations = 100000;
+
+    for (int liveTimers : {100, 1000, 10000}) {
+      std::mt19937 random{42};
+      TestTimerHeap timers;
+      for (int64_t id = 0; id < liveTimers; id++) {
+        timers.Push(TestTimer{id, static_cast<int64_t>(random() % 10000)});
+      }
+
+      LARGE_INTEGER a{0}, b{0};
+      QueryPerformanceCounter(&a);
+      for (int64_t i = 0; i < iterations; i++) {
+        const int64_t id = random() % liveTimers;
+        timers.Remove(id);
+        timers.Push(TestTimer{id, i + random() % 10000});
+      }
+      QueryPerformanceCounter(&b);
+      PrintResult("IndexedTimerHeap", liveTimers, iterations, b.QuadPart - a.QuadPart);
+
+      auto later = [](const TestTimer &left, const TestTimer &right) { return right.DueTime < left.DueTime; };
+      std::vector<TestTimer> heap;
+      for (int64_t id = 0; id < liveTimers; id++) {
+        heap.push_back(TestTimer{id, static_cast<int64_t>(random() % 10000)});
+      }
+      std::make_heap(heap.begin(), heap.end(), later);
+
+      QueryPerformanceCounter(&a);
+      for (int64_t i = 0; i < iterations; i++) {
+        const int64_t id = random() % liveTimers;
+        auto found = std::find_if(heap.begin(), heap.end(), [id](const TestTimer &timer) { return timer.Id == id; });
+        if (found != heap.end())
+          heap.erase(found);
+        std::make_heap(heap.begin(), heap.end(), later);
+
+        heap.push_back(TestTimer{id, i + random() % 10000});
+        std::push_heap(heap.begin(), heap.end(), later);
+      }
+      QueryPerformanceCounter(&b);
+      PrintResult("LinearRemove", liveTimers, iterations, b.QuadPart - a.QuadPart);
+    }
+  }
+
+  static void PrintResult(const char *name, int liveTimers, int iterations, LONGLONG accu) {
+    LARGE_INTEGER freq{0};
+    Assert::IsTrue(QueryPerformanceFrequency(&freq));
+    std::stringstream ss;
+
+    double time = static_cast<double>(accu) / freq.QuadPart;
+    ss << "IndexedTimerHeapPerf_SetAndClear: " << name << "; live=" << liveTimers << "; its=" << iterations
+       << "; tt=" << time << " s; tc=" << time / iterations * std::pow(10, 6) << " us";
+    Logger::WriteMessage(ss.str().c_str());
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <AsyncStorage/KeyValueTable.h>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using std::make_shared;
+using std::string;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (KeyValueTableTest) {
+  TEST_METHOD(KeyValueTable_InsertFindErase) {
+    KeyValueTable table;
+
+    Assert::IsTrue(table.insertOrAssign("key", make_shared<const string>("value")) == nullptr);
+    Assert::AreEqual(string{"value"}, *table.find("key"));
+
+    auto previous = table.insertOrAssign("key", make_shared<const string>("other"));
+    Assert::AreEqual(string{"value"}, *previous);
+    Assert::AreEqual(string{"other"}, *table.find("key"));
+    Assert::AreEqual(size_t{1}, table.size());
+
+    Assert::AreEqual(string{"other"}, *table.erase("key"));
+    Assert::IsTrue(table.find("key") == nullptr);
+    Assert::IsTrue(table.erase("key") == nullptr);
+    Assert::AreEqual(size_t{0}, table.size());
+  }
+
+  TEST_METHOD(KeyValueTable_ReferenceOutlivesErase) {
+    KeyValueTable table;
+    table.insertOrAssign("key", make_shared<const string>("value"));
+
+    auto value = table.find("key");
+    table.erase("key");
+
+    Assert::AreEqual(string{"value"}, *value);
+  }
+
+  TEST_METHOD(KeyValueTable_MatchesOrderedMap) {
+    KeyValueTable table;
+    std::map<string, string> expected;
+
+    // Interleave inserts and erases so that probe sequences wrap and get
+    // shifted back on removal.
+    for (int i = 0; i < 20000; i++) {
+      const string key = "key" + std::to_string((i * 7919) % 3001);
+      if (i % 3 == 0) {
+        table.erase(key);
+        expected.erase(key);
+      } else {
+        table.insertOrAssign(key, make_shared<const string>(std::to_string(i)));
+        expected[key] = std::to_string(i);
+      }
+    }
+
+    Assert::AreEqual(expected.size(), table.size());
+    for (const auto &kv : expected) {
+      auto value = table.find(kv.first);
+      Assert::IsTrue(value != nullptr);
+      Assert::AreEqual(kv.second, *value);
+    }
+
+    size_t visited = 0;
+    table.forEach([&](std::string_view key, const string &value) {
+      Assert::AreEqual(expected.at(string{key}), value);
+      visited++;
+    });
+    Assert::AreEqual(expected.size(), visited);
+
+    table.clear();
+    Assert::AreEqual(size_t{0}, table.size());
+  }
+
+  TEST_METHOD(KeyValueTable_DecodesOnFirstAccess) {
+    static int decodeCount = 0;
+    decodeCount = 0;
+    KeyValueTable table{[](std::string_view encoded) {
+      decodeCount++;
+      return string{encoded} + "!";
+    }};
+
+    const string encoded = "value";
+    Assert::IsFalse(table.assignEncoded("key", encoded).has_value());
+    Assert::IsFalse(table.assignEncoded("removed", encoded).has_value());
+    Assert::IsTrue(table.eraseEncoded("removed").has_value());
+    Assert::AreEqual(0, decodeCount);
+
+    Assert::AreEqual(string{"value!"}, *table.find("key"));
+    Assert::AreEqual(string{"value!"}, *table.find("key"));
+    Assert::AreEqual(1, decodeCount);
+
+    table.assignEncoded("other", encoded);
+    table.decodeAll();
+    Assert::AreEqual(2, decodeCount);
+    Assert::AreEqual(size_t{2}, table.size());
+  }
+
+  TEST_METHOD(KeyValueTable_ConcurrentReadersAndWriter) {
+    KeyValueTable table;
+    for (int i = 0; i < 1000; i++) {
+      table.insertOrAssign("key" + std::to_string(i), make_shared<const string>("initial"));
+    }
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; r++) {
+      readers.emplace_back([&table]() {
+        for (int i = 0; i < 100000; i++) {
+          auto value = table.find("key" + std::to_string(i % 1000));
+          Assert::IsTrue(value != nullptr);
+        }
+      });
+    }
+
+    for (int i = 0; i < 100000; i++) {
+      table.insertOrAssign("key" + std::to_string(i % 1000), make_shared<const string>(std::to_string(i)));
+      table.insertOrAssign("extra" + std::to_string(i % 5000), make_shared<const string>("extra"));
+    }
+
+    for (auto &reader : readers) {
+      reader.join();
+    }
+
+    Assert::AreEqual(size_t{6000}, table.size());
+  }
+};
+
+} // namespace Microsoft::React::Test
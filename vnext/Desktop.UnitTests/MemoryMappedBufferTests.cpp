@@ -1,4 +1,5 @@
 #include "MemoryMappedBuffer.h"
+#include "Unicode.h"
 #include "Utilities.h"
 
 #pragma pack(push)
@@ -6,17 +7,24 @@
 #include <CppUnitTest.h>
 #pragma pack(pop)
 
+#include <psapi.h>
 #include <shlwapi.h>
 #include <windows.h>
 
 #include <cstring>
+#include <fstream>
 #include <memory>
+#include <sstream>
 
 using facebook::jsi::Buffer;
 using facebook::jsi::JSINativeException;
 using Microsoft::Common::Utilities::CheckedReinterpretCast;
+using facebook::react::JSBigString;
+using Microsoft::Common::Unicode::Utf16ToUtf8;
+using Microsoft::JSI::MakeMemoryMappedBigString;
 using Microsoft::JSI::MakeMemoryMappedBuffer;
 using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
 
 namespace {
 
@@ -147,6 +155,134 @@ TEST_CLASS (MemoryMappedBufferUnitTests) {
       std::shared_ptr<Buffer> buffer = MakeMemoryMappedBuffer(m_testFileName.c_str(), badOffset);
     });
   }
+
+  TEST_METHOD(Utf8FileNameTest_WithOffset) {
+    constexpr const char *const fileContent = "This is a string with a UTF-8 file name.";
+    const size_t fileSize = strlen(fileContent);
+    WriteTestFile(fileContent, fileSize);
+
+    const size_t fileOffset = 5;
+    std::shared_ptr<Buffer> buffer = MakeMemoryMappedBuffer(Utf16ToUtf8(m_testFileName), fileOffset);
+
+    Assert::IsTrue(buffer->size() == fileSize - fileOffset);
+    Assert::IsTrue(strcmp(CheckedReinterpretCast<const char *>(buffer->data()), fileContent + fileOffset) == 0);
+  }
+
+  TEST_METHOD(BigStringTest_IsNullTerminated) {
+    constexpr const char *const content = "var bundle = 'This is a JavaScript bundle.';";
+    const size_t size = strlen(content);
+    WriteTestFile(content, size);
+
+    std::shared_ptr<const JSBigString> bigString = MakeMemoryMappedBigString(Utf16ToUtf8(m_testFileName));
+
+    Assert::IsTrue(bigString->size() == size);
+    Assert::IsTrue(strcmp(bigString->c_str(), content) == 0);
+  }
+
+  TEST_METHOD(BigStringTest_EdgeCaseFileSize) {
+    // The mapping of a file that fills its last page has no room for the null terminator.
+    std::string content(GetPageSize() * 2, 'a');
+    WriteTestFile(content.c_str(), content.length());
+
+    std::shared_ptr<const JSBigString> bigString = MakeMemoryMappedBigString(Utf16ToUtf8(m_testFileName));
+
+    Assert::IsTrue(bigString->size() == content.length());
+    Assert::IsTrue(strcmp(bigString->c_str(), content.c_str()) == 0);
+  }
+
+  TEST_METHOD(BigStringTest_ErrorTest_EmptyFile) {
+    WriteTestFile("", 0);
+
+    Assert::ExpectException<JSINativeException>([this] {
+      std::shared_ptr<const JSBigString> bigString = MakeMemoryMappedBigString(Utf16ToUtf8(m_testFileName));
+    });
+  }
+};
+
+#ifdef PERF_TESTS
+
+// Compares the bundle loading that copies the file, like the ifstream and StorageFile paths did,
+// with the memory mapped bundle.
+// The engine reads the whole bundle on its first evaluation, which is simulated by a pass over all bytes.
+TEST_CLASS (MemoryMappedBufferPerfTests) {
+  static constexpr size_t BundleSize = 15 * 1024 * 1024;
+
+  std::wstring m_testFileName{GetTestFileName()};
+
+  struct MemoryCounters {
+    size_t PrivateUsage;
+    size_t WorkingSetSize;
+    size_t PeakWorkingSetSize;
+  };
+
+  static MemoryCounters GetMemoryCounters() {
+    PROCESS_MEMORY_COUNTERS_EX counters{};
+    Assert::IsTrue(GetProcessMemoryInfo(
+        GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS *>(&counters), sizeof(counters)));
+    return {counters.PrivateUsage, counters.WorkingSetSize, counters.PeakWorkingSetSize};
+  }
+
+  static uint64_t Evaluate(const JSBigString &bundle) {
+    uint64_t checksum = 0;
+    const char *data = bundle.c_str();
+    for (size_t i = 0; i < bundle.size(); ++i) {
+      checksum += static_cast<uint8_t>(data[i]);
+    }
+
+    return checksum;
+  }
+
+  template <typename TLoad>
+  void MeasureStartup(const char *name, TLoad load) {
+    LARGE_INTEGER freq{0}, start{0}, loaded{0}, evaluated{0};
+    Assert::IsTrue(QueryPerformanceFrequency(&freq));
+
+    auto before = GetMemoryCounters();
+    QueryPerformanceCounter(&start);
+    std::unique_ptr<const JSBigString> bundle = load();
+    QueryPerformanceCounter(&loaded);
+    uint64_t checksum = Evaluate(*bundle);
+    QueryPerformanceCounter(&evaluated);
+    auto after = GetMemoryCounters();
+
+    Assert::AreEqual(static_cast<uint64_t>('a') * BundleSize, checksum);
+
+    auto toMilliseconds = [&freq](LONGLONG ticks) { return static_cast<double>(ticks) * 1000 / freq.QuadPart; };
+    std::stringstream ss;
+    ss << "MemoryMappedBufferPerf_Startup: " << name << "; size=" << BundleSize
+       << "; load=" << toMilliseconds(loaded.QuadPart - start.QuadPart)
+       << " ms; first eval=" << toMilliseconds(evaluated.QuadPart - start.QuadPart)
+       << " ms; private bytes=" << static_cast<int64_t>(after.PrivateUsage - before.PrivateUsage)
+       << "; working set=" << static_cast<int64_t>(after.WorkingSetSize - before.WorkingSetSize)
+       << "; peak working set=" << static_cast<int64_t>(after.PeakWorkingSetSize - before.PeakWorkingSetSize);
+    Logger::WriteMessage(ss.str().c_str());
+  }
+
+ public:
+  MemoryMappedBufferPerfTests() {
+    std::ofstream file{m_testFileName, std::ios::binary | std::ios::trunc};
+    std::string content(BundleSize, 'a');
+    file.write(content.data(), content.size());
+  }
+
+  ~MemoryMappedBufferPerfTests() {
+    DeleteFileW(m_testFileName.c_str());
+  }
+
+  TEST_METHOD(MemoryMappedBufferPerf_Startup) {
+    // The memory mapped bundle runs first, so that the peak working set of the copies does not hide its own.
+    MeasureStartup("MemoryMapped", [this]() { return MakeMemoryMappedBigString(Utf16ToUtf8(m_testFileName)); });
+
+    MeasureStartup("CopiedTwice", [this]() {
+      std::ifstream file{m_testFileName, std::ios::binary | std::ios::ate};
+      std::string buffer(static_cast<size_t>(file.tellg()), '\0');
+      file.seekg(0, std::ios::beg);
+      file.read(buffer.data(), buffer.size());
+      return std::make_unique<const facebook::react::JSBigStdString>(std::string{buffer});
+    });
+  }
 };
 
+#endif // PERF_TESTS
+
 } // namespace Microsoft::JSI::Test
@@ -0,0 +1,263 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <MemoryMappedBuffer.h>
+#include <MemoryMappedRAMBundle.h>
+#include <Unicode.h>
+
+#pragma pack(push)
+#pragma warning(disable : 4103)
+#include <CppUnitTest.h>
+#pragma pack(pop)
+
+#include <psapi.h>
+#include <windows.h>
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using facebook::react::JSBigStdString;
+using facebook::react::JSBigString;
+using facebook::react::JSModulesUnbundle;
+using facebook::react::MemoryMappedRAMBundle;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
+using std::string;
+using std::vector;
+
+namespace {
+
+constexpr uint32_t RAMBundleMagicNumber = 0xFB0BD1E5;
+
+void AppendUInt32(string &bundle, uint32_t value) {
+  char bytes[sizeof(value)];
+  memcpy(bytes, &value, sizeof(value));
+  bundle.append(bytes, sizeof(bytes));
+}
+
+// Builds an indexed RAM bundle the same way the Metro bundler does.
+// Empty modules are left out of the bundle, like the IDs of modules that are not part of it.
+string MakeRAMBundle(const string &startupCode, const vector<string> &modules) {
+  string body = startupCode + '\0';
+  string table;
+  for (const auto &module : modules) {
+    if (module.empty()) {
+      AppendUInt32(table, 0);
+      AppendUInt32(table, 0);
+    } else {
+      AppendUInt32(table, static_cast<uint32_t>(body.size()));
+      AppendUInt32(table, static_cast<uint32_t>(module.size() + 1));
+      body += module + '\0';
+    }
+  }
+
+  string bundle;
+  AppendUInt32(bundle, RAMBundleMagicNumber);
+  AppendUInt32(bundle, static_cast<uint32_t>(modules.size()));
+  AppendUInt32(bundle, static_cast<uint32_t>(startupCode.size() + 1));
+  return bundle + table + body;
+}
+
+std::shared_ptr<const JSBigString> MakeBigString(string bundle) {
+  return std::make_shared<const JSBigStdString>(std::move(bundle));
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (MemoryMappedRAMBundleTests) {
+  TEST_METHOD(DetectsIndexedRAMBundle) {
+    Assert::IsTrue(MemoryMappedRAMBundle::isIndexedRAMBundle(*MakeBigString(MakeRAMBundle("startup();", {}))));
+    Assert::IsFalse(MemoryMappedRAMBundle::isIndexedRAMBundle(*MakeBigString("var x = 'not a RAM bundle';")));
+    Assert::IsFalse(MemoryMappedRAMBundle::isIndexedRAMBundle(*MakeBigString("")));
+  }
+
+  TEST_METHOD(ReturnsStartupCodeWithoutCopy) {
+    auto bundle = MakeBigString(MakeRAMBundle("startup();", {"module0();"}));
+    MemoryMappedRAMBundle ramBundle{bundle};
+
+    auto startupCode = ramBundle.getStartupCode();
+    Assert::AreEqual(string{"startup();"}, string{startupCode->c_str(), startupCode->size()});
+    Assert::AreEqual('\0', startupCode->c_str()[startupCode->size()]);
+
+    // The startup code points into the bundle.
+    Assert::IsTrue(startupCode->c_str() > bundle->c_str());
+    Assert::IsTrue(startupCode->c_str() < bundle->c_str() + bundle->size());
+  }
+
+  TEST_METHOD(StartupCodeOutlivesRAMBundle) {
+    std::unique_ptr<const JSBigString> startupCode;
+    {
+      MemoryMappedRAMBundle ramBundle{MakeBigString(MakeRAMBundle("startup();", {}))};
+      startupCode = ramBundle.getStartupCode();
+    }
+
+    Assert::AreEqual(string{"startup();"}, string{startupCode->c_str(), startupCode->size()});
+  }
+
+  TEST_METHOD(ReturnsModules) {
+    MemoryMappedRAMBundle ramBundle{MakeBigString(MakeRAMBundle("startup();", {"module0();", "", "module2();"}))};
+    Assert::AreEqual(uint32_t{3}, ramBundle.moduleCount());
+
+    auto module0 = ramBundle.getModule(0);
+    Assert::AreEqual(string{"0.js"}, module0.name);
+    Assert::AreEqual(string{"module0();"}, module0.code);
+
+    auto module2 = ramBundle.getModule(2);
+    Assert::AreEqual(string{"2.js"}, module2.name);
+    Assert::AreEqual(string{"module2();"}, module2.code);
+  }
+
+  TEST_METHOD(MissingModuleThrows) {
+    MemoryMappedRAMBundle ramBundle{MakeBigString(MakeRAMBundle("startup();", {"module0();", ""}))};
+
+    Assert::ExpectException<JSModulesUnbundle::ModuleNotFound>([&ramBundle]() { ramBundle.getModule(1); });
+    Assert::ExpectException<JSModulesUnbundle::ModuleNotFound>([&ramBundle]() { ramBundle.getModule(2); });
+  }
+
+  TEST_METHOD(ModuleOutsideOfBundleThrows) {
+    auto bundle = MakeRAMBundle("startup();", {"module0();"});
+
+    // Moves the module past the end of the bundle.
+    uint32_t offset = static_cast<uint32_t>(bundle.size());
+    memcpy(&bundle[12], &offset, sizeof(offset));
+    MemoryMappedRAMBundle ramBundle{MakeBigString(std::move(bundle))};
+
+    Assert::ExpectException<JSModulesUnbundle::ModuleNotFound>([&ramBundle]() { ramBundle.getModule(0); });
+  }
+
+  TEST_METHOD(InvalidBundleThrows) {
+    Assert::ExpectException<std::runtime_error>(
+        []() { MemoryMappedRAMBundle{MakeBigString("var x = 'not a RAM bundle';")}; });
+
+    // The module table does not fit in the bundle.
+    auto truncated = MakeRAMBundle("startup();", {"module0();", "module1();"}).substr(0, 16);
+    Assert::ExpectException<std::runtime_error>([&truncated]() { MemoryMappedRAMBundle{MakeBigString(truncated)}; });
+
+    // The module table size overflows.
+    auto overflowing = MakeRAMBundle("startup();", {"module0();"});
+    uint32_t moduleCount = std::numeric_limits<uint32_t>::max();
+    memcpy(&overflowing[4], &moduleCount, sizeof(moduleCount));
+    Assert::ExpectException<std::runtime_error>(
+        [&overflowing]() { MemoryMappedRAMBundle{MakeBigString(overflowing)}; });
+
+    // The startup code does not fit in the bundle.
+    auto bundle = MakeRAMBundle("startup();", {});
+    bundle.resize(bundle.size() - 1);
+    Assert::ExpectException<std::runtime_error>([&bundle]() { MemoryMappedRAMBundle{MakeBigString(bundle)}; });
+  }
+};
+
+#ifdef PERF_TESTS
+
+// Compares loading a monolithic bundle with loading the same application as an indexed RAM bundle.
+// The monolithic bundle is read as a whole, while only the startup code and the modules required during
+// startup are read from the RAM bundle.
+TEST_CLASS (MemoryMappedRAMBundlePerfTests) {
+  static constexpr uint32_t ModuleCount = 5000;
+  static constexpr uint32_t RequiredModuleCount = 100;
+  static constexpr size_t ModuleSize = 3 * 1024;
+
+  std::wstring m_bundleFileName;
+  std::wstring m_ramBundleFileName;
+
+  static std::wstring GetTestFileName() {
+    wchar_t tempPath[MAX_PATH];
+    Assert::IsTrue(GetTempPathW(MAX_PATH, tempPath) != 0);
+
+    wchar_t testFileName[MAX_PATH];
+    Assert::IsTrue(GetTempFileNameW(tempPath, L"MemoryMappedRAMBundlePerfTests", 0, testFileName) != 0);
+    return testFileName;
+  }
+
+  static string MakeModule(uint32_t moduleId) {
+    string module = "__d(function(){/*" + std::to_string(moduleId);
+    module.append(ModuleSize - module.size() - 6, 'a');
+    return module + "*/});";
+  }
+
+  static void WriteFile(const std::wstring &fileName, const string &content) {
+    std::ofstream file{fileName, std::ios::binary};
+    file.write(content.c_str(), content.size());
+    Assert::IsTrue(file.good());
+  }
+
+  static size_t GetWorkingSetSize() {
+    PROCESS_MEMORY_COUNTERS counters{};
+    Assert::IsTrue(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)));
+    return counters.WorkingSetSize;
+  }
+
+  template <typename TLoad>
+  static void MeasureStartup(const char *name, TLoad load) {
+    LARGE_INTEGER freq{0}, start{0}, end{0};
+    Assert::IsTrue(QueryPerformanceFrequency(&freq));
+
+    auto before = GetWorkingSetSize();
+    QueryPerformanceCounter(&start);
+    size_t bytesRead = load();
+    QueryPerformanceCounter(&end);
+    auto after = GetWorkingSetSize();
+
+    std::stringstream ss;
+    ss << "MemoryMappedRAMBundlePerf_Startup: " << name << "; modules=" << ModuleCount
+       << "; required=" << RequiredModuleCount << "; bytes read=" << bytesRead
+       << "; time=" << static_cast<double>(end.QuadPart - start.QuadPart) * 1000 / freq.QuadPart
+       << " ms; working set=" << static_cast<int64_t>(after - before);
+    Logger::WriteMessage(ss.str().c_str());
+  }
+
+ public:
+  MemoryMappedRAMBundlePerfTests() : m_bundleFileName{GetTestFileName()}, m_ramBundleFileName{GetTestFileName()} {
+    const string startupCode = "var __d = function(){};";
+    vector<string> modules;
+    string bundle = startupCode + '\n';
+    for (uint32_t i = 0; i < ModuleCount; ++i) {
+      modules.push_back(MakeModule(i));
+      bundle += modules.back() + '\n';
+    }
+
+    WriteFile(m_bundleFileName, bundle);
+    WriteFile(m_ramBundleFileName, MakeRAMBundle(startupCode, modules));
+  }
+
+  ~MemoryMappedRAMBundlePerfTests() {
+    DeleteFileW(m_bundleFileName.c_str());
+    DeleteFileW(m_ramBundleFileName.c_str());
+  }
+
+  TEST_METHOD(Startup) {
+    // Evaluating the monolithic bundle touches every byte.
+    MeasureStartup("monolithic", [this]() {
+      auto bundle =
+          Microsoft::JSI::MakeMemoryMappedBigString(Microsoft::Common::Unicode::Utf16ToUtf8(m_bundleFileName));
+      uint64_t checksum = 0;
+      for (size_t i = 0; i < bundle->size(); ++i) {
+        checksum += static_cast<uint8_t>(bundle->c_str()[i]);
+      }
+
+      Assert::AreNotEqual(uint64_t{0}, checksum);
+      return bundle->size();
+    });
+
+    MeasureStartup("RAM bundle", [this]() {
+      auto ramBundle = MemoryMappedRAMBundle::fromPath(Microsoft::Common::Unicode::Utf16ToUtf8(m_ramBundleFileName));
+      size_t bytesRead = ramBundle->getStartupCode()->size();
+      for (uint32_t i = 0; i < RequiredModuleCount; ++i) {
+        bytesRead += ramBundle->getModule(i * (ModuleCount / RequiredModuleCount)).code.size();
+      }
+
+      return bytesRead;
+    });
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <ParallelYogaLayout.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::ParallelYogaLayout;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+constexpr float LeafWidth = 10;
+constexpr float LeafHeight = 20;
+
+std::thread::id s_callingThread;
+std::atomic<int> s_measureCount{0};
+std::atomic<int> s_otherThreadMeasureCount{0};
+
+// Stands in for a view manager measure function. Nodes with a context throw like a failing XAML measure.
+YGSize MeasureLeaf(YGNodeRef node, float /*width*/, YGMeasureMode, float /*height*/, YGMeasureMode) {
+  ++s_measureCount;
+  if (std::this_thread::get_id() != s_callingThread) {
+    ++s_otherThreadMeasureCount;
+  }
+
+  if (YGNodeGetContext(node)) {
+    throw std::runtime_error("Measure failed.");
+  }
+
+  return {LeafWidth, LeafHeight};
+}
+
+YGSize MeasureLeafInCallingThread(
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  return ParallelYogaLayout::Measure(MeasureLeaf, node, width, widthMode, height, heightMode);
+}
+
+// Independent root trees whose leaves have a measure function.
+struct TestRoots {
+  TestRoots(size_t rootCount, size_t leafCount) {
+    for (size_t i = 0; i < rootCount; ++i) {
+      YGNodeRef root = YGNodeNew();
+      for (size_t j = 0; j < leafCount; ++j) {
+        YGNodeRef leaf = YGNodeNew();
+        YGNodeSetMeasureFunc(leaf, MeasureLeafInCallingThread);
+        YGNodeInsertChild(root, leaf, static_cast<uint32_t>(j));
+      }
+
+      m_roots.push_back(root);
+    }
+
+    s_callingThread = std::this_thread::get_id();
+    s_measureCount = 0;
+    s_otherThreadMeasureCount = 0;
+  }
+
+  ~TestRoots() {
+    for (YGNodeRef root : m_roots) {
+      YGNodeFreeRecursive(root);
+    }
+  }
+
+  std::vector<ParallelYogaLayout::Root> Roots() const {
+    std::vector<ParallelYogaLayout::Root> roots;
+    for (YGNodeRef root : m_roots) {
+      roots.push_back({root, 1000, YGUndefined});
+    }
+
+    return roots;
+  }
+
+  YGNodeRef Root(size_t index) const {
+    return m_roots[index];
+  }
+
+ private:
+  std::vector<YGNodeRef> m_roots;
+};
+
+} // namespace
+
+TEST_CLASS (ParallelYogaLayoutTests) {
+  TEST_METHOD(ParallelYogaLayout_MeasuresInCallingThread) {
+    constexpr size_t rootCount = 8;
+    constexpr size_t leafCount = 50;
+    TestRoots roots{rootCount, leafCount};
+
+    ParallelYogaLayout::Calculate(roots.Roots());
+
+    for (size_t i = 0; i < rootCount; ++i) {
+      YGNodeRef root = roots.Root(i);
+      Assert::IsFalse(YGNodeIsDirty(root));
+      Assert::AreEqual(static_cast<float>(leafCount) * LeafHeight, YGNodeLayoutGetHeight(root));
+      Assert::AreEqual(LeafHeight, YGNodeLayoutGetHeight(YGNodeGetChild(root, static_cast<uint32_t>(leafCount - 1))));
+    }
+
+    Assert::IsTrue(s_measureCount >= static_cast<int>(rootCount * leafCount));
+    Assert::AreEqual(0, s_otherThreadMeasureCount.load());
+  }
+
+  TEST_METHOD(ParallelYogaLayout_RethrowsMeasureException) {
+    TestRoots roots{4, 10};
+    static int failingContext = 0;
+    YGNodeSetContext(YGNodeGetChild(roots.Root(2), 5), &failingContext);
+
+    Assert::ExpectException<std::runtime_error>([&roots]() { ParallelYogaLayout::Calculate(roots.Roots()); });
+    Assert::AreEqual(0, s_otherThreadMeasureCount.load());
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -2,7 +2,6 @@
 // Licensed under the MIT License.
 
 #include <BaseScriptStoreImpl.h>
-#include <CppRuntimeOptions.h>
 #include <CppUnitTest.h>
 
 // Windows API
@@ -12,6 +11,8 @@
 // Standard Library
 #include <cstdio>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
 
 using namespace facebook::jsi;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -24,10 +25,6 @@ using winrt::Windows::System::Diagnostics::ProcessDiagnosticInfo;
 namespace Microsoft::JSI::Test {
 
 TEST_CLASS (ScriptStoreIntegrationTest) {
-  TEST_CLASS_INITIALIZE(Init) {
-    React::SetRuntimeOptionBool("JSI.MemoryMappedScriptStore", true);
-  }
-
   // Do not run this test in parallel with others.
   // It uses process telemetry and should run on isolation.
   TEST_METHOD(RetrievePreparedScriptMemoryUsage) {
@@ -68,4 +65,129 @@ TEST_CLASS (ScriptStoreIntegrationTest) {
     Assert::IsTrue(endWorkingSet - startWorkingSet < fileSize);
   }
 };
+
+TEST_CLASS (ScriptStoreTest) {
+  std::filesystem::path m_storeDirectory;
+
+  std::string StorePath(const std::string &fileName) {
+    return (m_storeDirectory / fileName).u8string();
+  }
+
+  void WriteFile(const std::string &fileName, const std::string &content) {
+    std::ofstream file{m_storeDirectory / fileName, std::ios::binary | std::ios::trunc};
+    file.write(content.data(), content.size());
+  }
+
+  std::string ReadFile(const std::string &fileName) {
+    std::ifstream file{m_storeDirectory / fileName, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+
+  std::string StoreDirectory() {
+    return (m_storeDirectory / "").u8string();
+  }
+
+  TEST_METHOD_INITIALIZE(Initialize) {
+    char tempPath[MAX_PATH];
+    Assert::IsTrue(GetTempPathA(MAX_PATH, tempPath) != 0);
+    m_storeDirectory = std::filesystem::u8path(tempPath) / ("ScriptStoreTest_" + std::to_string(GetCurrentProcessId()));
+    std::filesystem::remove_all(m_storeDirectory);
+    std::filesystem::create_directories(m_storeDirectory);
+  }
+
+  TEST_METHOD_CLEANUP(CleanUp) {
+    std::error_code ec;
+    std::filesystem::remove_all(m_storeDirectory, ec);
+  }
+
+  TEST_METHOD(ScriptVersionChangesWithContentOfSameSize) {
+    facebook::react::BaseScriptStoreImpl scriptStore;
+
+    WriteFile("index.bundle", "var a = 1;");
+    auto firstVersion = scriptStore.getScriptVersion(StorePath("index.bundle"));
+    auto versionedScript = scriptStore.getVersionedScript(StorePath("index.bundle"));
+
+    WriteFile("index.bundle", "var a = 2;");
+    auto secondVersion = scriptStore.getScriptVersion(StorePath("index.bundle"));
+
+    Assert::AreNotEqual<uint64_t>(0, firstVersion);
+    Assert::AreNotEqual<uint64_t>(0, secondVersion);
+    Assert::AreNotEqual(firstVersion, secondVersion);
+    Assert::AreEqual(firstVersion, versionedScript.version);
+  }
+
+  TEST_METHOD(CorruptedPreparedScriptIsNotReturned) {
+    facebook::react::BasePreparedScriptStoreImpl preparedScriptStore{StoreDirectory()};
+    const auto scriptSignature = ScriptSignature{"index.bundle", 1};
+    const auto runtimeSignature = JSRuntimeSignature{"V8", 8};
+    preparedScriptStore.persistPreparedScript(
+        make_shared<StringBuffer>(std::string(1024, 'a')), scriptSignature, runtimeSignature, nullptr);
+
+    auto preparedScript = preparedScriptStore.tryGetPreparedScript(scriptSignature, runtimeSignature, nullptr);
+    Assert::IsTrue(preparedScript != nullptr);
+    Assert::AreEqual(size_t{1024}, preparedScript->size());
+    preparedScript.reset();
+
+    // Change a byte of the prepared script without changing its size.
+    auto fileName = std::filesystem::directory_iterator{m_storeDirectory}->path().filename().u8string();
+    auto content = ReadFile(fileName);
+    content[content.size() / 2] = 'b';
+    WriteFile(fileName, content);
+
+    Assert::IsTrue(preparedScriptStore.tryGetPreparedScript(scriptSignature, runtimeSignature, nullptr) == nullptr);
+  }
+
+  TEST_METHOD(PreparedScriptOfOtherScriptVersionIsNotReturned) {
+    facebook::react::BasePreparedScriptStoreImpl preparedScriptStore{StoreDirectory()};
+    const auto runtimeSignature = JSRuntimeSignature{"V8", 8};
+    const auto scriptSignature = ScriptSignature{"index.bundle", 1};
+    preparedScriptStore.persistPreparedScript(
+        make_shared<StringBuffer>(std::string(1024, 'a')), scriptSignature, runtimeSignature, nullptr);
+
+    Assert::IsTrue(
+        preparedScriptStore.tryGetPreparedScript(ScriptSignature{"index.bundle", 2}, runtimeSignature, nullptr) ==
+        nullptr);
+  }
+
+  TEST_METHOD(LeastRecentlyUsedPreparedScriptsAreEvicted) {
+    // Room for two prepared scripts of 1 KB with their headers.
+    facebook::react::BasePreparedScriptStoreImpl preparedScriptStore{StoreDirectory(), 2 * 1024 + 256};
+    const auto runtimeSignature = JSRuntimeSignature{"V8", 8};
+    auto persist = [&](const char *url) {
+      preparedScriptStore.persistPreparedScript(
+          make_shared<StringBuffer>(std::string(1024, 'a')), ScriptSignature{url, 1}, runtimeSignature, nullptr);
+    };
+    auto isStored = [&](const char *url) {
+      return preparedScriptStore.tryGetPreparedScript(ScriptSignature{url, 1}, runtimeSignature, nullptr) != nullptr;
+    };
+
+    // File times may have a coarse resolution.
+    persist("first.bundle");
+    Sleep(50);
+    persist("second.bundle");
+    Sleep(50);
+    Assert::IsTrue(isStored("first.bundle"));
+    Sleep(50);
+    persist("third.bundle");
+
+    Assert::IsTrue(isStored("first.bundle"));
+    Assert::IsFalse(isStored("second.bundle"));
+    Assert::IsTrue(isStored("third.bundle"));
+  }
+
+  TEST_METHOD(TemporaryPreparedScriptFilesAreNotEvicted) {
+    facebook::react::BasePreparedScriptStoreImpl preparedScriptStore{StoreDirectory(), 2 * 1024 + 256};
+    const auto runtimeSignature = JSRuntimeSignature{"V8", 8};
+
+    // Another runtime is writing a prepared script.
+    WriteFile("prep_other_bundle_V8.cache.tmp1", std::string(4 * 1024, 'a'));
+    Sleep(50);
+    const auto scriptSignature = ScriptSignature{"index.bundle", 1};
+    preparedScriptStore.persistPreparedScript(
+        make_shared<StringBuffer>(std::string(1024, 'a')), scriptSignature, runtimeSignature, nullptr);
+
+    Assert::IsTrue(std::filesystem::exists(m_storeDirectory / "prep_other_bundle_V8.cache.tmp1"));
+    Assert::IsTrue(preparedScriptStore.tryGetPreparedScript(scriptSignature, runtimeSignature, nullptr) != nullptr);
+  }
+};
 } // namespace Microsoft::JSI::Test
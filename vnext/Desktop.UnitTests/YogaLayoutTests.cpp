@@ -0,0 +1,203 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <yoga/Yoga.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <windows.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+// A tree of Yoga nodes indexed by tag, with the same lookups that NativeUIManager does for shadow nodes.
+struct TestLayoutTree {
+  // Creates a tree with the nodeCount nodes where every node has up to fanOut children.
+  TestLayoutTree(int64_t nodeCount, int64_t fanOut) : m_children(static_cast<size_t>(nodeCount)) {
+    m_config = YGConfigNew();
+    for (int64_t tag = 0; tag < nodeCount; tag++) {
+      YGNodeRef node = YGNodeNewWithConfig(m_config);
+      YGNodeStyleSetFlexDirection(node, (tag % 2) ? YGFlexDirectionRow : YGFlexDirectionColumn);
+      YGNodeStyleSetPadding(node, YGEdgeAll, 1);
+      m_tagsToYogaNodes.emplace(tag, node);
+
+      if (tag > 0) {
+        const int64_t parentTag = (tag - 1) / fanOut;
+        YGNodeRef parent = m_tagsToYogaNodes[parentTag];
+        YGNodeInsertChild(parent, node, YGNodeGetChildCount(parent));
+        m_children[static_cast<size_t>(parentTag)].push_back(tag);
+      }
+    }
+
+    for (int64_t tag = 0; tag < nodeCount; tag++) {
+      if (m_children[static_cast<size_t>(tag)].empty()) {
+        YGNodeStyleSetWidth(GetYogaNode(tag), 10);
+        YGNodeStyleSetHeight(GetYogaNode(tag), 10);
+        m_leafTags.push_back(tag);
+      }
+    }
+  }
+
+  ~TestLayoutTree() {
+    YGNodeFreeRecursive(GetYogaNode(0));
+    YGConfigFree(m_config);
+  }
+
+  YGNodeRef GetYogaNode(int64_t tag) const {
+    auto it = m_tagsToYogaNodes.find(tag);
+    return it != m_tagsToYogaNodes.end() ? it->second : nullptr;
+  }
+
+  const std::vector<int64_t> &LeafTags() const {
+    return m_leafTags;
+  }
+
+  void CalculateLayout() {
+    YGNodeCalculateLayout(GetYogaNode(0), 10000, YGUndefined, YGDirectionLTR);
+  }
+
+  // Visits every node like NativeUIManager did before, and returns tags of nodes with a new layout.
+  void CollectAll(int64_t tag, std::vector<int64_t> &tags) {
+    for (int64_t child : m_children[static_cast<size_t>(tag)]) {
+      CollectAll(child, tags);
+    }
+
+    YGNodeRef node = GetYogaNode(tag);
+    if (YGNodeGetHasNewLayout(node)) {
+      YGNodeSetHasNewLayout(node, false);
+      tags.push_back(tag);
+    }
+  }
+
+  // Visits only subtrees with a new layout like NativeUIManager::CollectLayoutUpdates.
+  void CollectNewLayout(int64_t tag, std::vector<int64_t> &tags) {
+    YGNodeRef node = GetYogaNode(tag);
+    if (!YGNodeGetHasNewLayout(node))
+      return;
+    YGNodeSetHasNewLayout(node, false);
+
+    for (int64_t child : m_children[static_cast<size_t>(tag)]) {
+      CollectNewLayout(child, tags);
+    }
+
+    tags.push_back(tag);
+  }
+
+ private:
+  YGConfigRef m_config{nullptr};
+  std::unordered_map<int64_t, YGNodeRef> m_tagsToYogaNodes;
+  std::vector<std::vector<int64_t>> m_children;
+  std::vector<int64_t> m_leafTags;
+};
+
+} // namespace
+
+TEST_CLASS (YogaLayoutTests) {
+  // NativeUIManager skips subtrees whose root has no new layout.
+  // Check that it finds the same nodes as the walk through the whole tree.
+  TEST_METHOD(YogaLayout_NewLayoutSubtreesContainAllChanges) {
+    std::mt19937 random{42};
+    TestLayoutTree allTree{1000, 4};
+    TestLayoutTree prunedTree{1000, 4};
+
+    std::vector<int64_t> allTags;
+    std::vector<int64_t> prunedTags;
+    allTree.CalculateLayout();
+    prunedTree.CalculateLayout();
+    allTree.CollectAll(0, allTags);
+    prunedTree.CollectNewLayout(0, prunedTags);
+    Assert::AreEqual(size_t{1000}, allTags.size());
+    Assert::IsTrue(allTags == prunedTags);
+
+    for (int i = 0; i < 100; i++) {
+      const auto &leafTags = allTree.LeafTags();
+      const int64_t leafTag = leafTags[random() % leafTags.size()];
+      const float width = static_cast<float>(random() % 3) * 5 + 5;
+      YGNodeStyleSetWidth(allTree.GetYogaNode(leafTag), width);
+      YGNodeStyleSetWidth(prunedTree.GetYogaNode(leafTag), width);
+
+      allTags.clear();
+      prunedTags.clear();
+      allTree.CalculateLayout();
+      prunedTree.CalculateLayout();
+      allTree.CollectAll(0, allTags);
+      prunedTree.CollectNewLayout(0, prunedTags);
+      std::sort(allTags.begin(), allTags.end());
+      std::sort(prunedTags.begin(), prunedTags.end());
+      Assert::IsTrue(allTags == prunedTags);
+    }
+  }
+};
+
+#ifdef PERF_TESTS
+
+TEST_CLASS (YogaLayoutPerfTests) {
+  // Changes one leaf of a tree and applies the new layout.
+  // Compares the walk through the whole tree with the walk through the subtrees with a new layout.
+  TEST_METHOD(YogaLayoutPerf_ApplyOneChangedLeaf) {
+    static const int iterations = 100;
+    static const int64_t fanOut = 8;
+
+    for (int64_t nodeCount : {1000, 10000, 100000}) {
+      TestLayoutTree tree{nodeCount, fanOut};
+      std::vector<int64_t> tags;
+      tree.CalculateLayout();
+      tree.CollectAll(0, tags);
+
+      const int64_t leafTag = tree.LeafTags().back();
+      LONGLONG allTime{0};
+      LONGLONG prunedTime{0};
+      size_t allCount{0};
+      size_t prunedCount{0};
+      for (int i = 0; i < iterations; i++) {
+        LARGE_INTEGER a{0}, b{0};
+        YGNodeStyleSetWidth(tree.GetYogaNode(leafTag), static_cast<float>(10 + i % 2));
+        tree.CalculateLayout();
+        tags.clear();
+        QueryPerformanceCounter(&a);
+        tree.CollectAll(0, tags);
+        QueryPerformanceCounter(&b);
+        allTime += b.QuadPart - a.QuadPart;
+        allCount = tags.size();
+
+        YGNodeStyleSetWidth(tree.GetYogaNode(leafTag), static_cast<float>(11 - i % 2));
+        tree.CalculateLayout();
+        tags.clear();
+        QueryPerformanceCounter(&a);
+        tree.CollectNewLayout(0, tags);
+        QueryPerformanceCounter(&b);
+        prunedTime += b.QuadPart - a.QuadPart;
+        prunedCount = tags.size();
+      }
+
+      PrintResult("AllNodes", nodeCount, allCount, iterations, allTime);
+      PrintResult("NewLayoutSubtrees", nodeCount, prunedCount, iterations, prunedTime);
+    }
+  }
+
+  static void PrintResult(const char *name, int64_t nodeCount, size_t updated, int iterations, LONGLONG accu) {
+    LARGE_INTEGER freq{0};
+    Assert::IsTrue(QueryPerformanceFrequency(&freq));
+    std::stringstream ss;
+
+    double time = static_cast<double>(accu) / freq.QuadPart;
+    ss << "YogaLayoutPerf_ApplyOneChangedLeaf: " << name << "; nodes=" << nodeCount << "; updated=" << updated
+       << "; its=" << iterations << "; tt=" << time << " s; tc=" << time / iterations * std::pow(10, 6) << " us";
+    Logger::WriteMessage(ss.str().c_str());
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <YogaNodePool.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+YGSize MeasureNode(YGNodeRef /*node*/, float /*width*/, YGMeasureMode, float /*height*/, YGMeasureMode) {
+  return {10, 20};
+}
+
+struct YogaConfig {
+  YogaConfig() noexcept : Config{YGConfigNew()} {}
+
+  ~YogaConfig() {
+    YGConfigFree(Config);
+  }
+
+  const YGConfigRef Config;
+};
+
+} // namespace
+
+TEST_CLASS (YogaNodePoolTests) {
+  TEST_METHOD(YogaNodePool_ReusedNodeStartsClean) {
+    YogaConfig config;
+    YogaNodePool pool;
+    YogaNodePtr fresh(YGNodeNewWithConfig(config.Config));
+
+    YogaNodePtr parent = pool.MakeNode(config.Config);
+    YogaNodePtr node = pool.MakeNode(config.Config);
+    YogaNodePtr child = pool.MakeNode(config.Config);
+    YGNodeRef recycledNode = node.get();
+
+    static int context = 0;
+    YGNodeStyleSetWidth(recycledNode, 100);
+    YGNodeStyleSetFlexDirection(recycledNode, YGFlexDirectionRow);
+    YGNodeStyleSetMargin(recycledNode, YGEdgeLeft, 5);
+    YGNodeStyleSetDisplay(recycledNode, YGDisplayNone);
+    YGNodeSetContext(recycledNode, &context);
+    YGNodeInsertChild(parent.get(), recycledNode, 0);
+    YGNodeCalculateLayout(parent.get(), 200, 200, YGDirectionLTR);
+    YGNodeRemoveChild(parent.get(), recycledNode);
+
+    // A view with a measure function has no children, so the measure function is set on another node.
+    YogaNodePtr measuredNode = pool.MakeNode(config.Config);
+    YGNodeRef recycledMeasuredNode = measuredNode.get();
+    YGNodeSetMeasureFunc(recycledMeasuredNode, MeasureNode);
+
+    YGNodeInsertChild(parent.get(), recycledNode, 0);
+    YGNodeInsertChild(recycledNode, child.get(), 0);
+    pool.RecycleNode(std::move(node));
+    pool.RecycleNode(std::move(measuredNode));
+    Assert::AreEqual(size_t{2}, pool.FreeNodeCount());
+
+    // The owner and the children of the recycled node stay valid, and are detached from it.
+    Assert::AreEqual(0u, YGNodeGetChildCount(parent.get()));
+    Assert::IsNull(YGNodeGetOwner(child.get()));
+
+    for (int i = 0; i < 2; ++i) {
+      YogaNodePtr reused = pool.MakeNode(config.Config);
+      YGNodeRef reusedNode = reused.get();
+
+      Assert::IsTrue(reusedNode == recycledNode || reusedNode == recycledMeasuredNode);
+      Assert::IsNull(YGNodeGetOwner(reusedNode));
+      Assert::AreEqual(0u, YGNodeGetChildCount(reusedNode));
+      Assert::IsNull(YGNodeGetContext(reusedNode));
+      Assert::IsFalse(YGNodeHasMeasureFunc(reusedNode));
+
+      Assert::IsTrue(YGNodeStyleGetWidth(fresh.get()) == YGNodeStyleGetWidth(reusedNode));
+      Assert::IsTrue(YGNodeStyleGetMargin(fresh.get(), YGEdgeLeft) == YGNodeStyleGetMargin(reusedNode, YGEdgeLeft));
+      Assert::AreEqual(
+          static_cast<int>(YGNodeStyleGetFlexDirection(fresh.get())),
+          static_cast<int>(YGNodeStyleGetFlexDirection(reusedNode)));
+      Assert::AreEqual(
+          static_cast<int>(YGNodeStyleGetDisplay(fresh.get())), static_cast<int>(YGNodeStyleGetDisplay(reusedNode)));
+
+      // The node lays out like a new node.
+      YGNodeCalculateLayout(reusedNode, 50, 60, YGDirectionLTR);
+      Assert::AreEqual(50.0f, YGNodeLayoutGetWidth(reusedNode));
+      Assert::AreEqual(60.0f, YGNodeLayoutGetHeight(reusedNode));
+    }
+
+    Assert::AreEqual(size_t{0}, pool.FreeNodeCount());
+  }
+
+  TEST_METHOD(YogaNodePool_KeepsAtMostMaxFreeNodes) {
+    YogaConfig config;
+    YogaNodePool pool;
+
+    std::vector<YogaNodePtr> nodes;
+    for (size_t i = 0; i < YogaNodePool::MaxFreeNodes + 1; ++i) {
+      nodes.push_back(pool.MakeNode(config.Config));
+    }
+
+    for (auto &node : nodes) {
+      pool.RecycleNode(std::move(node));
+    }
+
+    Assert::AreEqual(YogaNodePool::MaxFreeNodes, pool.FreeNodeCount());
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,740 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "BeastHttpResource.h"
+
+#include <CppRuntimeOptions.h>
+#include <boost/archive/iterators/base64_from_binary.hpp>
+#include <boost/archive/iterators/binary_from_base64.hpp>
+#include <boost/archive/iterators/transform_width.hpp>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/post.hpp>
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include "Utils.h"
+
+using namespace boost::archive::iterators;
+using namespace boost::asio;
+using namespace boost::beast;
+
+using boost::asio::ip::tcp;
+
+using folly::dynamic;
+using std::function;
+using std::make_shared;
+using std::shared_ptr;
+using std::size_t;
+using std::string;
+using std::weak_ptr;
+
+namespace Microsoft::React {
+
+namespace {
+
+constexpr size_t c_defaultMaxConnectionsPerHost = 6;
+constexpr size_t c_defaultMaxPipelinedRequests = 1;
+
+// Idle keep-alive connections are closed after this time.
+constexpr std::chrono::seconds c_idleTimeout{30};
+
+string EncodeBase64(const string &data) {
+  typedef base64_from_binary<transform_width<string::const_iterator, 6, 8>> encode_base64;
+
+  string result{encode_base64(data.cbegin()), encode_base64(data.cend())};
+  result.append((3 - data.size() % 3) % 3, '=');
+
+  return result;
+}
+
+string DecodeBase64(const string &base64String) {
+  typedef transform_width<binary_from_base64<string::const_iterator>, 8, 6> decode_base64;
+
+  // A correctly formed base64 string should have from 0 to three '=' trailing characters. Skip those.
+  size_t padSize = std::count(base64String.begin(), base64String.end(), '=');
+  return string(decode_base64(base64String.begin()), decode_base64(base64String.end() - padSize));
+}
+
+size_t GetRuntimeOptionSize(const string &name, size_t defaultValue) noexcept {
+  auto value = GetRuntimeOptionInt(name);
+  return value > 0 ? static_cast<size_t>(value) : defaultValue;
+}
+
+} // namespace
+
+namespace Beast {
+
+#pragma region HttpExchange
+
+string HttpExchange::HostKey() const {
+  return Host + ":" + Port;
+}
+
+bool HttpExchange::IsIdempotent() const noexcept {
+  switch (Request.method()) {
+    case http::verb::get:
+    case http::verb::head:
+    case http::verb::options:
+    case http::verb::put:
+    case http::verb::delete_:
+    case http::verb::trace:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+#pragma endregion HttpExchange
+
+#pragma region HttpConnection
+
+HttpConnection::HttpConnection(io_context &context, weak_ptr<HttpConnectionPool> pool, string host, string port)
+    : m_pool{std::move(pool)},
+      m_host{std::move(host)},
+      m_port{std::move(port)},
+      m_resolver{context},
+      m_stream{context},
+      m_idleTimer{context} {}
+
+const string &HttpConnection::Host() const noexcept {
+  return m_host;
+}
+
+const string &HttpConnection::Port() const noexcept {
+  return m_port;
+}
+
+size_t HttpConnection::RequestCount() const noexcept {
+  return m_writeQueue.size() + m_readQueue.size();
+}
+
+bool HttpConnection::IsConnected() const noexcept {
+  return m_connected;
+}
+
+bool HttpConnection::IsClosed() const noexcept {
+  return m_closed;
+}
+
+void HttpConnection::Connect() {
+  m_resolver.async_resolve(m_host, m_port, bind_front_handler(&HttpConnection::OnResolve, shared_from_this()));
+}
+
+void HttpConnection::Enqueue(shared_ptr<HttpExchange> exchange) {
+  exchange->Connection = weak_from_this();
+  m_writeQueue.push_back(std::move(exchange));
+
+  PerformWrite();
+}
+
+void HttpConnection::Remove(const shared_ptr<HttpExchange> &exchange) {
+  auto unsent = std::find(m_writeQueue.begin(), m_writeQueue.end(), exchange);
+  if (unsent != m_writeQueue.end()) {
+    // The request is being written unless it is at the front of the queue.
+    bool isWriting = m_writeInProgress && unsent == m_writeQueue.begin();
+    m_writeQueue.erase(unsent);
+    if (!isWriting) {
+      if (RequestCount() == 0)
+        ScheduleIdleClose();
+
+      return;
+    }
+  } else {
+    auto unanswered = std::find(m_readQueue.begin(), m_readQueue.end(), exchange);
+    if (unanswered == m_readQueue.end())
+      return;
+
+    m_readQueue.erase(unanswered);
+  }
+
+  // The response of the removed request would be read as the response of the next request.
+  Close(boost::asio::error::operation_aborted, /*canResend*/ true);
+}
+
+void HttpConnection::Close(error_code ec, bool canResend) {
+  if (m_closed)
+    return;
+
+  // The pool releases this connection.
+  auto self = shared_from_this();
+
+  m_closed = true;
+  m_idleTimer.cancel();
+  m_resolver.cancel();
+
+  error_code ignored;
+  m_stream.socket().shutdown(tcp::socket::shutdown_both, ignored);
+  m_stream.close();
+
+  auto unsent = std::move(m_writeQueue);
+  auto unanswered = std::move(m_readQueue);
+  m_writeQueue.clear();
+  m_readQueue.clear();
+
+  if (auto pool = m_pool.lock()) {
+    pool->OnConnectionClosed(*this, std::move(unsent), std::move(unanswered), ec, canResend);
+  }
+}
+
+void HttpConnection::PerformWrite() {
+  if (!m_connected || m_closed || m_writeInProgress || m_writeQueue.empty())
+    return;
+
+  m_writeInProgress = true;
+  m_idleTimer.cancel();
+
+  auto exchange = m_writeQueue.front();
+  http::async_write(
+      m_stream,
+      exchange->Request,
+      [self = shared_from_this(), exchange](error_code ec, size_t size) {
+        self->OnWrite(std::move(exchange), ec, size);
+      });
+}
+
+void HttpConnection::PerformRead() {
+  if (m_closed || m_readInProgress || m_readQueue.empty())
+    return;
+
+  m_readInProgress = true;
+
+  auto exchange = m_readQueue.front();
+  auto parser = make_shared<http::response_parser<http::string_body>>();
+  parser->body_limit(std::numeric_limits<std::uint64_t>::max());
+  if (exchange->Request.method() == http::verb::head) {
+    // Responses to HEAD requests have no body, even if they have a Content-Length header.
+    parser->skip(true);
+  }
+
+  http::async_read(
+      m_stream, m_buffer, *parser, [self = shared_from_this(), exchange, parser](error_code ec, size_t size) {
+        self->OnRead(std::move(exchange), std::move(parser), ec, size);
+      });
+}
+
+void HttpConnection::ScheduleIdleClose() {
+  m_idleTimer.expires_after(c_idleTimeout);
+  m_idleTimer.async_wait([weakSelf = weak_from_this()](error_code ec) {
+    if (ec)
+      return;
+
+    if (auto self = weakSelf.lock()) {
+      if (self->RequestCount() == 0)
+        self->Close({}, /*canResend*/ false);
+    }
+  });
+}
+
+#pragma region Async handlers
+
+void HttpConnection::OnResolve(error_code ec, tcp::resolver::results_type results) {
+  if (ec)
+    return Close(ec, /*canResend*/ false);
+
+  m_stream.async_connect(results, bind_front_handler(&HttpConnection::OnConnect, shared_from_this()));
+}
+
+void HttpConnection::OnConnect(error_code ec, tcp::resolver::results_type::endpoint_type /*endpoint*/) {
+  if (ec)
+    return Close(ec, /*canResend*/ false);
+
+  m_connected = true;
+  PerformWrite();
+}
+
+void HttpConnection::OnWrite(shared_ptr<HttpExchange> exchange, error_code ec, size_t /*size*/) {
+  m_writeInProgress = false;
+  if (m_closed)
+    return;
+
+  // Remove() does not dequeue the request being written without closing the connection.
+  m_writeQueue.pop_front();
+  m_readQueue.push_back(std::move(exchange));
+
+  if (ec) {
+    // A server may close a keep-alive connection while the request is written.
+    return Close(ec, /*canResend*/ m_responseCount > 0);
+  }
+
+  PerformRead();
+  PerformWrite();
+}
+
+void HttpConnection::OnRead(
+    shared_ptr<HttpExchange> exchange,
+    shared_ptr<http::response_parser<http::string_body>> parser,
+    error_code ec,
+    size_t /*size*/) {
+  m_readInProgress = false;
+  if (m_closed)
+    return;
+
+  if (ec) {
+    // A server may close a keep-alive connection before it reads the next request.
+    return Close(ec, /*canResend*/ m_responseCount > 0);
+  }
+
+  m_readQueue.pop_front();
+  ++m_responseCount;
+  exchange->Response = parser->release();
+
+  bool keepAlive = exchange->Response.keep_alive();
+  if (auto pool = m_pool.lock()) {
+    pool->OnResponse(std::move(exchange));
+  }
+
+  if (!keepAlive)
+    return Close(http::error::end_of_stream, /*canResend*/ true);
+
+  PerformRead();
+
+  if (auto pool = m_pool.lock()) {
+    pool->OnConnectionReady(*this);
+  }
+
+  if (RequestCount() == 0)
+    ScheduleIdleClose();
+}
+
+#pragma endregion Async handlers
+
+#pragma endregion HttpConnection
+
+#pragma region HttpConnectionPool
+
+HttpConnectionPool::HttpConnectionPool(
+    io_context &context,
+    size_t maxConnectionsPerHost,
+    size_t maxPipelinedRequests)
+    : m_context{context},
+      m_maxConnectionsPerHost{maxConnectionsPerHost},
+      m_maxPipelinedRequests{maxPipelinedRequests} {}
+
+void HttpConnectionPool::Submit(shared_ptr<HttpExchange> exchange) {
+  m_exchanges[exchange->RequestId] = exchange;
+  if (m_shutdown)
+    return Complete(std::move(exchange), boost::asio::error::operation_aborted);
+
+  if (exchange->Timeout.count() > 0) {
+    exchange->Timer.emplace(m_context);
+    exchange->Timer->expires_after(exchange->Timeout);
+    exchange->Timer->async_wait([weakSelf = weak_from_this(), requestId = exchange->RequestId](error_code ec) {
+      if (ec)
+        return;
+
+      if (auto self = weakSelf.lock())
+        self->Cancel(requestId, boost::asio::error::timed_out);
+    });
+  }
+
+  auto &host = m_hosts[exchange->HostKey()];
+  host.PendingRequests.push_back(std::move(exchange));
+  Dispatch(host);
+}
+
+void HttpConnectionPool::Dispatch(HostConnections &host) {
+  while (!host.PendingRequests.empty()) {
+    if (m_shutdown) {
+      auto exchange = std::move(host.PendingRequests.front());
+      host.PendingRequests.pop_front();
+      Complete(std::move(exchange), boost::asio::error::operation_aborted);
+      continue;
+    }
+
+    // Prefer an unused connection, then a new connection, then pipelining on the least busy connection.
+    shared_ptr<HttpConnection> connection;
+    for (auto &candidate : host.Connections) {
+      if (!candidate->IsClosed() && candidate->RequestCount() < m_maxPipelinedRequests &&
+          (!connection || candidate->RequestCount() < connection->RequestCount())) {
+        connection = candidate;
+      }
+    }
+
+    if ((!connection || connection->RequestCount() > 0) && host.Connections.size() < m_maxConnectionsPerHost) {
+      auto &front = host.PendingRequests.front();
+      connection = make_shared<HttpConnection>(m_context, weak_from_this(), front->Host, front->Port);
+      host.Connections.push_back(connection);
+      connection->Connect();
+    }
+
+    if (!connection)
+      break;
+
+    auto exchange = std::move(host.PendingRequests.front());
+    host.PendingRequests.pop_front();
+    connection->Enqueue(std::move(exchange));
+  }
+}
+
+void HttpConnectionPool::Complete(shared_ptr<HttpExchange> exchange, error_code ec) {
+  auto iter = m_exchanges.find(exchange->RequestId);
+  if (iter == m_exchanges.end() || iter->second != exchange)
+    return; // Completed already.
+
+  m_exchanges.erase(iter);
+  if (exchange->Timer)
+    exchange->Timer->cancel();
+
+  exchange->OnComplete(*exchange, ec);
+}
+
+void HttpConnectionPool::Cancel(int64_t requestId, error_code ec) {
+  auto iter = m_exchanges.find(requestId);
+  if (iter == m_exchanges.end())
+    return;
+
+  auto exchange = iter->second;
+  auto hostIter = m_hosts.find(exchange->HostKey());
+  if (hostIter != m_hosts.end()) {
+    auto &pending = hostIter->second.PendingRequests;
+    pending.erase(std::remove(pending.begin(), pending.end(), exchange), pending.end());
+  }
+
+  if (auto connection = exchange->Connection.lock()) {
+    connection->Remove(exchange);
+  }
+
+  Complete(std::move(exchange), ec);
+}
+
+void HttpConnectionPool::Shutdown() {
+  m_shutdown = true;
+
+  // Closing a connection modifies its host's connection list.
+  std::vector<shared_ptr<HttpConnection>> connections;
+  for (auto &host : m_hosts) {
+    connections.insert(connections.end(), host.second.Connections.begin(), host.second.Connections.end());
+  }
+  for (auto &connection : connections) {
+    connection->Close(boost::asio::error::operation_aborted, /*canResend*/ false);
+  }
+
+  while (!m_exchanges.empty()) {
+    Complete(m_exchanges.begin()->second, boost::asio::error::operation_aborted);
+  }
+  m_hosts.clear();
+}
+
+#pragma region HttpConnection callbacks
+
+void HttpConnectionPool::OnResponse(shared_ptr<HttpExchange> exchange) {
+  Complete(std::move(exchange), {});
+}
+
+void HttpConnectionPool::OnConnectionReady(HttpConnection &connection) {
+  auto hostIter = m_hosts.find(connection.Host() + ":" + connection.Port());
+  if (hostIter != m_hosts.end())
+    Dispatch(hostIter->second);
+}
+
+void HttpConnectionPool::OnConnectionClosed(
+    HttpConnection &connection,
+    std::deque<shared_ptr<HttpExchange>> &&unsent,
+    std::deque<shared_ptr<HttpExchange>> &&unanswered,
+    error_code ec,
+    bool canResend) {
+  if (!ec)
+    ec = http::error::end_of_stream;
+
+  // The server may have processed a request it did not answer, so only idempotent requests are sent again.
+  std::deque<shared_ptr<HttpExchange>> resend;
+  for (auto &exchange : unanswered) {
+    if (canResend && !m_shutdown && !exchange->Resent && exchange->IsIdempotent()) {
+      exchange->Resent = true;
+      resend.push_back(std::move(exchange));
+    } else {
+      Complete(std::move(exchange), ec);
+    }
+  }
+
+  // Requests that were never written fail only if the connection could not be established.
+  for (auto &exchange : unsent) {
+    if (connection.IsConnected() && !m_shutdown) {
+      resend.push_back(std::move(exchange));
+    } else {
+      Complete(std::move(exchange), ec);
+    }
+  }
+
+  auto hostIter = m_hosts.find(connection.Host() + ":" + connection.Port());
+  if (hostIter == m_hosts.end())
+    return;
+
+  auto &host = hostIter->second;
+  host.Connections.erase(
+      std::remove_if(
+          host.Connections.begin(),
+          host.Connections.end(),
+          [&connection](const shared_ptr<HttpConnection> &c) { return c.get() == &connection; }),
+      host.Connections.end());
+
+  // Resent requests keep their place ahead of the requests that were waiting for a connection.
+  host.PendingRequests.insert(host.PendingRequests.begin(), resend.begin(), resend.end());
+  Dispatch(host);
+
+  if (host.Connections.empty() && host.PendingRequests.empty())
+    m_hosts.erase(hostIter);
+}
+
+#pragma endregion HttpConnection callbacks
+
+#pragma endregion HttpConnectionPool
+
+#pragma region HttpContextThread
+
+namespace {
+
+std::mutex s_contextThreadMutex;
+weak_ptr<HttpContextThread> s_contextThread;
+
+// A context thread released on itself is joined here, since it cannot join itself.
+struct ExitedThread {
+  std::thread Thread;
+
+  ~ExitedThread() noexcept {
+    if (Thread.joinable())
+      Thread.join();
+  }
+} s_exitedThread;
+
+} // namespace
+
+/*static*/ shared_ptr<HttpContextThread> HttpContextThread::Get() noexcept {
+  std::thread exitedThread;
+  shared_ptr<HttpContextThread> result;
+  {
+    std::scoped_lock lock{s_contextThreadMutex};
+    exitedThread = std::move(s_exitedThread.Thread);
+    result = s_contextThread.lock();
+    if (!result) {
+      result = make_shared<HttpContextThread>();
+      s_contextThread = result;
+    }
+  }
+
+  if (exitedThread.joinable())
+    exitedThread.join();
+
+  return result;
+}
+
+HttpContextThread::HttpContextThread() noexcept
+    : m_context{make_shared<io_context>(1)}, m_workGuard{make_work_guard(*m_context)} {
+  // The thread owns a reference to the context, so the context outlives a run() call that releases this object.
+  m_thread = std::thread([context = m_context]() { context->run(); });
+}
+
+HttpContextThread::~HttpContextThread() noexcept {
+  // Run the handlers posted so far, such as the shutdown of the last connection pool, then exit.
+  m_workGuard.reset();
+  post(*m_context, [context = m_context]() { context->stop(); });
+
+  if (m_thread.get_id() == std::this_thread::get_id()) {
+    // A completion handler released the last resource. The thread exits after the handler returns.
+    std::scoped_lock lock{s_contextThreadMutex};
+    if (s_exitedThread.Thread.joinable())
+      s_exitedThread.Thread.join();
+
+    s_exitedThread.Thread = std::move(m_thread);
+  } else {
+    m_thread.join();
+  }
+}
+
+io_context &HttpContextThread::Context() noexcept {
+  return *m_context;
+}
+
+#pragma endregion HttpContextThread
+
+} // namespace Beast
+
+#pragma region BeastHttpResource
+
+BeastHttpResource::BeastHttpResource() noexcept
+    : m_contextThread{Beast::HttpContextThread::Get()},
+      m_context{m_contextThread->Context()},
+      m_pool{make_shared<Beast::HttpConnectionPool>(
+          m_context,
+          GetRuntimeOptionSize("Http.MaxConnectionsPerHost", c_defaultMaxConnectionsPerHost),
+          GetRuntimeOptionSize("Http.MaxPipelinedRequests", c_defaultMaxPipelinedRequests))} {}
+
+BeastHttpResource::~BeastHttpResource() noexcept {
+  // Fail the requests in progress. The context thread stops once no other resource uses it.
+  post(m_context, [pool = std::move(m_pool)]() { pool->Shutdown(); });
+}
+
+void BeastHttpResource::OnComplete(Beast::HttpExchange &exchange, error_code ec) {
+  auto requestId = exchange.RequestId;
+  if (ec) {
+    if (m_onError)
+      m_onError(requestId, ec.message(), ec == boost::asio::error::timed_out);
+
+    return;
+  }
+
+  auto &response = exchange.Response;
+  if (m_onResponse) {
+    Headers headers;
+    for (auto &field : response) {
+      headers.emplace(string{field.name_string()}, string{field.value()});
+    }
+
+    m_onResponse(requestId, {static_cast<int64_t>(response.result_int()), exchange.Url, std::move(headers)});
+  }
+
+  auto &body = response.body();
+  auto total = static_cast<int64_t>(body.size());
+  if (exchange.ResponseType == "text") {
+    if (exchange.IncrementalUpdates && m_onIncrementalData) {
+      // The response is read as a whole, so it is passed on as a single segment.
+      m_onIncrementalData(requestId, std::move(body), total, total);
+      if (m_onRequestSuccess)
+        m_onRequestSuccess(requestId);
+    } else if (m_onData) {
+      m_onData(requestId, std::move(body));
+    }
+  } else {
+    if (exchange.IncrementalUpdates && m_onDataProgress)
+      m_onDataProgress(requestId, total, total);
+
+    if (m_onData)
+      m_onData(requestId, EncodeBase64(body));
+  }
+}
+
+#pragma region IHttpResource
+
+void BeastHttpResource::SendRequest(
+    string &&method,
+    string &&url,
+    int64_t requestId,
+    Headers &&headers,
+    dynamic &&data,
+    string &&responseType,
+    bool useIncrementalUpdates,
+    int64_t timeout,
+    bool /*withCredentials*/,
+    function<void(int64_t)> &&callback) noexcept /*override*/ {
+  if (callback) {
+    callback(requestId);
+  }
+
+  try {
+    Url parsedUrl{string{url}};
+    if (parsedUrl.scheme != "http") {
+      if (m_onError)
+        m_onError(requestId, "Unsupported URL scheme: [" + parsedUrl.scheme + "]", false);
+
+      return;
+    }
+
+    auto exchange = make_shared<Beast::HttpExchange>();
+    exchange->RequestId = requestId;
+    exchange->Url = std::move(url);
+    exchange->Host = parsedUrl.host;
+    exchange->Port = parsedUrl.port.empty() ? "80" : parsedUrl.port;
+    exchange->Timeout = std::chrono::milliseconds{timeout};
+    exchange->ResponseType = std::move(responseType);
+    exchange->IncrementalUpdates = useIncrementalUpdates;
+
+    auto &request = exchange->Request;
+    request.version(11);
+    request.method_string(method);
+    request.target(parsedUrl.Target());
+    request.set(http::field::host, parsedUrl.port.empty() ? parsedUrl.host : parsedUrl.host + ":" + parsedUrl.port);
+
+    auto userAgent = GetRuntimeOptionString("Http.UserAgent");
+    if (!userAgent.empty())
+      request.set(http::field::user_agent, userAgent);
+
+    for (auto &header : headers) {
+      request.set(header.first, header.second);
+    }
+
+    if (data.isObject() && !data.empty()) {
+      if (auto stringData = data.get_ptr("string")) {
+        request.body() = stringData->getString();
+      } else if (auto base64Data = data.get_ptr("base64")) {
+        request.body() = DecodeBase64(base64Data->getString());
+      } else {
+        if (m_onError)
+          m_onError(requestId, "Unsupported request body", false);
+
+        return;
+      }
+    }
+    if (!request.body().empty() || request.method() == http::verb::post || request.method() == http::verb::put ||
+        request.method() == http::verb::patch) {
+      request.prepare_payload();
+    }
+
+    exchange->OnComplete = [weakSelf = weak_from_this()](Beast::HttpExchange &exchange, error_code ec) {
+      if (auto self = weakSelf.lock())
+        self->OnComplete(exchange, ec);
+    };
+
+    post(m_context, [pool = m_pool, exchange = std::move(exchange)]() { pool->Submit(exchange); });
+  } catch (const std::exception &e) {
+    if (m_onError)
+      m_onError(requestId, e.what(), false);
+  }
+}
+
+void BeastHttpResource::AbortRequest(int64_t requestId) noexcept /*override*/ {
+  post(m_context, [weakPool = weak_ptr<Beast::HttpConnectionPool>{m_pool}, requestId]() {
+    if (auto pool = weakPool.lock())
+      pool->Cancel(requestId, boost::asio::error::operation_aborted);
+  });
+}
+
+void BeastHttpResource::ClearCookies() noexcept /*override*/ {
+  // Cookies are not stored.
+}
+
+void BeastHttpResource::SetOnRequestSuccess(function<void(int64_t requestId)> &&handler) noexcept /*override*/ {
+  m_onRequestSuccess = std::move(handler);
+}
+
+void BeastHttpResource::SetOnResponse(function<void(int64_t requestId, Response &&response)> &&handler) noexcept
+/*override*/ {
+  m_onResponse = std::move(handler);
+}
+
+void BeastHttpResource::SetOnData(function<void(int64_t requestId, string &&responseData)> &&handler) noexcept
+/*override*/ {
+  m_onData = std::move(handler);
+}
+
+void BeastHttpResource::SetOnData(function<void(int64_t requestId, dynamic &&responseData)> &&handler) noexcept
+/*override*/ {
+  m_onDataDynamic = std::move(handler);
+}
+
+void BeastHttpResource::SetOnIncrementalData(
+    function<void(int64_t requestId, string &&responseData, int64_t progress, int64_t total)> &&handler) noexcept
+/*override*/ {
+  m_onIncrementalData = std::move(handler);
+}
+
+void BeastHttpResource::SetOnDataProgress(
+    function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept
+/*override*/ {
+  m_onDataProgress = std::move(handler);
+}
+
+void BeastHttpResource::SetOnError(
+    function<void(int64_t requestId, string &&errorMessage, bool isTimeout)> &&handler) noexcept
+/*override*/ {
+  m_onError = std::move(handler);
+}
+
+#pragma endregion IHttpResource
+
+#pragma endregion BeastHttpResource
+
+} // namespace Microsoft::React
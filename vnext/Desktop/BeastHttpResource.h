@@ -0,0 +1,306 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Networking/IHttpResource.h>
+
+// Boost Library
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/http.hpp>
+
+// Standard Library
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React {
+
+namespace Beast {
+
+class HttpConnection;
+class HttpConnectionPool;
+
+/// <summary>
+/// A request sent through <see cref="HttpConnectionPool" /> and its response.
+/// </summary>
+/// <remarks>
+/// Must be modified exclusively from the context thread after it is submitted.
+/// </remarks>
+struct HttpExchange {
+  int64_t RequestId;
+  std::string Url;
+  std::string Host;
+  std::string Port;
+  boost::beast::http::request<boost::beast::http::string_body> Request;
+  std::chrono::milliseconds Timeout{0};
+  std::string ResponseType;
+  bool IncrementalUpdates{false};
+
+  boost::beast::http::response<boost::beast::http::string_body> Response;
+  std::optional<boost::asio::steady_timer> Timer;
+  std::weak_ptr<HttpConnection> Connection;
+
+  /// <summary>
+  /// Set when the request was sent again after its connection closed before the response arrived.
+  /// Requests are resent only once, and only if their method is idempotent.
+  /// </summary>
+  bool Resent{false};
+
+  /// <summary>
+  /// Invoked once, with the error code of the request or with a complete <c>Response</c>.
+  /// </summary>
+  std::function<void(HttpExchange &exchange, boost::system::error_code ec)> OnComplete;
+
+  std::string HostKey() const;
+
+  /// <summary>
+  /// Whether the request may be sent again after it was written to a connection that closed without a response.
+  /// See https://www.rfc-editor.org/rfc/rfc9110#section-9.2.2
+  /// </summary>
+  bool IsIdempotent() const noexcept;
+};
+
+/// <summary>
+/// Keep-alive connection to a single host.
+/// Writes up to <c>maxPipelinedRequests</c> requests before their responses are read.
+/// </summary>
+class HttpConnection : public std::enable_shared_from_this<HttpConnection> {
+  std::weak_ptr<HttpConnectionPool> m_pool;
+  std::string m_host;
+  std::string m_port;
+
+  boost::asio::ip::tcp::resolver m_resolver;
+  boost::beast::tcp_stream m_stream;
+  boost::beast::flat_buffer m_buffer;
+  boost::asio::steady_timer m_idleTimer;
+
+  /// <summary>
+  /// Requests waiting to be written.
+  /// </summary>
+  std::deque<std::shared_ptr<HttpExchange>> m_writeQueue;
+
+  /// <summary>
+  /// Requests written to the connection, in the order their responses will arrive.
+  /// </summary>
+  std::deque<std::shared_ptr<HttpExchange>> m_readQueue;
+
+  bool m_connected{false};
+  bool m_closed{false};
+  bool m_writeInProgress{false};
+  bool m_readInProgress{false};
+  size_t m_responseCount{0};
+
+  void PerformWrite();
+  void PerformRead();
+  void ScheduleIdleClose();
+
+#pragma region Async handlers
+
+  void OnResolve(boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results);
+
+  void OnConnect(boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type::endpoint_type endpoint);
+
+  void OnWrite(std::shared_ptr<HttpExchange> exchange, boost::beast::error_code ec, std::size_t size);
+
+  void OnRead(
+      std::shared_ptr<HttpExchange> exchange,
+      std::shared_ptr<boost::beast::http::response_parser<boost::beast::http::string_body>> parser,
+      boost::beast::error_code ec,
+      std::size_t size);
+
+#pragma endregion Async handlers
+
+ public:
+  HttpConnection(
+      boost::asio::io_context &context,
+      std::weak_ptr<HttpConnectionPool> pool,
+      std::string host,
+      std::string port);
+
+  const std::string &Host() const noexcept;
+  const std::string &Port() const noexcept;
+
+  /// <summary>
+  /// Number of requests that were assigned to this connection and did not receive a response yet.
+  /// </summary>
+  size_t RequestCount() const noexcept;
+
+  bool IsConnected() const noexcept;
+
+  bool IsClosed() const noexcept;
+
+  void Connect();
+
+  void Enqueue(std::shared_ptr<HttpExchange> exchange);
+
+  /// <summary>
+  /// Removes a request that has not received its response.
+  /// If the request was written already, closes the connection, as responses are matched to requests by order.
+  /// </summary>
+  void Remove(const std::shared_ptr<HttpExchange> &exchange);
+
+  /// <summary>
+  /// Closes the socket and returns the unanswered requests to the pool.
+  /// </summary>
+  /// <param name="canResend">
+  /// Whether the requests that were written already may be sent again on a new connection.
+  /// </param>
+  void Close(boost::beast::error_code ec, bool canResend);
+};
+
+/// <summary>
+/// Keeps up to <c>maxConnectionsPerHost</c> keep-alive connections for each host.
+/// Requests exceeding the connection and pipelining limits wait in a per-host queue.
+/// </summary>
+/// <remarks>
+/// All members must be accessed from the context thread.
+/// </remarks>
+class HttpConnectionPool : public std::enable_shared_from_this<HttpConnectionPool> {
+  struct HostConnections {
+    std::vector<std::shared_ptr<HttpConnection>> Connections;
+    std::deque<std::shared_ptr<HttpExchange>> PendingRequests;
+  };
+
+  boost::asio::io_context &m_context;
+  size_t m_maxConnectionsPerHost;
+  size_t m_maxPipelinedRequests;
+  std::unordered_map<std::string, HostConnections> m_hosts;
+  std::unordered_map<int64_t, std::shared_ptr<HttpExchange>> m_exchanges;
+  bool m_shutdown{false};
+
+  void Dispatch(HostConnections &host);
+
+  void Complete(std::shared_ptr<HttpExchange> exchange, boost::beast::error_code ec);
+
+ public:
+  HttpConnectionPool(boost::asio::io_context &context, size_t maxConnectionsPerHost, size_t maxPipelinedRequests);
+
+  void Submit(std::shared_ptr<HttpExchange> exchange);
+
+  /// <summary>
+  /// Fails the request with the given error code, either <c>operation_aborted</c> or <c>timed_out</c>.
+  /// </summary>
+  void Cancel(int64_t requestId, boost::beast::error_code ec);
+
+  /// <summary>
+  /// Closes all connections and fails the requests in progress.
+  /// </summary>
+  void Shutdown();
+
+#pragma region HttpConnection callbacks
+
+  void OnResponse(std::shared_ptr<HttpExchange> exchange);
+
+  void OnConnectionReady(HttpConnection &connection);
+
+  void OnConnectionClosed(
+      HttpConnection &connection,
+      std::deque<std::shared_ptr<HttpExchange>> &&unsent,
+      std::deque<std::shared_ptr<HttpExchange>> &&unanswered,
+      boost::beast::error_code ec,
+      bool canResend);
+
+#pragma endregion HttpConnection callbacks
+};
+
+/// <summary>
+/// Runs the context shared by all <see cref="BeastHttpResource" /> instances on a background thread.
+/// </summary>
+/// <remarks>
+/// The thread is stopped when the last resource releases it.
+/// If that happens on the thread itself, it is joined by the next <c>Get</c> call or at exit.
+/// </remarks>
+class HttpContextThread {
+  std::shared_ptr<boost::asio::io_context> m_context;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_workGuard;
+  std::thread m_thread;
+
+ public:
+  /// <summary>
+  /// Returns the running context thread, or starts a new one if no resource holds it.
+  /// </summary>
+  static std::shared_ptr<HttpContextThread> Get() noexcept;
+
+  HttpContextThread() noexcept;
+
+  ~HttpContextThread() noexcept;
+
+  boost::asio::io_context &Context() noexcept;
+};
+
+} // namespace Beast
+
+/// <summary>
+/// Boost.Beast implementation of <see cref="IHttpResource" />.
+/// Requests for the same host share keep-alive connections.
+/// </summary>
+/// <remarks>
+/// Runtime options:
+/// "Http.MaxConnectionsPerHost" - connections to a host open at the same time (default 6).
+/// "Http.MaxPipelinedRequests"  - requests written to a connection before their responses arrive (default 1).
+/// Supports plain HTTP only. Redirects and origin policies are not applied.
+/// Connections of all resources are run by one shared <see cref="Beast::HttpContextThread" />.
+/// </remarks>
+class BeastHttpResource : public Networking::IHttpResource, public std::enable_shared_from_this<BeastHttpResource> {
+  std::shared_ptr<Beast::HttpContextThread> m_contextThread;
+  boost::asio::io_context &m_context;
+  std::shared_ptr<Beast::HttpConnectionPool> m_pool;
+
+  std::function<void(int64_t requestId)> m_onRequestSuccess;
+  std::function<void(int64_t requestId, Response &&response)> m_onResponse;
+  std::function<void(int64_t requestId, std::string &&responseData)> m_onData;
+  std::function<void(int64_t requestId, folly::dynamic &&responseData)> m_onDataDynamic;
+  std::function<void(int64_t requestId, std::string &&responseData, int64_t progress, int64_t total)>
+      m_onIncrementalData;
+  std::function<void(int64_t requestId, int64_t progress, int64_t total)> m_onDataProgress;
+  std::function<void(int64_t requestId, std::string &&errorMessage, bool isTimeout)> m_onError;
+
+  void OnComplete(Beast::HttpExchange &exchange, boost::beast::error_code ec);
+
+ public:
+  BeastHttpResource() noexcept;
+
+  ~BeastHttpResource() noexcept override;
+
+#pragma region IHttpResource
+
+  void SendRequest(
+      std::string &&method,
+      std::string &&url,
+      int64_t requestId,
+      Headers &&headers,
+      folly::dynamic &&data,
+      std::string &&responseType,
+      bool useIncrementalUpdates,
+      int64_t timeout,
+      bool withCredentials,
+      std::function<void(int64_t)> &&callback) noexcept override;
+  void AbortRequest(int64_t requestId) noexcept override;
+  void ClearCookies() noexcept override;
+
+  void SetOnRequestSuccess(std::function<void(int64_t requestId)> &&handler) noexcept override;
+  void SetOnResponse(std::function<void(int64_t requestId, Response &&response)> &&handler) noexcept override;
+  void SetOnData(std::function<void(int64_t requestId, std::string &&responseData)> &&handler) noexcept override;
+  void SetOnData(std::function<void(int64_t requestId, folly::dynamic &&responseData)> &&handler) noexcept override;
+  void SetOnIncrementalData(
+      std::function<void(int64_t requestId, std::string &&responseData, int64_t progress, int64_t total)>
+          &&handler) noexcept override;
+  void SetOnDataProgress(
+      std::function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept override;
+  void SetOnError(
+      std::function<void(int64_t requestId, std::string &&errorMessage, bool isTimeout)> &&handler) noexcept override;
+
+#pragma endregion IHttpResource
+};
+
+} // namespace Microsoft::React
@@ -21,50 +21,6 @@ using namespace folly;
 namespace facebook {
 namespace react {
 
-bool operator<(const Timer &leftTimer, const Timer &rightTimer) {
-  return rightTimer.DueTime < leftTimer.DueTime;
-}
-
-bool operator==(const Timer &leftTimer, const uint64_t id) {
-  return id == leftTimer.Id;
-}
-
-void TimerQueue::Push(Timer timer) {
-  m_timerVector.push_back(timer);
-  std::push_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Pop() {
-  std::pop_heap(m_timerVector.begin(), m_timerVector.end());
-  m_timerVector.pop_back();
-}
-
-Timer &TimerQueue::Front() {
-  return m_timerVector.front();
-}
-
-const Timer &TimerQueue::Front() const {
-  return m_timerVector.front();
-}
-
-bool TimerQueue::Remove(uint64_t id) {
-  // TODO: This is very inefficient, but doing this with a heap is inherently
-  // hard. If performance is not good
-  //	enough for the scenarios then a different structure is probably needed.
-  auto found = std::find(m_timerVector.begin(), m_timerVector.end(), id);
-  if (found != m_timerVector.end()) {
-    m_timerVector.erase(found);
-  } else {
-    return false;
-  }
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-  return true;
-}
-
-bool TimerQueue::IsEmpty() const {
-  return m_timerVector.empty();
-}
-
 /*static*/ void Timing::ThreadpoolTimerCallback(PTP_CALLBACK_INSTANCE, PVOID Parameter, PTP_TIMER) noexcept {
   static_cast<Timing *>(Parameter)->OnTimerRaised();
 }
@@ -93,8 +49,7 @@ void Timing::OnTimerRaised() noexcept {
         while (!strongThis->m_timerQueue.IsEmpty() && now_ms > strongThis->m_timerQueue.Front().DueTime - 10ms) {
           // Pop first timer from the queue and add it to list of timers ready
           // to fire
-          auto next = strongThis->m_timerQueue.Front();
-          strongThis->m_timerQueue.Pop();
+          auto next = strongThis->m_timerQueue.Pop();
 
           // VSO:1916882 potential overflow
           readyTimers.push_back(next.Id);
@@ -6,6 +6,7 @@
 #include <InstanceManager.h>
 #include <cxxreact/CxxModule.h>
 #include <cxxreact/MessageQueueThread.h>
+#include <Utils/IndexedTimerHeap.h>
 
 #include <chrono>
 #include <memory>
@@ -31,14 +32,8 @@ struct Timer {
   bool Repeat;
 };
 
-// operator for push_heap and pop_heap
-bool operator<(const Timer &leftTimer, const Timer &rightTimer);
-
-// operator for find
-bool operator==(const Timer &leftTimer, const uint64_t id);
-
-// This class is a implementation of max heap to store Timer objects.
-// The front timer has the smallest due time.
+// Timers ordered by due time, the front timer has the smallest due time.
+// Deleting a timer is O(log n).
 // Example:
 //           TimerQueue tq;
 //           tq.Push(Timer{1234, now()+100ms, 100ms, false});
@@ -46,20 +41,7 @@ bool operator==(const Timer &leftTimer, const uint64_t id);
 //           tq.Push(Timer{1236, now()+50ms, 50ms, false});
 //           tq.Pop(); //pops timer id: 1235
 //           printf("%u", tq.Front().Id); // print 1236
-class TimerQueue {
- public:
-  void Push(Timer timer);
-  void Pop();
-  Timer &Front();
-  const Timer &Front() const;
-  bool Remove(uint64_t id);
-  bool IsEmpty() const;
-
- private:
-  // This vector is maintained as a max heap, where the front Timer has the
-  // smallest due time.
-  std::vector<Timer> m_timerVector;
-};
+using TimerQueue = Microsoft::React::IndexedTimerHeap<Timer, &Timer::Id, &Timer::DueTime>;
 
 // Helper class which implements createTimer, deleteTimer and setSendIdleEvents
 // for actual TimingModule Example:
@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Utils/ImageCache.h>
+
+using namespace std::chrono_literals;
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// Stands in for the HttpClient: counts the downloads and returns an image of ImageSize bytes.
+struct FakeDownloader {
+  std::atomic<int> DownloadCount{0};
+  uint32_t ImageSize{16};
+  bool IsCacheable{true};
+  std::optional<std::chrono::steady_clock::time_point> ExpiresAt;
+
+  // Downloads complete when the event is set.
+  winrt::handle Completed{
+      CreateEvent(/*attributes*/ nullptr, /*manual reset*/ true, /*state*/ true, /*name*/ nullptr)};
+};
+
+winrt::Windows::Foundation::IAsyncAction FakeDownloadAsync(
+    std::shared_ptr<FakeDownloader> downloader,
+    std::shared_ptr<ImageCache::DownloadResult> result) {
+  ++downloader->DownloadCount;
+  co_await winrt::resume_on_signal(downloader->Completed.get());
+
+  winrt::Windows::Storage::Streams::Buffer buffer{downloader->ImageSize};
+  buffer.Length(downloader->ImageSize);
+  result->Buffer = buffer;
+  result->IsCacheable = downloader->IsCacheable;
+  result->ExpiresAt = downloader->ExpiresAt;
+}
+
+ImageCache::Downloader MakeDownloader(std::shared_ptr<FakeDownloader> const &downloader) {
+  return [downloader](ReactImageSource, std::shared_ptr<ImageCache::DownloadResult> result) {
+    return FakeDownloadAsync(downloader, std::move(result));
+  };
+}
+
+ReactImageSource MakeSource(std::string uri) {
+  ReactImageSource source;
+  source.uri = std::move(uri);
+  source.sourceType = ImageSourceType::Download;
+  return source;
+}
+
+winrt::Windows::Storage::Streams::IBuffer GetImage(ImageCache &cache, std::string uri) {
+  return cache.GetImageBufferAsync(MakeSource(std::move(uri))).get();
+}
+
+} // namespace
+
+TEST_CLASS (ImageCacheTest) {
+  TEST_METHOD(ConcurrentRequestsShareDownload) {
+    auto downloader = std::make_shared<FakeDownloader>();
+    ResetEvent(downloader->Completed.get());
+    ImageCache cache{MakeDownloader(downloader)};
+
+    auto first = cache.GetImageBufferAsync(MakeSource("https://example.com/a.png"));
+    auto second = cache.GetImageBufferAsync(MakeSource("https://example.com/a.png"));
+    TestCheckEqual(1, downloader->DownloadCount.load());
+
+    SetEvent(downloader->Completed.get());
+    auto buffer = first.get();
+    TestCheck(buffer != nullptr);
+    TestCheck(buffer == second.get());
+    TestCheckEqual(1u, cache.Stats().InFlightHits);
+
+    // Once the download completes, the image is served from the memory cache.
+    TestCheck(buffer == GetImage(cache, "https://example.com/a.png"));
+    TestCheckEqual(1, downloader->DownloadCount.load());
+    TestCheckEqual(1u, cache.Stats().MemoryHits);
+  }
+
+  TEST_METHOD(RequestsWithDifferentHeadersDownloadSeparately) {
+    auto downloader = std::make_shared<FakeDownloader>();
+    ImageCache cache{MakeDownloader(downloader)};
+
+    auto source = MakeSource("https://example.com/a.png");
+    cache.GetImageBufferAsync(source).get();
+    source.headers.push_back({"Authorization", "Bearer token"});
+    cache.GetImageBufferAsync(source).get();
+    cache.GetImageBufferAsync(source).get();
+
+    TestCheckEqual(2, downloader->DownloadCount.load());
+  }
+
+  TEST_METHOD(EvictsLeastRecentlyUsedAtMaxSize) {
+    auto downloader = std::make_shared<FakeDownloader>();
+    downloader->ImageSize = ImageCache::MaxCachedImageSize;
+    ImageCache cache{MakeDownloader(downloader)};
+
+    constexpr int imageCount = ImageCache::MaxMemoryCacheSize / ImageCache::MaxCachedImageSize;
+    for (int i = 0; i < imageCount; ++i) {
+      GetImage(cache, "https://example.com/" + std::to_string(i));
+    }
+
+    // All images fit in the cache, and the first one becomes the most recently used.
+    GetImage(cache, "https://example.com/0");
+    TestCheckEqual(imageCount, downloader->DownloadCount.load());
+
+    // The next image evicts the least recently used one.
+    GetImage(cache, "https://example.com/" + std::to_string(imageCount));
+    GetImage(cache, "https://example.com/0");
+    TestCheckEqual(imageCount + 1, downloader->DownloadCount.load());
+
+    GetImage(cache, "https://example.com/1");
+    TestCheckEqual(imageCount + 2, downloader->DownloadCount.load());
+  }
+
+  TEST_METHOD(DoesNotKeepUncacheableImages) {
+    auto downloader = std::make_shared<FakeDownloader>();
+    ImageCache cache{MakeDownloader(downloader)};
+
+    downloader->IsCacheable = false;
+    GetImage(cache, "https://example.com/no-store.png");
+    GetImage(cache, "https://example.com/no-store.png");
+    TestCheckEqual(2, downloader->DownloadCount.load());
+    TestCheckEqual(0u, cache.Stats().MemoryHits);
+  }
+
+  TEST_METHOD(ExpiredImagesAreDownloadedAgain) {
+    auto downloader = std::make_shared<FakeDownloader>();
+    ImageCache cache{MakeDownloader(downloader)};
+
+    downloader->ExpiresAt = std::chrono::steady_clock::now() - 1s;
+    GetImage(cache, "https://example.com/a.png");
+    GetImage(cache, "https://example.com/a.png");
+    TestCheckEqual(2, downloader->DownloadCount.load());
+
+    downloader->ExpiresAt = std::chrono::steady_clock::now() + 1h;
+    GetImage(cache, "https://example.com/b.png");
+    GetImage(cache, "https://example.com/b.png");
+    TestCheckEqual(3, downloader->DownloadCount.load());
+    TestCheckEqual(1u, cache.Stats().MemoryHits);
+  }
+
+  TEST_METHOD(NonGetRequestsAreNotCached) {
+    auto downloader = std::make_shared<FakeDownloader>();
+    ImageCache cache{MakeDownloader(downloader)};
+
+    auto source = MakeSource("https://example.com/a.png");
+    source.method = "POST";
+    cache.GetImageBufferAsync(source).get();
+    cache.GetImageBufferAsync(source).get();
+
+    TestCheckEqual(2, downloader->DownloadCount.load());
+    TestCheckEqual(2u, cache.Stats().Downloads);
+  }
+};
+
+} // namespace Microsoft::ReactNative
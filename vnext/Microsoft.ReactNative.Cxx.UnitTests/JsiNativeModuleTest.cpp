@@ -0,0 +1,263 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ReactModuleBuilderMock.h"
+
+#include <JSI/JsiNativeModule.h>
+#include <JSI/NodeApiJsiRuntime.h>
+#include <deque>
+#include "Point.h"
+
+#ifdef PERF_TESTS
+#include <chrono>
+#include <cstdio>
+#endif
+
+using namespace facebook::jsi;
+
+namespace ReactNativeTests {
+
+REACT_MODULE(JsiTestModule)
+struct JsiTestModule {
+  REACT_SYNC_METHOD(Add)
+  int Add(int x, int y) noexcept {
+    return x + y;
+  }
+
+  REACT_SYNC_METHOD(Int64ToDouble)
+  double Int64ToDouble(int64_t x) noexcept {
+    return static_cast<double>(x);
+  }
+
+  REACT_SYNC_METHOD(Join)
+  std::string Join(std::vector<std::string> const &items, std::optional<std::string> const &separator) noexcept {
+    std::string result;
+    for (auto const &item : items) {
+      if (!result.empty()) {
+        result += separator.value_or(",");
+      }
+
+      result += item;
+    }
+
+    return result;
+  }
+
+  REACT_SYNC_METHOD(MovePoint)
+  Point MovePoint(Point point, int dx, int dy) noexcept {
+    return Point{point.X + dx, point.Y + dy};
+  }
+
+  REACT_SYNC_METHOD(CountKeys)
+  int CountKeys(React::JSValueObject const &obj) noexcept {
+    return static_cast<int>(obj.size());
+  }
+
+  REACT_METHOD(Negate)
+  int Negate(int x) noexcept {
+    return -x;
+  }
+
+  REACT_METHOD(NegateCallback)
+  void NegateCallback(int x, std::function<void(int)> const &resolve) noexcept {
+    resolve(-x);
+  }
+
+  REACT_METHOD(CheckPositive)
+  void CheckPositive(
+      int x,
+      std::function<void(int)> const &onPositive,
+      std::function<void(int)> const &onNotPositive) noexcept {
+    if (x > 0) {
+      onPositive(x);
+    } else {
+      onNotPositive(x);
+    }
+  }
+
+  REACT_METHOD(DividePromise)
+  void DividePromise(int x, int y, React::ReactPromise<int> &&result) noexcept {
+    if (y == 0) {
+      result.Reject("Division by zero");
+    } else {
+      result.Resolve(x / y);
+    }
+  }
+
+  REACT_CONSTANT(Answer)
+  int const Answer = 42;
+};
+
+// CallInvoker that queues the tasks until the test runs them in the current thread.
+struct QueuedCallInvoker : facebook::react::CallInvoker {
+  void invokeAsync(std::function<void()> &&func) override {
+    m_tasks.push_back(std::move(func));
+  }
+
+  void invokeSync(std::function<void()> &&func) override {
+    func();
+  }
+
+  void RunTasks() {
+    while (!m_tasks.empty()) {
+      auto task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      task();
+    }
+  }
+
+ private:
+  std::deque<std::function<void()>> m_tasks;
+};
+
+TEST_CLASS (JsiNativeModuleTest) {
+  React::ReactModuleBuilderMock m_builderMock{};
+  std::shared_ptr<QueuedCallInvoker> m_jsInvoker{std::make_shared<QueuedCallInvoker>()};
+  std::shared_ptr<facebook::react::LongLivedObjectCollection> m_longLivedObjectCollection{
+      std::make_shared<facebook::react::LongLivedObjectCollection>()};
+  std::unique_ptr<Runtime> m_runtime;
+
+  JsiNativeModuleTest() {
+    napi_ext_env_settings settings{};
+    settings.this_size = sizeof(settings);
+    napi_env env{};
+    napi_ext_create_env(&settings, &env);
+    m_runtime = Microsoft::JSI::MakeNodeApiJsiRuntime(env);
+
+    React::IReactModuleBuilder moduleBuilder = winrt::make<React::ReactModuleBuilderImpl>(m_builderMock);
+    auto jsiModule = std::make_shared<React::JsiNativeModule<JsiTestModule>>(
+        moduleBuilder, m_jsInvoker, m_longLivedObjectCollection);
+    Runtime &rt = *m_runtime;
+    rt.global().setProperty(rt, "testModule", Object::createFromHostObject(rt, std::move(jsiModule)));
+  }
+
+  ~JsiNativeModuleTest() {
+    // The JSI values must be released before the runtime.
+    m_longLivedObjectCollection->clear();
+  }
+
+  Value Eval(std::string code) {
+    return m_runtime->evaluateJavaScript(std::make_shared<StringBuffer>(std::move(code)), "");
+  }
+
+  void RunTasks() {
+    m_jsInvoker->RunTasks();
+    m_runtime->drainMicrotasks();
+  }
+
+  TEST_METHOD(JsiNativeModule_SyncMethod) {
+    TestCheckEqual(8, Eval("testModule.Add(3, 5)").getNumber());
+    // Missing arguments keep their default values.
+    TestCheckEqual(3, Eval("testModule.Add(3)").getNumber());
+  }
+
+  TEST_METHOD(JsiNativeModule_SyncMethodInt64Range) {
+    TestCheckEqual(-9223372036854775808.0, Eval("testModule.Int64ToDouble(-9223372036854775808)").getNumber());
+    // Numbers out of the int64_t range are read as 0.
+    TestCheckEqual(0, Eval("testModule.Int64ToDouble(9223372036854775808)").getNumber());
+    TestCheckEqual(0, Eval("testModule.Int64ToDouble(NaN)").getNumber());
+  }
+
+  TEST_METHOD(JsiNativeModule_SyncMethodContainers) {
+    Runtime &rt = *m_runtime;
+    TestCheckEqual("a,b,c", Eval("testModule.Join(['a', 'b', 'c'])").getString(rt).utf8(rt));
+    TestCheckEqual("a-b", Eval("testModule.Join(['a', 'b'], '-')").getString(rt).utf8(rt));
+    TestCheckEqual(2, Eval("testModule.CountKeys({x: 1, y: {z: 'a'}})").getNumber());
+  }
+
+  TEST_METHOD(JsiNativeModule_SyncMethodStruct) {
+    // Structs are converted through JSValue.
+    Runtime &rt = *m_runtime;
+    Object point = Eval("testModule.MovePoint({X: 1, Y: 2}, 10, 20)").getObject(rt);
+    TestCheckEqual(11, point.getProperty(rt, "X").getNumber());
+    TestCheckEqual(22, point.getProperty(rt, "Y").getNumber());
+  }
+
+  TEST_METHOD(JsiNativeModule_MethodResult) {
+    // The result is passed asynchronously to the callback in the JS thread.
+    TestCheck(Eval("var r1; testModule.Negate(3, x => { r1 = x; }); r1").isUndefined());
+    RunTasks();
+    TestCheckEqual(-3, Eval("r1").getNumber());
+  }
+
+  TEST_METHOD(JsiNativeModule_MethodCallback) {
+    // The callback is called asynchronously in the JS thread.
+    TestCheck(Eval("var r2; testModule.NegateCallback(5, x => { r2 = x; }); r2").isUndefined());
+    RunTasks();
+    TestCheckEqual(-5, Eval("r2").getNumber());
+  }
+
+  TEST_METHOD(JsiNativeModule_MethodTwoCallbacks) {
+    // Both callbacks are released when one of them is called.
+    Eval("var r4, f4 = testModule.CheckPositive;");
+    size_t longLivedObjectCount = m_longLivedObjectCollection->size();
+    Eval("f4(-2, x => { r4 = 'positive'; }, x => { r4 = 'not positive'; });");
+    TestCheckEqual(longLivedObjectCount + 2, m_longLivedObjectCollection->size());
+    RunTasks();
+    Runtime &rt = *m_runtime;
+    TestCheckEqual("not positive", Eval("r4").getString(rt).utf8(rt));
+    TestCheckEqual(longLivedObjectCount, m_longLivedObjectCollection->size());
+  }
+
+  TEST_METHOD(JsiNativeModule_MethodIsCached) {
+    // The host function is created once per runtime.
+    TestCheck(Eval("testModule.Add === testModule.Add").getBool());
+    TestCheck(Eval("testModule.getConstants === testModule.getConstants").getBool());
+    TestCheck(Eval("testModule.Unknown === undefined").getBool());
+  }
+
+  TEST_METHOD(JsiNativeModule_MethodPromise) {
+    Runtime &rt = *m_runtime;
+    Eval(
+        "var r3, e3; "
+        "testModule.DividePromise(6, 3).then(x => { r3 = x; }); "
+        "testModule.DividePromise(6, 0).catch(e => { e3 = e; });");
+    RunTasks();
+    TestCheckEqual(2, Eval("r3").getNumber());
+    TestCheck(Eval("e3 instanceof Error").getBool());
+    TestCheckEqual("Division by zero", Eval("e3.message").getString(rt).utf8(rt));
+  }
+
+  TEST_METHOD(JsiNativeModule_Constants) {
+    TestCheckEqual(42, Eval("testModule.getConstants().Answer").getNumber());
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(JsiNativeModule_Perf) {
+    // Compare direct JSI marshalling with the IJSValueReader/IJSValueWriter path used by MakeModuleProvider.
+    // The reader path is simulated with JSValue tree reader and writer around the same module method.
+    constexpr int callCount = 1'000'000;
+    Runtime &rt = *m_runtime;
+
+    auto measure = [](char const *name, auto &&call) {
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < callCount; ++i) {
+        call(i);
+      }
+      auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      printf("%s: %.0f calls/s\n", name, callCount / duration);
+    };
+
+    Function add = rt.global().getPropertyAsObject(rt, "testModule").getPropertyAsFunction(rt, "Add");
+    measure("JsiNativeModule", [&](int i) { add.call(rt, i, 1); });
+
+    auto provider = React::MakeModuleProvider<JsiTestModule>();
+    React::IReactModuleBuilder moduleBuilder = winrt::make<React::ReactModuleBuilderImpl>(m_builderMock);
+    auto moduleObject = m_builderMock.CreateModule(provider, moduleBuilder);
+    measure("JSValue reader/writer", [&](int i) {
+      Value args[] = {Value{i}, Value{1}};
+      React::JSValueArray argArray;
+      for (auto const &arg : args) {
+        argArray.push_back(React::ToJSValue(rt, arg));
+      }
+
+      int result{};
+      m_builderMock.CallSync(L"Add", result, std::move(argArray[0]), std::move(argArray[1]));
+      Value resultValue = React::WriteJsiValue(rt, result);
+    });
+  }
+#endif
+};
+
+} // namespace ReactNativeTests
@@ -3,6 +3,7 @@
 
 #include "pch.h"
 #include "JsiApiContext.h"
+#include <ReactCommon/LongLivedObject.h>
 
 // Use __ImageBase to get current DLL handle.
 // http://blogs.msdn.com/oldnewthing/archive/2004/10/25/247180.aspx
@@ -10,6 +11,20 @@ extern "C" IMAGE_DOS_HEADER __ImageBase;
 
 namespace winrt::Microsoft::ReactNative {
 
+using LongLivedObjectCollectionValue = ReactNonAbiValue<std::shared_ptr<facebook::react::LongLivedObjectCollection>>;
+
+// The JSI runtime object and the values it holds must be local to our DLL.
+// We create property names based on the current DLL handle.
+static std::wstring GetDllLocalPropertyName(std::wstring_view prefix) noexcept {
+  HMODULE currentDllHanlde = reinterpret_cast<HMODULE>(&__ImageBase);
+  return std::wstring{prefix} + std::to_wstring(reinterpret_cast<uintptr_t>(currentDllHanlde));
+}
+
+static ReactPropertyId<LongLivedObjectCollectionValue> LongLivedObjectCollectionProperty() noexcept {
+  static const std::wstring name = GetDllLocalPropertyName(L"jsiLongLivedObjects_");
+  return ReactPropertyId<LongLivedObjectCollectionValue>{L"ReactNative.InstanceData", name.c_str()};
+}
+
 // Try to get JSI Runtime for the current JS dispatcher thread.
 // If it is not found, then create it based on context JSI runtime and store it in the context.Properties().
 // The function returns nullptr if the current context does not have JSI runtime.
@@ -32,15 +47,17 @@ facebook::jsi::Runtime *TryGetOrCreateContextRuntime(ReactContext const &context
     runtime = runtimeHolder.get();
 
     // We want to keep the JSI runtime while current instance is alive.
-    // The JSI runtime object must be local to our DLL.
-    // We create a property name based on the current DLL handle.
-    HMODULE currentDllHanlde = reinterpret_cast<HMODULE>(&__ImageBase);
-    std::wstring jsiRuntimeLocalName = L"jsiRuntime_" + std::to_wstring(reinterpret_cast<uintptr_t>(currentDllHanlde));
+    std::wstring jsiRuntimeLocalName = GetDllLocalPropertyName(L"jsiRuntime_");
     using ValueType = ReactNonAbiValue<std::unique_ptr<JsiAbiRuntime>>;
     ReactPropertyId<ValueType> jsiRuntimeProperty{L"ReactNative.InstanceData", jsiRuntimeLocalName.c_str()};
     ValueType runtimeValue{std::in_place, std::move(runtimeHolder)};
     context.Properties().Set(jsiRuntimeProperty, runtimeValue);
 
+    // JSI values that outlive a JS call are kept in the collection that is cleared together with the runtime.
+    LongLivedObjectCollectionValue longLivedObjectsValue{
+        std::in_place, std::make_shared<facebook::react::LongLivedObjectCollection>()};
+    context.Properties().Set(LongLivedObjectCollectionProperty(), longLivedObjectsValue);
+
     // We remove the JSI runtime from properties when React instance is destroyed.
     auto destroyInstanceNotificationId{
         ReactNotificationId<InstanceDestroyedEventArgs>{L"ReactNative.InstanceSettings", L"InstanceDestroyed"}};
@@ -49,6 +66,11 @@ facebook::jsi::Runtime *TryGetOrCreateContextRuntime(ReactContext const &context
         [context, jsiRuntimeProperty](
             winrt::Windows::Foundation::IInspectable const & /*sender*/,
             ReactNotificationArgs<InstanceDestroyedEventArgs> const &args) noexcept {
+          // Release the JSI values before the runtime they belong to.
+          if (auto longLivedObjects = context.Properties().Get(LongLivedObjectCollectionProperty())) {
+            longLivedObjects.Value()->clear();
+          }
+          context.Properties().Remove(LongLivedObjectCollectionProperty());
           context.Properties().Remove(jsiRuntimeProperty);
           args.Subscription().Unsubscribe(); // Unsubscribe after we handle the notification.
         });
@@ -57,6 +79,22 @@ facebook::jsi::Runtime *TryGetOrCreateContextRuntime(ReactContext const &context
   return runtime;
 }
 
+// Get the collection that keeps JSI values alive between JS calls for the runtime from TryGetOrCreateContextRuntime.
+// The collection is cleared before the JSI runtime is removed when the instance is unloaded.
+// The function returns nullptr if the current context does not have JSI runtime.
+std::shared_ptr<facebook::react::LongLivedObjectCollection> TryGetOrCreateContextLongLivedObjectCollection(
+    ReactContext const &context) noexcept {
+  if (!TryGetOrCreateContextRuntime(context)) {
+    return nullptr;
+  }
+
+  if (auto longLivedObjects = context.Properties().Get(LongLivedObjectCollectionProperty())) {
+    return longLivedObjects.Value();
+  }
+
+  return nullptr;
+}
+
 // Calls TryGetOrCreateContextRuntime to get JSI runtime.
 // It crashes when TryGetOrCreateContextRuntime returns null.
 // Note: deprecated in favor of TryGetOrCreateContextRuntime.
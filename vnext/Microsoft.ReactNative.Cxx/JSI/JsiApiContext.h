@@ -9,6 +9,10 @@
 #include "JsiAbiApi.h"
 #include "ReactPromise.h"
 
+namespace facebook::react {
+class LongLivedObjectCollection;
+} // namespace facebook::react
+
 namespace winrt::Microsoft::ReactNative {
 
 // Try to get JSI Runtime for the current JS dispatcher thread.
@@ -17,6 +21,12 @@ namespace winrt::Microsoft::ReactNative {
 // It makes sure that the JSI runtime holder is removed when the instance is unloaded.
 facebook::jsi::Runtime *TryGetOrCreateContextRuntime(ReactContext const &context) noexcept;
 
+// Get the collection that keeps JSI values alive between JS calls for the runtime from TryGetOrCreateContextRuntime.
+// The collection is cleared before the JSI runtime is removed when the instance is unloaded.
+// The function returns nullptr if the current context does not have JSI runtime.
+std::shared_ptr<facebook::react::LongLivedObjectCollection> TryGetOrCreateContextLongLivedObjectCollection(
+    ReactContext const &context) noexcept;
+
 // Calls TryGetOrCreateContextRuntime to get JSI runtime.
 // It crashes when TryGetOrCreateContextRuntime returns null.
 // Note: deprecated in favor of TryGetOrCreateContextRuntime.
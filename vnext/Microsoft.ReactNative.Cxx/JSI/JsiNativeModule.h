@@ -0,0 +1,566 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSI_JSINATIVEMODULE
+#define MICROSOFT_REACTNATIVE_JSI_JSINATIVEMODULE
+
+#include <unordered_map>
+#include "../NativeModules.h"
+#include "../TurboModuleProvider.h"
+#include "JsiValueConverter.h"
+#include "LongLivedJsiValue.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+//
+// JsiNativeModule exposes a REACT_MODULE struct to JavaScript as a JSI host object.
+//
+// It uses the same REACT_METHOD, REACT_SYNC_METHOD, and REACT_CONSTANT attributes as the modules
+// registered with MakeModuleProvider, but the method arguments are read from the JSI values directly into
+// the C++ parameter types, and the results are written back as JSI values.
+// It avoids the IJSValueReader and IJSValueWriter wrappers that are created for each TurboModule call,
+// and the folly::dynamic conversion for results reported from other threads.
+//
+// Callbacks and promises are always completed asynchronously in the JS thread using the CallInvoker.
+// The ReactPromise results are still passed through JSValue because ReactPromise writes them to IJSValueWriter.
+//
+
+// The state shared between JsiNativeModule methods and the callbacks they create.
+// The LongLivedObjectCollection is owned by the JSI runtime holder and it is cleared when the runtime is torn down.
+// We keep a weak reference to it because the values in the collection reference the context.
+struct JsiNativeModuleContext {
+  std::shared_ptr<facebook::react::CallInvoker> JSInvoker;
+  std::weak_ptr<facebook::react::LongLivedObjectCollection> LongLivedObjectCollection;
+
+  std::shared_ptr<facebook::react::LongLivedObjectCollection> GetLongLivedObjectCollection() const noexcept {
+    auto longLivedObjectCollection = LongLivedObjectCollection.lock();
+    VerifyElseCrashSz(longLivedObjectCollection, "JSI runtime is torn down");
+    return longLivedObjectCollection;
+  }
+};
+
+// Caches the functions that JsiNativeModule creates for a JSI runtime.
+// It is owned by the LongLivedObjectCollection used with the runtime, and it is released together
+// with the other long lived JSI values when the runtime is torn down.
+struct JsiNativeModuleMemberCache : LongLivedJsiRuntime {
+  static std::weak_ptr<JsiNativeModuleMemberCache> CreateWeak(
+      std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
+      facebook::jsi::Runtime &runtime) noexcept {
+    auto value =
+        std::shared_ptr<JsiNativeModuleMemberCache>(new JsiNativeModuleMemberCache(longLivedObjectCollection, runtime));
+    longLivedObjectCollection->add(value);
+    return value;
+  }
+
+  // Members created by JsiNativeModule::CreateMember, keyed by their names.
+  std::unordered_map<std::string, facebook::jsi::Value> Members;
+
+ protected:
+  using LongLivedJsiRuntime::LongLivedJsiRuntime;
+};
+
+// The JS functions passed as callbacks to one method call.
+// A method calls at most one of them, so all of them are released when any of them is called.
+struct JsiCallbackGroup {
+  std::vector<std::weak_ptr<LongLivedJsiFunction>> Callbacks;
+
+  void Release() noexcept {
+    for (auto const &weakCallback : Callbacks) {
+      if (auto callback = weakCallback.lock()) {
+        callback->allowRelease();
+      }
+    }
+  }
+};
+
+// ==== JsiMethodInfo ==========================================================
+
+template <class TMethod>
+struct JsiMethodInfo;
+
+// Instance method
+template <class TModule, class TResult, class... TArgs>
+struct JsiMethodInfo<TResult (TModule::*)(TArgs...) noexcept> {
+  using Signature = TResult(TArgs...) noexcept;
+  using MethodType = TResult (TModule::*)(TArgs...) noexcept;
+
+  template <class... TCallArgs>
+  static TResult Invoke(void *module, MethodType method, TCallArgs &&...args) noexcept {
+    return (static_cast<TModule *>(module)->*method)(std::forward<TCallArgs>(args)...);
+  }
+
+  static constexpr void ValidateArgs() noexcept {
+    (ValidateCoroutineArg<TResult, TArgs>(), ...);
+  }
+};
+
+// Static method
+template <class TResult, class... TArgs>
+struct JsiMethodInfo<TResult (*)(TArgs...) noexcept> {
+  using Signature = TResult(TArgs...) noexcept;
+  using MethodType = TResult (*)(TArgs...) noexcept;
+
+  template <class... TCallArgs>
+  static TResult Invoke(void * /*module*/, MethodType method, TCallArgs &&...args) noexcept {
+    return (*method)(std::forward<TCallArgs>(args)...);
+  }
+
+  static constexpr void ValidateArgs() noexcept {
+    (ValidateCoroutineArg<TResult, TArgs>(), ...);
+  }
+};
+
+// Copies a value that is passed to the JS thread. JSValue types can only be copied explicitly.
+template <class T>
+RemoveConstRef<T> CopyJsiCallArg(T const &value) noexcept {
+  if constexpr (std::is_copy_constructible_v<RemoveConstRef<T>>) {
+    return value;
+  } else {
+    return value.Copy();
+  }
+}
+
+// ==== JsiCallbackCreator =====================================================
+
+template <class T>
+struct JsiCallbackCreator;
+
+template <template <class> class TCallback, class... TArgs>
+struct JsiCallbackCreator<TCallback<void(TArgs...)>> {
+  static TCallback<void(TArgs...)> Create(
+      JsiNativeModuleContext const &context,
+      facebook::jsi::Runtime &runtime,
+      facebook::jsi::Value const &callback,
+      std::shared_ptr<JsiCallbackGroup> const &callbackGroup) {
+    auto weakCallback = LongLivedJsiFunction::CreateWeak(
+        context.GetLongLivedObjectCollection(), runtime, callback.getObject(runtime).getFunction(runtime));
+    callbackGroup->Callbacks.push_back(weakCallback);
+    return TCallback<void(TArgs...)>(
+        [jsInvoker = context.JSInvoker, weakCallback, callbackGroup](TArgs... args) noexcept {
+          auto argsCopy = std::make_shared<std::tuple<RemoveConstRef<TArgs>...>>(CopyJsiCallArg(args)...);
+          jsInvoker->invokeAsync([weakCallback, callbackGroup, argsCopy]() {
+            if (auto callback = weakCallback.lock()) {
+              facebook::jsi::Runtime &rt = callback->Runtime();
+              std::apply(
+                  [&callback, &rt](auto const &...values) { callback->Value().call(rt, WriteJsiValue(rt, values)...); },
+                  *argsCopy);
+            }
+
+            callbackGroup->Release();
+          });
+        });
+  }
+};
+
+#if defined(__cpp_noexcept_function_type) || (_HAS_NOEXCEPT_FUNCTION_TYPES == 1)
+template <template <class> class TCallback, class... TArgs>
+struct JsiCallbackCreator<TCallback<void(TArgs...) noexcept>> {
+  static TCallback<void(TArgs...)> Create(
+      JsiNativeModuleContext const &context,
+      facebook::jsi::Runtime &runtime,
+      facebook::jsi::Value const &callback,
+      std::shared_ptr<JsiCallbackGroup> const &callbackGroup) {
+    return JsiCallbackCreator<TCallback<void(TArgs...)>>::Create(context, runtime, callback, callbackGroup);
+  }
+};
+#endif
+
+// ==== JsiPromiseCreator ======================================================
+
+template <class T>
+struct JsiPromiseCreator;
+
+template <class T>
+struct JsiPromiseCreator<ReactPromise<T>> {
+  // Creates a JavaScript Promise and the ReactPromise that completes it.
+  static ReactPromise<T> Create(
+      JsiNativeModuleContext const &context,
+      facebook::jsi::Runtime &runtime,
+      /*out*/ facebook::jsi::Value &jsPromise) {
+    std::weak_ptr<LongLivedJsiFunction> weakResolve;
+    std::weak_ptr<LongLivedJsiFunction> weakReject;
+    auto executor = facebook::jsi::Function::createFromHostFunction(
+        runtime,
+        facebook::jsi::PropNameID::forAscii(runtime, "executor"),
+        2,
+        [&context, &weakResolve, &weakReject](
+            facebook::jsi::Runtime &rt,
+            facebook::jsi::Value const & /*thisVal*/,
+            facebook::jsi::Value const *args,
+            size_t argCount) {
+          VerifyElseCrash(argCount == 2);
+          auto longLivedObjectCollection = context.GetLongLivedObjectCollection();
+          weakResolve =
+              LongLivedJsiFunction::CreateWeak(longLivedObjectCollection, rt, args[0].getObject(rt).getFunction(rt));
+          weakReject =
+              LongLivedJsiFunction::CreateWeak(longLivedObjectCollection, rt, args[1].getObject(rt).getFunction(rt));
+          return facebook::jsi::Value::undefined();
+        });
+    // The Promise constructor calls the executor synchronously.
+    jsPromise = runtime.global().getPropertyAsFunction(runtime, "Promise").callAsConstructor(runtime, executor);
+
+    auto reject = [jsInvoker = context.JSInvoker, weakResolve, weakReject](ReactError const &error) noexcept {
+      auto errorCopy = std::make_shared<ReactError>(ReactError{error.Code, error.Message, error.UserInfo.Copy()});
+      jsInvoker->invokeAsync([weakResolve, weakReject, errorCopy]() {
+        if (auto reject = weakReject.lock()) {
+          facebook::jsi::Runtime &rt = reject->Runtime();
+          // Create the Error object the same way as TurboModules do on Android and iOS.
+          facebook::jsi::Object jsError = rt.global()
+                                              .getPropertyAsFunction(rt, "Error")
+                                              .callAsConstructor(rt, WriteJsiValue(rt, errorCopy->Message))
+                                              .getObject(rt);
+          jsError.setProperty(rt, "code", WriteJsiValue(rt, errorCopy->Code));
+          if (!errorCopy->UserInfo.empty()) {
+            jsError.setProperty(rt, "userInfo", ToJsiValue(rt, errorCopy->UserInfo));
+          }
+
+          reject->Value().call(rt, std::move(jsError));
+        }
+
+        Release(weakResolve, weakReject);
+      });
+    };
+
+    if constexpr (std::is_void_v<T>) {
+      return ReactPromise<T>(
+          [jsInvoker = context.JSInvoker, weakResolve, weakReject]() noexcept {
+            jsInvoker->invokeAsync([weakResolve, weakReject]() {
+              if (auto resolve = weakResolve.lock()) {
+                resolve->Value().call(resolve->Runtime());
+              }
+
+              Release(weakResolve, weakReject);
+            });
+          },
+          std::move(reject));
+    } else {
+      return ReactPromise<T>(
+          [jsInvoker = context.JSInvoker, weakResolve, weakReject](T const &value) noexcept {
+            auto valueCopy = std::make_shared<T>(CopyJsiCallArg(value));
+            jsInvoker->invokeAsync([weakResolve, weakReject, valueCopy]() {
+              if (auto resolve = weakResolve.lock()) {
+                facebook::jsi::Runtime &rt = resolve->Runtime();
+                resolve->Value().call(rt, WriteJsiValue(rt, *valueCopy));
+              }
+
+              Release(weakResolve, weakReject);
+            });
+          },
+          std::move(reject));
+    }
+  }
+
+ private:
+  static void Release(
+      std::weak_ptr<LongLivedJsiFunction> const &weakResolve,
+      std::weak_ptr<LongLivedJsiFunction> const &weakReject) noexcept {
+    if (auto resolve = weakResolve.lock()) {
+      resolve->allowRelease();
+    }
+
+    if (auto reject = weakReject.lock()) {
+      reject->allowRelease();
+    }
+  }
+};
+
+// ==== JsiModuleBuilder =======================================================
+
+// Visits REACT_MODULE members to create JSI host functions for methods.
+// Constants are collected into constant providers, and the other members are registered by ReactModuleBuilder.
+template <class TModule>
+struct JsiModuleBuilder {
+  JsiModuleBuilder(
+      TModule *module,
+      IReactModuleBuilder const &moduleBuilder,
+      std::shared_ptr<JsiNativeModuleContext> const &context) noexcept
+      : m_module{module}, m_reactModuleBuilder{module, moduleBuilder}, m_context{context} {}
+
+  template <int I>
+  void RegisterModule(std::wstring_view moduleName, std::wstring_view eventEmitterName, ReactAttributeId<I>) noexcept {
+    m_reactModuleBuilder.RegisterModuleName(moduleName, eventEmitterName);
+    ReactMemberInfoIterator<TModule>{}.template ForEachMember<I + 1>(*this);
+  }
+
+  void CompleteRegistration() noexcept {
+    m_reactModuleBuilder.CompleteRegistration();
+  }
+
+  template <class TMember, class TAttribute, int I>
+  void Visit(
+      [[maybe_unused]] TMember member,
+      [[maybe_unused]] ReactAttributeId<I> attributeId,
+      [[maybe_unused]] TAttribute attributeInfo) noexcept {
+    if constexpr (std::is_same_v<TAttribute, ReactAsyncMethodAttribute>) {
+      RegisterMethod(member, attributeInfo.JSMemberName);
+    } else if constexpr (std::is_same_v<TAttribute, ReactSyncMethodAttribute>) {
+      RegisterSyncMethod(member, attributeInfo.JSMemberName);
+    } else if constexpr (
+        std::is_same_v<TAttribute, ReactConstantMethodAttribute> ||
+        std::is_same_v<TAttribute, ReactConstantStrongTypedMethodAttribute>) {
+      m_constantProviders.push_back(ModuleConstantInfo<TMember>::GetConstantProvider(m_module, member));
+    } else if constexpr (std::is_same_v<TAttribute, ReactConstantFieldAttribute>) {
+      m_constantProviders.push_back(
+          ModuleConstFieldInfo<TMember>::GetConstantProvider(m_module, attributeInfo.JSMemberName, member));
+    } else {
+      m_reactModuleBuilder.Visit(member, attributeId, attributeInfo);
+    }
+  }
+
+  std::unordered_map<std::string, facebook::jsi::HostFunctionType> &Methods() noexcept {
+    return m_methods;
+  }
+
+  std::vector<ConstantProviderDelegate> &ConstantProviders() noexcept {
+    return m_constantProviders;
+  }
+
+ private:
+  template <class TMethod>
+  void RegisterMethod(TMethod method, std::wstring_view name) noexcept {
+    using MethodInfo = ModuleMethodInfoBase<typename JsiMethodInfo<TMethod>::Signature>;
+    JsiMethodInfo<TMethod>::ValidateArgs();
+    m_methods[winrt::to_string(name)] = GetMethod(
+        method,
+        std::make_index_sequence<MethodInfo::InputArgCount>{},
+        std::make_index_sequence<MethodInfo::CallbackCount>{},
+        std::make_index_sequence<MethodInfo::PromiseCount>{});
+  }
+
+  template <class TMethod, size_t... ArgIndex, size_t... CallbackIndex, size_t... PromiseIndex>
+  facebook::jsi::HostFunctionType GetMethod(
+      TMethod method,
+      std::index_sequence<ArgIndex...>,
+      std::index_sequence<CallbackIndex...>,
+      std::index_sequence<PromiseIndex...>) noexcept {
+    return [module = m_module, method, context = m_context](
+               facebook::jsi::Runtime &rt,
+               facebook::jsi::Value const & /*thisVal*/,
+               facebook::jsi::Value const *args,
+               size_t argCount) {
+      using MethodInfo = ModuleMethodInfoBase<typename JsiMethodInfo<TMethod>::Signature>;
+      if constexpr (!MethodInfo::IsVoidResult) {
+        // The result is passed to the callback that follows the input arguments.
+        VerifyElseCrash(argCount > 0);
+        typename MethodInfo::InputArgTuple inputArgs{};
+        ReadJsiArgs(rt, args, argCount - 1, std::get<ArgIndex>(inputArgs)...);
+        auto weakCallback = LongLivedJsiFunction::CreateWeak(
+            context->GetLongLivedObjectCollection(), rt, args[argCount - 1].getObject(rt).getFunction(rt));
+        auto result = JsiMethodInfo<TMethod>::Invoke(module, method, std::get<ArgIndex>(std::move(inputArgs))...);
+        // Like the callbacks, the result is reported asynchronously in the JS thread.
+        auto resultCopy = std::make_shared<decltype(result)>(std::move(result));
+        context->JSInvoker->invokeAsync([weakCallback, resultCopy]() {
+          if (auto callback = weakCallback.lock()) {
+            facebook::jsi::Runtime &callbackRuntime = callback->Runtime();
+            callback->Value().call(callbackRuntime, WriteJsiValue(callbackRuntime, *resultCopy));
+            callback->allowRelease();
+          }
+        });
+        return facebook::jsi::Value::undefined();
+      } else if constexpr (MethodInfo::PromiseCount == 1) {
+        typename MethodInfo::InputArgTuple inputArgs{};
+        ReadJsiArgs(rt, args, argCount, std::get<ArgIndex>(inputArgs)...);
+        facebook::jsi::Value jsPromise;
+        auto promises = std::tuple{
+            JsiPromiseCreator<std::tuple_element_t<PromiseIndex, typename MethodInfo::OutputPromiseTuple>>::Create(
+                *context, rt, /*out*/ jsPromise)...};
+        JsiMethodInfo<TMethod>::Invoke(
+            module,
+            method,
+            std::get<ArgIndex>(std::move(inputArgs))...,
+            std::get<PromiseIndex>(std::move(promises))...);
+        return jsPromise;
+      } else {
+        // Callbacks are the last arguments.
+        VerifyElseCrash(argCount >= MethodInfo::CallbackCount);
+        size_t inputArgCount = argCount - MethodInfo::CallbackCount;
+        typename MethodInfo::InputArgTuple inputArgs{};
+        ReadJsiArgs(rt, args, inputArgCount, std::get<ArgIndex>(inputArgs)...);
+        auto callbackGroup = std::make_shared<JsiCallbackGroup>();
+        auto callbacks = std::tuple{
+            JsiCallbackCreator<std::tuple_element_t<CallbackIndex, typename MethodInfo::OutputCallbackTuple>>::Create(
+                *context, rt, args[inputArgCount + CallbackIndex], callbackGroup)...};
+        JsiMethodInfo<TMethod>::Invoke(
+            module,
+            method,
+            std::get<ArgIndex>(std::move(inputArgs))...,
+            std::get<CallbackIndex>(std::move(callbacks))...);
+        return facebook::jsi::Value::undefined();
+      }
+    };
+  }
+
+  template <class TMethod>
+  void RegisterSyncMethod(TMethod method, std::wstring_view name) noexcept {
+    using MethodInfo = ModuleSyncMethodInfoBase<typename JsiMethodInfo<TMethod>::Signature>;
+    m_methods[winrt::to_string(name)] =
+        GetSyncMethod(method, std::make_index_sequence<std::tuple_size_v<typename MethodInfo::ArgTuple>>{});
+  }
+
+  template <class TMethod, size_t... ArgIndex>
+  facebook::jsi::HostFunctionType GetSyncMethod(TMethod method, std::index_sequence<ArgIndex...>) noexcept {
+    return [module = m_module, method](
+               facebook::jsi::Runtime &rt,
+               facebook::jsi::Value const & /*thisVal*/,
+               facebook::jsi::Value const *args,
+               size_t argCount) {
+      typename ModuleSyncMethodInfoBase<typename JsiMethodInfo<TMethod>::Signature>::ArgTuple typedArgs{};
+      ReadJsiArgs(rt, args, argCount, std::get<ArgIndex>(typedArgs)...);
+      auto result = JsiMethodInfo<TMethod>::Invoke(module, method, std::get<ArgIndex>(std::move(typedArgs))...);
+      return WriteJsiValue(rt, result);
+    };
+  }
+
+ private:
+  void *m_module;
+  ReactModuleBuilder<TModule> m_reactModuleBuilder;
+  std::shared_ptr<JsiNativeModuleContext> m_context;
+  std::unordered_map<std::string, facebook::jsi::HostFunctionType> m_methods;
+  std::vector<ConstantProviderDelegate> m_constantProviders;
+};
+
+// ==== JsiNativeModule ========================================================
+
+template <class TModule>
+struct JsiNativeModule : facebook::jsi::HostObject {
+  JsiNativeModule(
+      IReactModuleBuilder const &moduleBuilder,
+      std::shared_ptr<facebook::react::CallInvoker> jsInvoker,
+      std::weak_ptr<facebook::react::LongLivedObjectCollection> longLivedObjectCollection) noexcept {
+    auto [moduleWrapper, module] = ReactModuleTraits<TModule>::Factory();
+    m_moduleWrapper = std::move(moduleWrapper);
+    m_context->JSInvoker = std::move(jsInvoker);
+    m_context->LongLivedObjectCollection = std::move(longLivedObjectCollection);
+
+    JsiModuleBuilder<TModule> builder{module, moduleBuilder, m_context};
+    GetReactModuleInfo(module, builder);
+    builder.CompleteRegistration();
+    m_methods = std::move(builder.Methods());
+    m_constantProviders = std::move(builder.ConstantProviders());
+  }
+
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, facebook::jsi::PropNameID const &name) override {
+    std::string key = name.utf8(runtime);
+    auto memberCache = GetMemberCache(runtime);
+    if (!memberCache) {
+      return CreateMember(runtime, name, key);
+    }
+
+    auto it = memberCache->Members.find(key);
+    if (it == memberCache->Members.end()) {
+      facebook::jsi::Value member = CreateMember(runtime, name, key);
+      if (member.isUndefined()) {
+        // Do not cache unknown names: JS code may probe for any name.
+        return member;
+      }
+
+      it = memberCache->Members.emplace(std::move(key), std::move(member)).first;
+    }
+
+    return facebook::jsi::Value(runtime, it->second);
+  }
+
+  std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime &runtime) override {
+    std::vector<facebook::jsi::PropNameID> propertyNames;
+    propertyNames.reserve(m_methods.size() + (m_constantProviders.empty() ? 0 : 1));
+    for (auto const &method : m_methods) {
+      propertyNames.push_back(facebook::jsi::PropNameID::forUtf8(runtime, method.first));
+    }
+
+    if (!m_constantProviders.empty()) {
+      propertyNames.push_back(facebook::jsi::PropNameID::forAscii(runtime, "getConstants"));
+    }
+
+    return propertyNames;
+  }
+
+ private:
+  // Returns the member cache for the runtime, or nullptr if members cannot be cached.
+  // A new cache is created if the module is accessed from a different runtime, or if the previous
+  // cache was released with the LongLivedObjectCollection of a torn down runtime.
+  std::shared_ptr<JsiNativeModuleMemberCache> GetMemberCache(facebook::jsi::Runtime &runtime) noexcept {
+    if (m_memberCacheRuntime == &runtime) {
+      if (auto memberCache = m_memberCache.lock()) {
+        return memberCache;
+      }
+    }
+
+    auto longLivedObjectCollection = m_context->LongLivedObjectCollection.lock();
+    if (!longLivedObjectCollection) {
+      return nullptr;
+    }
+
+    auto memberCache = JsiNativeModuleMemberCache::CreateWeak(longLivedObjectCollection, runtime).lock();
+    m_memberCache = memberCache;
+    m_memberCacheRuntime = &runtime;
+    return memberCache;
+  }
+
+  facebook::jsi::Value
+  CreateMember(facebook::jsi::Runtime &runtime, facebook::jsi::PropNameID const &name, std::string const &key) {
+    auto it = m_methods.find(key);
+    if (it != m_methods.end()) {
+      return facebook::jsi::Function::createFromHostFunction(runtime, name, 0, it->second);
+    }
+
+    if (key == "getConstants" && !m_constantProviders.empty()) {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [constantProviders = m_constantProviders](
+              facebook::jsi::Runtime &rt,
+              facebook::jsi::Value const & /*thisVal*/,
+              facebook::jsi::Value const * /*args*/,
+              size_t /*argCount*/) {
+            IJSValueWriter writer = MakeJSValueTreeWriter();
+            writer.WriteObjectBegin();
+            for (auto const &constantProvider : constantProviders) {
+              constantProvider(writer);
+            }
+            writer.WriteObjectEnd();
+            return ToJsiValue(rt, TakeJSValue(writer));
+          });
+    }
+
+    return facebook::jsi::Value::undefined();
+  }
+
+ private:
+  // The ABI-safe wrapper owns the module instance.
+  winrt::Windows::Foundation::IInspectable m_moduleWrapper;
+  std::shared_ptr<JsiNativeModuleContext> m_context{std::make_shared<JsiNativeModuleContext>()};
+  std::unordered_map<std::string, facebook::jsi::HostFunctionType> m_methods;
+  std::vector<ConstantProviderDelegate> m_constantProviders;
+  std::weak_ptr<JsiNativeModuleMemberCache> m_memberCache;
+  facebook::jsi::Runtime *m_memberCacheRuntime{nullptr};
+};
+
+// Registers a REACT_MODULE struct as a TurboModule that is called through JsiNativeModule.
+template <class TModule>
+void AddJsiModuleProvider(IReactPackageBuilder const &packageBuilder, std::wstring_view moduleName) {
+  using TModuleSpec = typename ReactModuleSpecOrVoid<TModule>::Type;
+  if constexpr (!std::is_same_v<void, TModuleSpec>) {
+    TModuleSpec::template ValidateModule<TModule>();
+  }
+
+  packageBuilder.AddTurboModule(
+      moduleName, [](IReactModuleBuilder const &moduleBuilder) noexcept -> winrt::Windows::Foundation::IInspectable {
+        IJsiHostObject abiTurboModule{nullptr};
+        // We expect the initializer to be called immediately for TurboModules
+        moduleBuilder.AddInitializer([&abiTurboModule, moduleBuilder](IReactContext const &context) mutable {
+          // Ensure the JSI runtime is created. JSI values are kept in the collection that is cleared with the runtime.
+          auto longLivedObjectCollection = TryGetOrCreateContextLongLivedObjectCollection(ReactContext{context});
+          auto callInvoker = MakeAbiCallInvoker(context.JSDispatcher());
+          auto jsiModule = std::make_shared<JsiNativeModule<TModule>>(
+              moduleBuilder, std::move(callInvoker), std::move(longLivedObjectCollection));
+          abiTurboModule = winrt::make<JsiHostObjectWrapper>(std::move(jsiModule));
+        });
+        return abiTurboModule.as<winrt::Windows::Foundation::IInspectable>();
+      });
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSI_JSINATIVEMODULE
@@ -0,0 +1,406 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSI_JSIVALUECONVERTER
+#define MICROSOFT_REACTNATIVE_JSI_JSIVALUECONVERTER
+
+#include <jsi/jsi.h>
+#include <limits>
+#include "../JSValue.h"
+#include "../JSValueReader.h"
+#include "../JSValueWriter.h"
+
+//
+// Functions below convert JSI values directly to C++ types and back.
+// They are used by JsiNativeModule to call REACT_METHOD and REACT_SYNC_METHOD methods without
+// the IJSValueReader and IJSValueWriter interfaces.
+//
+// Strings, numbers, enums, std::optional, std::vector, and std::map are converted in place.
+// Other types, such as REACT_STRUCT structs or types with custom ReadValue and WriteValue functions,
+// are converted through an intermediate JSValue.
+//
+
+namespace winrt::Microsoft::ReactNative {
+
+JSValue ToJSValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue);
+facebook::jsi::Value ToJsiValue(facebook::jsi::Runtime &runtime, JSValue const &value);
+facebook::jsi::Value ToJsiValue(facebook::jsi::Runtime &runtime, JSValueObject const &value);
+facebook::jsi::Value ToJsiValue(facebook::jsi::Runtime &runtime, JSValueArray const &value);
+
+void ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ std::string &value);
+void ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ std::wstring &value);
+void ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ JSValue &value);
+void ReadJsiValue(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const &jsiValue,
+    /*out*/ JSValueObject &value);
+void ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ JSValueArray &value);
+template <class T>
+void ReadJsiValue(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const &jsiValue,
+    /*out*/ std::optional<T> &value);
+template <class T, class TAlloc>
+void ReadJsiValue(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const &jsiValue,
+    /*out*/ std::vector<T, TAlloc> &value);
+template <class T, class TCompare, class TAlloc>
+void ReadJsiValue(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const &jsiValue,
+    /*out*/ std::map<std::string, T, TCompare, TAlloc> &value);
+template <class T, class TCompare, class TAlloc>
+void ReadJsiValue(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const &jsiValue,
+    /*out*/ std::map<std::wstring, T, TCompare, TAlloc> &value);
+template <class T>
+void ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ T &value);
+
+template <class... TArgs>
+void ReadJsiArgs(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const *args,
+    size_t argCount,
+    /*out*/ TArgs &...values);
+
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::string const &value);
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::string_view value);
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, char const *value);
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::wstring_view value);
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, wchar_t const *value);
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, JSValue const &value);
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, JSValueObject const &value);
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, JSValueArray const &value);
+template <class T>
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::optional<T> const &value);
+template <class T, class TAlloc>
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::vector<T, TAlloc> const &value);
+template <class T, class TCompare, class TAlloc>
+facebook::jsi::Value WriteJsiValue(
+    facebook::jsi::Runtime &runtime,
+    std::map<std::string, T, TCompare, TAlloc> const &value);
+template <class T, class TCompare, class TAlloc>
+facebook::jsi::Value WriteJsiValue(
+    facebook::jsi::Runtime &runtime,
+    std::map<std::wstring, T, TCompare, TAlloc> const &value);
+template <class T>
+facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, T const &value);
+
+//===========================================================================
+// Inline ToJSValue and ToJsiValue implementation
+//===========================================================================
+
+inline JSValue ToJSValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue) {
+  if (jsiValue.isBool()) {
+    return JSValue{jsiValue.getBool()};
+  } else if (jsiValue.isNumber()) {
+    return JSValue{jsiValue.getNumber()};
+  } else if (jsiValue.isString()) {
+    return JSValue{jsiValue.getString(runtime).utf8(runtime)};
+  } else if (jsiValue.isObject()) {
+    facebook::jsi::Object jsiObject = jsiValue.getObject(runtime);
+    if (jsiObject.isArray(runtime)) {
+      facebook::jsi::Array jsiArray = std::move(jsiObject).getArray(runtime);
+      size_t size = jsiArray.size(runtime);
+      JSValueArray array;
+      array.reserve(size);
+      for (size_t i = 0; i < size; ++i) {
+        array.push_back(ToJSValue(runtime, jsiArray.getValueAtIndex(runtime, i)));
+      }
+
+      return JSValue{std::move(array)};
+    } else if (!jsiObject.isFunction(runtime)) {
+      facebook::jsi::Array propertyNames = jsiObject.getPropertyNames(runtime);
+      size_t size = propertyNames.size(runtime);
+      JSValueObject object;
+      for (size_t i = 0; i < size; ++i) {
+        facebook::jsi::String propertyName = propertyNames.getValueAtIndex(runtime, i).getString(runtime);
+        object.emplace(propertyName.utf8(runtime), ToJSValue(runtime, jsiObject.getProperty(runtime, propertyName)));
+      }
+
+      return JSValue{std::move(object)};
+    }
+  }
+
+  // undefined, null, functions, and symbols
+  return JSValue{};
+}
+
+inline facebook::jsi::Value ToJsiValue(facebook::jsi::Runtime &runtime, JSValue const &value) {
+  switch (value.Type()) {
+    case JSValueType::Object:
+      return ToJsiValue(runtime, value.AsObject());
+    case JSValueType::Array:
+      return ToJsiValue(runtime, value.AsArray());
+    case JSValueType::String:
+      return facebook::jsi::String::createFromUtf8(runtime, *value.TryGetString());
+    case JSValueType::Boolean:
+      return facebook::jsi::Value{*value.TryGetBoolean()};
+    case JSValueType::Int64:
+      return facebook::jsi::Value{static_cast<double>(*value.TryGetInt64())};
+    case JSValueType::Double:
+      return facebook::jsi::Value{*value.TryGetDouble()};
+    default:
+      return facebook::jsi::Value::null();
+  }
+}
+
+inline facebook::jsi::Value ToJsiValue(facebook::jsi::Runtime &runtime, JSValueObject const &value) {
+  facebook::jsi::Object jsiObject{runtime};
+  for (auto const &property : value) {
+    jsiObject.setProperty(runtime, property.first.c_str(), ToJsiValue(runtime, property.second));
+  }
+
+  return facebook::jsi::Value{std::move(jsiObject)};
+}
+
+inline facebook::jsi::Value ToJsiValue(facebook::jsi::Runtime &runtime, JSValueArray const &value) {
+  facebook::jsi::Array jsiArray{runtime, value.size()};
+  for (size_t i = 0; i < value.size(); ++i) {
+    jsiArray.setValueAtIndex(runtime, i, ToJsiValue(runtime, value[i]));
+  }
+
+  return facebook::jsi::Value{std::move(jsiArray)};
+}
+
+//===========================================================================
+// Inline ReadJsiValue implementation
+//===========================================================================
+
+inline void
+ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ std::string &value) {
+  if (jsiValue.isString()) {
+    value = jsiValue.getString(runtime).utf8(runtime);
+  } else {
+    value = ToJSValue(runtime, jsiValue).AsString();
+  }
+}
+
+inline void
+ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ std::wstring &value) {
+  std::string utf8Value;
+  ReadJsiValue(runtime, jsiValue, /*out*/ utf8Value);
+  value = winrt::to_hstring(utf8Value);
+}
+
+inline void
+ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ JSValue &value) {
+  value = ToJSValue(runtime, jsiValue);
+}
+
+inline void
+ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ JSValueObject &value) {
+  JSValue jsValue = ToJSValue(runtime, jsiValue);
+  value = jsValue.TryGetObject() ? std::move(jsValue).MoveObject() : JSValueObject{};
+}
+
+inline void
+ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ JSValueArray &value) {
+  JSValue jsValue = ToJSValue(runtime, jsiValue);
+  value = jsValue.TryGetArray() ? std::move(jsValue).MoveArray() : JSValueArray{};
+}
+
+template <class T>
+inline void
+ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ std::optional<T> &value) {
+  if (jsiValue.isNull() || jsiValue.isUndefined()) {
+    value = std::nullopt;
+  } else {
+    T item{};
+    ReadJsiValue(runtime, jsiValue, /*out*/ item);
+    value = std::move(item);
+  }
+}
+
+template <class T, class TAlloc>
+inline void ReadJsiValue(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const &jsiValue,
+    /*out*/ std::vector<T, TAlloc> &value) {
+  value.clear();
+  if (jsiValue.isObject()) {
+    facebook::jsi::Object jsiObject = jsiValue.getObject(runtime);
+    if (jsiObject.isArray(runtime)) {
+      facebook::jsi::Array jsiArray = std::move(jsiObject).getArray(runtime);
+      size_t size = jsiArray.size(runtime);
+      value.reserve(size);
+      for (size_t i = 0; i < size; ++i) {
+        T item{};
+        ReadJsiValue(runtime, jsiArray.getValueAtIndex(runtime, i), /*out*/ item);
+        value.push_back(std::move(item));
+      }
+    }
+  }
+}
+
+template <class T, class TCompare, class TAlloc>
+inline void ReadJsiValue(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const &jsiValue,
+    /*out*/ std::map<std::string, T, TCompare, TAlloc> &value) {
+  value.clear();
+  if (jsiValue.isObject()) {
+    facebook::jsi::Object jsiObject = jsiValue.getObject(runtime);
+    facebook::jsi::Array propertyNames = jsiObject.getPropertyNames(runtime);
+    size_t size = propertyNames.size(runtime);
+    for (size_t i = 0; i < size; ++i) {
+      facebook::jsi::String propertyName = propertyNames.getValueAtIndex(runtime, i).getString(runtime);
+      ReadJsiValue(
+          runtime, jsiObject.getProperty(runtime, propertyName), /*out*/ value[propertyName.utf8(runtime)]);
+    }
+  }
+}
+
+template <class T, class TCompare, class TAlloc>
+inline void ReadJsiValue(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const &jsiValue,
+    /*out*/ std::map<std::wstring, T, TCompare, TAlloc> &value) {
+  value.clear();
+  if (jsiValue.isObject()) {
+    facebook::jsi::Object jsiObject = jsiValue.getObject(runtime);
+    facebook::jsi::Array propertyNames = jsiObject.getPropertyNames(runtime);
+    size_t size = propertyNames.size(runtime);
+    for (size_t i = 0; i < size; ++i) {
+      facebook::jsi::String propertyName = propertyNames.getValueAtIndex(runtime, i).getString(runtime);
+      ReadJsiValue(
+          runtime,
+          jsiObject.getProperty(runtime, propertyName),
+          /*out*/ value[std::wstring{winrt::to_hstring(propertyName.utf8(runtime))}]);
+    }
+  }
+}
+
+template <class T>
+inline void ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ T &value) {
+  if constexpr (std::is_same_v<T, bool>) {
+    value = jsiValue.isBool() ? jsiValue.getBool() : ToJSValue(runtime, jsiValue).AsBoolean();
+  } else if constexpr (std::is_floating_point_v<T>) {
+    value = static_cast<T>(jsiValue.isNumber() ? jsiValue.getNumber() : ToJSValue(runtime, jsiValue).AsDouble());
+  } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+    // Use the same conversion from double as JSValue::AsInt64.
+    // The int64_t max value is rounded up to 2^63 when it is converted to double, so it must be an exclusive bound.
+    int64_t int64Value{0};
+    if (jsiValue.isNumber()) {
+      double number = jsiValue.getNumber();
+      if (-9223372036854775808.0 <= number && number < 9223372036854775808.0) {
+        int64Value = static_cast<int64_t>(number);
+      }
+    } else {
+      int64Value = ToJSValue(runtime, jsiValue).AsInt64();
+    }
+
+    value = static_cast<T>(int64Value);
+  } else {
+    // Use ReadValue overloads for JSValue, such as the ones generated for REACT_STRUCT.
+    ReadValue(ToJSValue(runtime, jsiValue), /*out*/ value);
+  }
+}
+
+template <class... TArgs>
+inline void ReadJsiArgs(
+    [[maybe_unused]] facebook::jsi::Runtime &runtime,
+    [[maybe_unused]] facebook::jsi::Value const *args,
+    [[maybe_unused]] size_t argCount,
+    /*out*/ TArgs &...values) {
+  // Missing arguments keep their default values.
+  [[maybe_unused]] size_t index = 0;
+  ((index < argCount ? ReadJsiValue(runtime, args[index], /*out*/ values) : void(), ++index), ...);
+}
+
+//===========================================================================
+// Inline WriteJsiValue implementation
+//===========================================================================
+
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::string const &value) {
+  return facebook::jsi::String::createFromUtf8(runtime, value);
+}
+
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::string_view value) {
+  return facebook::jsi::String::createFromUtf8(
+      runtime, reinterpret_cast<uint8_t const *>(value.data()), value.size());
+}
+
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, char const *value) {
+  return WriteJsiValue(runtime, std::string_view{value});
+}
+
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::wstring_view value) {
+  return WriteJsiValue(runtime, winrt::to_string(value));
+}
+
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, wchar_t const *value) {
+  return WriteJsiValue(runtime, std::wstring_view{value});
+}
+
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, JSValue const &value) {
+  return ToJsiValue(runtime, value);
+}
+
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, JSValueObject const &value) {
+  return ToJsiValue(runtime, value);
+}
+
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, JSValueArray const &value) {
+  return ToJsiValue(runtime, value);
+}
+
+template <class T>
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::optional<T> const &value) {
+  return value ? WriteJsiValue(runtime, *value) : facebook::jsi::Value::null();
+}
+
+template <class T, class TAlloc>
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, std::vector<T, TAlloc> const &value) {
+  facebook::jsi::Array jsiArray{runtime, value.size()};
+  for (size_t i = 0; i < value.size(); ++i) {
+    jsiArray.setValueAtIndex(runtime, i, WriteJsiValue(runtime, value[i]));
+  }
+
+  return facebook::jsi::Value{std::move(jsiArray)};
+}
+
+template <class T, class TCompare, class TAlloc>
+inline facebook::jsi::Value WriteJsiValue(
+    facebook::jsi::Runtime &runtime,
+    std::map<std::string, T, TCompare, TAlloc> const &value) {
+  facebook::jsi::Object jsiObject{runtime};
+  for (auto const &property : value) {
+    jsiObject.setProperty(runtime, property.first.c_str(), WriteJsiValue(runtime, property.second));
+  }
+
+  return facebook::jsi::Value{std::move(jsiObject)};
+}
+
+template <class T, class TCompare, class TAlloc>
+inline facebook::jsi::Value WriteJsiValue(
+    facebook::jsi::Runtime &runtime,
+    std::map<std::wstring, T, TCompare, TAlloc> const &value) {
+  facebook::jsi::Object jsiObject{runtime};
+  for (auto const &property : value) {
+    jsiObject.setProperty(runtime, winrt::to_string(property.first).c_str(), WriteJsiValue(runtime, property.second));
+  }
+
+  return facebook::jsi::Value{std::move(jsiObject)};
+}
+
+template <class T>
+inline facebook::jsi::Value WriteJsiValue(facebook::jsi::Runtime &runtime, T const &value) {
+  if constexpr (std::is_same_v<T, bool>) {
+    return facebook::jsi::Value{value};
+  } else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+    return facebook::jsi::Value{static_cast<double>(value)};
+  } else {
+    // Use WriteValue overloads for IJSValueWriter, such as the ones generated for REACT_STRUCT.
+    IJSValueWriter writer = MakeJSValueTreeWriter();
+    WriteValue(writer, value);
+    return ToJsiValue(runtime, TakeJSValue(writer));
+  }
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSI_JSIVALUECONVERTER
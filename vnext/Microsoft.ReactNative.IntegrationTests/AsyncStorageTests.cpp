@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <NativeModules.h>
+#include "TestEventService.h"
+#include "TestReactNativeHostHolder.h"
+
+using namespace winrt;
+using namespace Microsoft::ReactNative;
+
+namespace ReactNativeIntegrationTests {
+
+// Use anonymous namespace to avoid any linking conflicts
+namespace {
+
+// Reports the results of the AsyncLocalStorage calls made by AsyncStorageTests.js.
+REACT_MODULE(AsyncStorageTestModule)
+struct AsyncStorageTestModule {
+  REACT_METHOD(LogResult, L"logResult")
+  void LogResult(std::string name, JSValue value) noexcept {
+    TestEventService::LogEvent(name, std::move(value));
+  }
+};
+
+struct AsyncStorageTestPackageProvider : winrt::implements<AsyncStorageTestPackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    TryAddAttributedModule(packageBuilder, L"AsyncStorageTestModule");
+  }
+};
+
+} // namespace
+
+TEST_CLASS (AsyncStorageTests) {
+  TEST_METHOD(MergeIntoNewKeyRequiresObject) {
+    TestEventService::Initialize();
+
+    auto reactNativeHost = TestReactNativeHostHolder(L"AsyncStorageTests", [](ReactNativeHost const &host) noexcept {
+      host.PackageProviders().Append(winrt::make<AsyncStorageTestPackageProvider>());
+    });
+
+    TestEventService::ObserveEvents({
+        TestEvent{"MalformedPatchRejected", true},
+        TestEvent{"NonObjectPatchRejected", true},
+        TestEvent{"MergedValue", R"({"a":1})"},
+    });
+  }
+};
+
+} // namespace ReactNativeIntegrationTests
@@ -0,0 +1,28 @@
+/**
+ * Copyright (c) Microsoft Corporation.
+ * Licensed under the MIT License.
+ *
+ * @format
+ */
+
+import {NativeModules, TurboModuleRegistry} from 'react-native';
+
+const testModule = TurboModuleRegistry.getEnforcing('AsyncStorageTestModule');
+const asyncStorage = NativeModules.AsyncLocalStorage;
+const key = 'AsyncStorageTests.newKey';
+
+// Merging into a key that has no value yet must be rejected unless the patch is a JSON object,
+// and a rejected merge must not store anything.
+asyncStorage.multiRemove([key], () => {
+  asyncStorage.multiMerge([[key, 'not json']], malformedError => {
+    testModule.logResult('MalformedPatchRejected', malformedError != null);
+    asyncStorage.multiMerge([[key, '[1]']], nonObjectError => {
+      testModule.logResult('NonObjectPatchRejected', nonObjectError != null);
+      asyncStorage.multiMerge([[key, '{"a":1}']], () => {
+        asyncStorage.multiGet([key], (error, result) => {
+          testModule.logResult('MergedValue', result[0][1]);
+        });
+      });
+    });
+  });
+});
@@ -634,6 +634,24 @@ TEST_CLASS (TurboModuleTests) {
     });
   }
 
+  TEST_METHOD(CachesModuleMembers) {
+    TestEventService::Initialize();
+
+    auto reactNativeHost = TestReactNativeHostHolder(L"TurboModuleTests", [](ReactNativeHost const &host) noexcept {
+      host.PackageProviders().Append(winrt::make<CppTurboModulePackageProvider>());
+      ReactPropertyBag(host.InstanceSettings().Properties()).Set(CppTurboModule::TestName, L"CachesModuleMembers");
+    });
+
+    // Repeated property reads return the cached function, also for a name created at run time.
+    TestEventService::ObserveEvents({
+        TestEvent{"sameSyncMethod", true},
+        TestEvent{"sameMethod", true},
+        TestEvent{"sameGetConstants", true},
+        TestEvent{"unknownMember", true},
+        TestEvent{"addSync", 42},
+    });
+  }
+
   TEST_METHOD(JSDispatcherAfterInstanceUnload) {
     TestEventService::Initialize();
     TestNotificationService::Initialize();
@@ -125,6 +125,12 @@ const promisify2 = fn =>
       CppTurboModule.logAction("addSync", CppTurboModule.addSync(40, 2));
       CppTurboModule.logAction("negateSync", CppTurboModule.negateSync(12));
       CppTurboModule.logAction("sayHelloSync", CppTurboModule.sayHelloSync());
+    } else if (testName === "CachesModuleMembers") {
+      CppTurboModule.logAction("sameSyncMethod", CppTurboModule.addSync === CppTurboModule.addSync);
+      CppTurboModule.logAction("sameMethod", CppTurboModule.add === CppTurboModule['a' + 'dd']);
+      CppTurboModule.logAction("sameGetConstants", CppTurboModule.getConstants === CppTurboModule.getConstants);
+      CppTurboModule.logAction("unknownMember", CppTurboModule.unknownMember === undefined);
+      CppTurboModule.logAction("addSync", CppTurboModule.addSync(40, 2));
     } else if (testName === "JSDispatcherAfterInstanceUnload") {
       CppTurboModule.logAction("addSync", CppTurboModule.addSync(40, 2));
     } else if (testName === "DeferCallbackAfterInstanceUnload") {
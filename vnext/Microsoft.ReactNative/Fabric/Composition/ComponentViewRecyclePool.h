@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+/*
+ * Keeps deleted component views per component type, up to a maximum number of views per type, so that they can be
+ * reused the next time a view of that type is created. The component view registry keeps its views by tag, and uses
+ * the pool to recycle them.
+ */
+template <typename TView>
+class ComponentViewRecyclePool {
+ public:
+  // Maximum number of views kept per component type, as on iOS
+  static constexpr size_t DefaultMaxSize = 1024;
+
+  // Returns the maximum pool size configured by the app, or DefaultMaxSize if the app does not configure it.
+  static size_t DefaultMaxSizeFromProperty(std::optional<int> const &propertyValue) noexcept {
+    return propertyValue ? static_cast<size_t>(std::max(*propertyValue, 0)) : DefaultMaxSize;
+  }
+
+  // Sets the maximum number of views kept for component types that do not have their own maximum.
+  void setDefaultMaxSize(size_t maxSize) noexcept {
+    m_defaultMaxSize = maxSize;
+    for (auto &[componentHandle, pool] : m_pools) {
+      trim(componentHandle, pool);
+    }
+  }
+
+  // Sets the maximum number of views kept for a component type. 0 disables recycling.
+  void setMaxSize(facebook::react::ComponentHandle componentHandle, size_t maxSize) noexcept {
+    m_maxSizes[componentHandle] = maxSize;
+    trim(componentHandle, m_pools[componentHandle]);
+  }
+
+  size_t maxSize(facebook::react::ComponentHandle componentHandle) const noexcept {
+    auto it = m_maxSizes.find(componentHandle);
+    return it != m_maxSizes.end() ? it->second : m_defaultMaxSize;
+  }
+
+  size_t size(facebook::react::ComponentHandle componentHandle) const noexcept {
+    auto it = m_pools.find(componentHandle);
+    return it != m_pools.end() ? it->second.size() : 0;
+  }
+
+  bool isFull(facebook::react::ComponentHandle componentHandle) const noexcept {
+    return size(componentHandle) >= maxSize(componentHandle);
+  }
+
+  // Keeps the view unless the pool for its type is full. The view must already be prepared for recycling.
+  void enqueue(facebook::react::ComponentHandle componentHandle, std::shared_ptr<TView> view) noexcept {
+    auto &pool = m_pools[componentHandle];
+    if (pool.size() < maxSize(componentHandle)) {
+      pool.push_back(std::move(view));
+    }
+  }
+
+  // Returns a view of the component type, or nullptr if the pool for the type is empty.
+  std::shared_ptr<TView> dequeue(facebook::react::ComponentHandle componentHandle) noexcept {
+    auto it = m_pools.find(componentHandle);
+    if (it == m_pools.end() || it->second.empty()) {
+      return nullptr;
+    }
+
+    auto view = std::move(it->second.back());
+    it->second.pop_back();
+    return view;
+  }
+
+  // Returns the descriptor of the view registered for the tag. Otherwise registers a recycled view of the component
+  // type for the tag, or a view returned by createView if there is none.
+  template <typename TDescriptor, typename TCreateView>
+  TDescriptor const &dequeue(
+      std::unordered_map<facebook::react::Tag, TDescriptor> &registry,
+      facebook::react::ComponentHandle componentHandle,
+      facebook::react::Tag tag,
+      TCreateView &&createView) noexcept {
+    // Preliminary view allocation can ask for a view that already exists.
+    auto existing = registry.find(tag);
+    if (existing != registry.end()) {
+      return existing->second;
+    }
+
+    auto view = dequeue(componentHandle);
+    if (view) {
+      view->tag(tag);
+    } else {
+      view = createView();
+    }
+
+    return registry.insert({tag, TDescriptor{std::move(view)}}).first->second;
+  }
+
+  // Unregisters the view of the tag, and keeps it for reuse unless the pool for its type is full.
+  template <typename TDescriptor>
+  void enqueue(
+      std::unordered_map<facebook::react::Tag, TDescriptor> &registry,
+      facebook::react::ComponentHandle componentHandle,
+      facebook::react::Tag tag) noexcept {
+    auto it = registry.find(tag);
+    assert(it != registry.end());
+    auto view = std::static_pointer_cast<TView>(it->second.view);
+    registry.erase(it);
+
+    if (!isFull(componentHandle)) {
+      view->prepareForRecycle();
+      enqueue(componentHandle, std::move(view));
+    }
+  }
+
+ private:
+  void trim(facebook::react::ComponentHandle componentHandle, std::vector<std::shared_ptr<TView>> &pool) noexcept {
+    auto max = maxSize(componentHandle);
+    if (pool.size() > max) {
+      pool.resize(max);
+    }
+  }
+
+  std::unordered_map<facebook::react::ComponentHandle, std::vector<std::shared_ptr<TView>>> m_pools;
+  std::unordered_map<facebook::react::ComponentHandle, size_t> m_maxSizes;
+  size_t m_defaultMaxSize{DefaultMaxSize};
+};
+
+} // namespace Microsoft::ReactNative
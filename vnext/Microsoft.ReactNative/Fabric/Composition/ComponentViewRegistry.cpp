@@ -25,19 +25,42 @@
 #include <Fabric/Composition/ParagraphComponentView.h>
 #include <Fabric/Composition/ScrollViewComponentView.h>
 #include <Fabric/Composition/TextInput/WindowsTextInputComponentView.h>
+#include <ReactPropertyBag.h>
 
 namespace Microsoft::ReactNative {
 
+static const winrt::Microsoft::ReactNative::ReactPropertyId<int> &RecyclePoolMaxSizePropertyId() noexcept {
+  static const winrt::Microsoft::ReactNative::ReactPropertyId<int> prop{
+      L"ReactNative.Composition", L"ComponentViewRecyclePoolMaxSize"};
+  return prop;
+}
+
 void ComponentViewRegistry::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
+
+  m_recyclePool.setDefaultMaxSize(
+      ComponentViewRecyclePool<CompositionBaseComponentView>::DefaultMaxSizeFromProperty(
+          m_context.Properties().Get(RecyclePoolMaxSizePropertyId())));
+
+  // Scroll views and text inputs are not recycled, since their prepareForRecycle does not reset the scroll position
+  // or the text host. Apps can still opt in with setRecyclePoolMaxSize.
+  m_recyclePool.setMaxSize(facebook::react::ScrollViewShadowNode::Handle(), 0);
+  m_recyclePool.setMaxSize(facebook::react::WindowsTextInputShadowNode::Handle(), 0);
 }
 
 ComponentViewDescriptor const &ComponentViewRegistry::dequeueComponentViewWithComponentHandle(
     facebook::react::ComponentHandle componentHandle,
     facebook::react::Tag tag,
     const winrt::Microsoft::ReactNative::Composition::ICompositionContext &compContext) noexcept {
-  // TODO implement recycled components like core does
+  return m_recyclePool.dequeue(m_registry, componentHandle, tag, [&]() {
+    return createComponentView(componentHandle, tag, compContext);
+  });
+}
 
+std::shared_ptr<CompositionBaseComponentView> ComponentViewRegistry::createComponentView(
+    facebook::react::ComponentHandle componentHandle,
+    facebook::react::Tag tag,
+    const winrt::Microsoft::ReactNative::Composition::ICompositionContext &compContext) noexcept {
   std::shared_ptr<CompositionBaseComponentView> view;
 
   if (componentHandle == facebook::react::ParagraphShadowNode::Handle()) {
@@ -52,8 +75,7 @@ ComponentViewDescriptor const &ComponentViewRegistry::dequeueComponentViewWithCo
     view = std::make_shared<CompositionViewComponentView>(compContext, tag);
   }
 
-  auto it = m_registry.insert({tag, ComponentViewDescriptor{view}});
-  return it.first->second;
+  return view;
 }
 
 ComponentViewDescriptor const &ComponentViewRegistry::componentViewDescriptorWithTag(
@@ -76,8 +98,12 @@ void ComponentViewRegistry::enqueueComponentViewWithComponentHandle(
     facebook::react::ComponentHandle componentHandle,
     facebook::react::Tag tag,
     ComponentViewDescriptor componentViewDescriptor) noexcept {
-  assert(m_registry.find(tag) != m_registry.end());
+  m_recyclePool.enqueue(m_registry, componentHandle, tag);
+}
 
-  m_registry.erase(tag);
+void ComponentViewRegistry::setRecyclePoolMaxSize(
+    facebook::react::ComponentHandle componentHandle,
+    size_t maxSize) noexcept {
+  m_recyclePool.setMaxSize(componentHandle, maxSize);
 }
 } // namespace Microsoft::ReactNative
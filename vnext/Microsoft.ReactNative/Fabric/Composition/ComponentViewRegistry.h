@@ -6,11 +6,17 @@
 
 #include <Fabric/IComponentViewRegistry.h>
 
+#include <Fabric/Composition/ComponentViewRecyclePool.h>
 #include <Fabric/Composition/CompositionHelpers.h>
 
 namespace Microsoft::ReactNative {
 
-/* This could be expanded to have a pool of ComponentViewDescriptor's, like iOS does */
+struct CompositionBaseComponentView;
+
+/*
+ * Keeps the component views by tag. Like iOS, views that are deleted are kept in a pool for their component type,
+ * and reused the next time a view of that type is created.
+ */
 class ComponentViewRegistry final : public IComponentViewRegistry {
  public:
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept override;
@@ -26,8 +32,17 @@ class ComponentViewRegistry final : public IComponentViewRegistry {
       facebook::react::Tag tag,
       ComponentViewDescriptor componentViewDescriptor) noexcept override;
 
+  // Sets the maximum number of views of a component type that are kept for recycling. 0 disables recycling.
+  void setRecyclePoolMaxSize(facebook::react::ComponentHandle componentHandle, size_t maxSize) noexcept;
+
  private:
+  std::shared_ptr<CompositionBaseComponentView> createComponentView(
+      facebook::react::ComponentHandle componentHandle,
+      facebook::react::Tag tag,
+      const winrt::Microsoft::ReactNative::Composition::ICompositionContext &compContext) noexcept;
+
   std::unordered_map<facebook::react::Tag, ComponentViewDescriptor> m_registry;
+  ComponentViewRecyclePool<CompositionBaseComponentView> m_recyclePool;
   winrt::Microsoft::ReactNative::ReactContext m_context;
 };
 
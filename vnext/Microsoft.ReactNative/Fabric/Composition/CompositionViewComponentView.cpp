@@ -45,6 +45,22 @@ facebook::react::Tag CompositionBaseComponentView::tag() const noexcept {
   return m_tag;
 }
 
+void CompositionBaseComponentView::tag(facebook::react::Tag tag) noexcept {
+  m_tag = tag;
+}
+
+void CompositionBaseComponentView::prepareForRecycle() noexcept {
+  // Children are unmounted before their parent is deleted.
+  assert(m_children.empty());
+
+  if (GetFocusedComponent() == this) {
+    SetFocusedComponent(nullptr);
+  }
+
+  m_eventEmitter = nullptr;
+  m_parent = nullptr;
+}
+
 void CompositionBaseComponentView::parent(IComponentView *parent) noexcept {
   m_parent = parent;
 }
@@ -1205,7 +1221,9 @@ void CompositionViewComponentView::updateLayoutMetrics(
 
 void CompositionViewComponentView::finalizeUpdates(RNComponentViewUpdateMask updateMask) noexcept {}
 
-void CompositionViewComponentView::prepareForRecycle() noexcept {}
+void CompositionViewComponentView::prepareForRecycle() noexcept {
+  Super::prepareForRecycle();
+}
 facebook::react::Props::Shared CompositionViewComponentView::props() noexcept {
   return m_props;
 }
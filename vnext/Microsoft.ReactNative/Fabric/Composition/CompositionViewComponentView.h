@@ -35,6 +35,11 @@ struct CompositionBaseComponentView : public IComponentView {
   void onFocusGained() noexcept override;
 
   facebook::react::Tag tag() const noexcept override;
+  void tag(facebook::react::Tag tag) noexcept;
+
+  // Detaches the view from the component it was used for, so that it can be reused for another one.
+  // The derived views reset their own state, and must call the base implementation.
+  void prepareForRecycle() noexcept override;
 
   virtual bool ScrollWheel(facebook::react::Point pt, int32_t delta) noexcept;
   virtual int64_t SendMessage(uint32_t msg, uint64_t wParam, int64_t lParam) noexcept;
@@ -67,7 +72,7 @@ struct CompositionBaseComponentView : public IComponentView {
 
   winrt::Microsoft::ReactNative::Composition::ICompositionContext m_compContext;
   comp::CompositionPropertySet m_centerPropSet{nullptr};
-  const facebook::react::Tag m_tag;
+  facebook::react::Tag m_tag;
   facebook::react::SharedViewEventEmitter m_eventEmitter;
   std::vector<const IComponentView *> m_children;
   IComponentView *m_parent{nullptr};
@@ -26,9 +26,9 @@ extern "C" HRESULT WINAPI WICCreateImagingFactory_Proxy(UINT SDKVersion, IWICIma
 namespace Microsoft::ReactNative {
 
 ImageComponentView::WindowsImageResponseObserver::WindowsImageResponseObserver(
-    std::shared_ptr<ImageComponentView> image) {
-  m_image = image;
-}
+    std::shared_ptr<ImageComponentView> image,
+    facebook::react::ImageShadowNode::ConcreteState::Shared state)
+    : m_image(std::move(image)), m_state(std::move(state)) {}
 
 void ImageComponentView::WindowsImageResponseObserver::didReceiveProgress(float progress) const {
   // TODO progress?
@@ -38,7 +38,7 @@ void ImageComponentView::WindowsImageResponseObserver::didReceiveImage(
     facebook::react::ImageResponse const &imageResponse) const {
   auto sharedwicbmp = std::static_pointer_cast<winrt::com_ptr<IWICBitmap>>(imageResponse.getImage());
   m_image->m_context.UIDispatcher().Post(
-      [wicbmp = *sharedwicbmp, image = m_image]() { image->didReceiveImage(wicbmp); });
+      [wicbmp = *sharedwicbmp, image = m_image, state = m_state]() { image->didReceiveImage(wicbmp, state); });
 }
 
 void ImageComponentView::WindowsImageResponseObserver::didReceiveFailure() const {
@@ -74,8 +74,13 @@ void ImageComponentView::ImageLoadStart() noexcept {
   }
 }
 
-void ImageComponentView::didReceiveImage(const winrt::com_ptr<IWICBitmap> &wicbmp) noexcept {
-  // TODO check for recycled?
+void ImageComponentView::didReceiveImage(
+    const winrt::com_ptr<IWICBitmap> &wicbmp,
+    facebook::react::ImageShadowNode::ConcreteState::Shared const &state) noexcept {
+  // The image can arrive after the view switched to another image request, or was recycled.
+  if (state != m_state) {
+    return;
+  }
 
   auto imageEventEmitter = std::static_pointer_cast<facebook::react::ImageEventEmitter const>(m_eventEmitter);
   if (imageEventEmitter) {
@@ -129,16 +134,6 @@ void ImageComponentView::updateState(
   auto oldImageState = std::static_pointer_cast<facebook::react::ImageShadowNode::ConcreteState const>(m_state);
   auto newImageState = std::static_pointer_cast<facebook::react::ImageShadowNode::ConcreteState const>(state);
 
-  if (!m_imageResponseObserver) {
-    // Should ViewComponents enable_shared_from_this? then we dont need this dance to get a shared_ptr
-    std::shared_ptr<FabricUIManager> fabricuiManager =
-        ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties());
-    auto componentViewDescriptor = fabricuiManager->GetViewRegistry().componentViewDescriptorWithTag(m_tag);
-
-    m_imageResponseObserver = std::make_shared<WindowsImageResponseObserver>(
-        std::static_pointer_cast<ImageComponentView>(componentViewDescriptor.view));
-  }
-
   setStateAndResubscribeImageResponseObserver(newImageState);
   bool havePreviousData = oldImageState && oldImageState->getData().getImageSource() != facebook::react::ImageSource{};
 
@@ -155,11 +150,20 @@ void ImageComponentView::setStateAndResubscribeImageResponseObserver(
   if (m_state) {
     auto &observerCoordinator = m_state->getData().getImageRequest().getObserverCoordinator();
     observerCoordinator.removeObserver(*m_imageResponseObserver);
+    m_imageResponseObserver = nullptr;
   }
 
   m_state = state;
 
   if (m_state) {
+    // Each image request gets its own observer, so that images posted for a previous request are dropped.
+    // Should ViewComponents enable_shared_from_this? then we dont need this dance to get a shared_ptr
+    std::shared_ptr<FabricUIManager> fabricuiManager =
+        ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties());
+    auto componentViewDescriptor = fabricuiManager->GetViewRegistry().componentViewDescriptorWithTag(m_tag);
+
+    m_imageResponseObserver = std::make_shared<WindowsImageResponseObserver>(
+        std::static_pointer_cast<ImageComponentView>(componentViewDescriptor.view), m_state);
     auto &observerCoordinator = m_state->getData().getImageRequest().getObserverCoordinator();
     observerCoordinator.addObserver(*m_imageResponseObserver);
   }
@@ -285,7 +289,17 @@ void ImageComponentView::DrawImage() noexcept {
   }
 }
 
-void ImageComponentView::prepareForRecycle() noexcept {}
+void ImageComponentView::prepareForRecycle() noexcept {
+  Super::prepareForRecycle();
+
+  // Stop listening to the previous image request, and do not show its image until the next one is loaded.
+  setStateAndResubscribeImageResponseObserver(nullptr);
+  m_wicbmp = nullptr;
+  m_drawingSurface = nullptr;
+  if (m_visual) {
+    m_visual.Brush(m_compContext.CreateColorBrush({0, 0, 0, 0}));
+  }
+}
 facebook::react::Props::Shared ImageComponentView::props() noexcept {
   return m_props;
 }
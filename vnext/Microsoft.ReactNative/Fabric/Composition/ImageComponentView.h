@@ -57,13 +57,17 @@ struct ImageComponentView : CompositionBaseComponentView {
  private:
   struct WindowsImageResponseObserver : facebook::react::ImageResponseObserver {
    public:
-    WindowsImageResponseObserver(std::shared_ptr<ImageComponentView> image);
+    WindowsImageResponseObserver(
+        std::shared_ptr<ImageComponentView> image,
+        facebook::react::ImageShadowNode::ConcreteState::Shared state);
     void didReceiveProgress(float progress) const override;
     void didReceiveImage(facebook::react::ImageResponse const &imageResponse) const override;
     void didReceiveFailure() const override;
 
    private:
     std::shared_ptr<ImageComponentView> m_image;
+    // The state whose image request this observer is subscribed to.
+    facebook::react::ImageShadowNode::ConcreteState::Shared m_state;
   };
 
   void ensureVisual() noexcept;
@@ -72,7 +76,9 @@ struct ImageComponentView : CompositionBaseComponentView {
 
   void ImageLoadStart() noexcept;
   void ImageLoaded() noexcept;
-  void didReceiveImage(const winrt::com_ptr<IWICBitmap> &wicbmp) noexcept;
+  void didReceiveImage(
+      const winrt::com_ptr<IWICBitmap> &wicbmp,
+      facebook::react::ImageShadowNode::ConcreteState::Shared const &state) noexcept;
   void didReceiveFailureFromObserver() noexcept;
   void setStateAndResubscribeImageResponseObserver(
       facebook::react::ImageShadowNode::ConcreteState::Shared const &state) noexcept;
@@ -102,7 +102,19 @@ void ParagraphComponentView::finalizeUpdates(RNComponentViewUpdateMask updateMas
   ensureVisual();
   updateVisualBrush();
 }
-void ParagraphComponentView::prepareForRecycle() noexcept {}
+void ParagraphComponentView::prepareForRecycle() noexcept {
+  Super::prepareForRecycle();
+
+  m_attributedStringBox = {};
+  m_textLayout = nullptr;
+  m_requireRedraw = true;
+
+  // Release the surface of the previous text while the view waits in the recycle pool.
+  m_drawingSurface = nullptr;
+  if (m_visual) {
+    m_visual.Brush(m_compContext.CreateColorBrush({0, 0, 0, 0}));
+  }
+}
 facebook::react::Props::Shared ParagraphComponentView::props() noexcept {
   assert(false);
   return {};
@@ -201,7 +213,7 @@ void ParagraphComponentView::updateVisualBrush() noexcept {
     const std::optional<facebook::react::TextAlignment> &textAlignment = m_props->textAttributes.alignment;
 
     facebook::react::TextLayoutManager::GetTextLayout(
-        m_attributedStringBox, {} /*TODO*/, contraints, textAlignment, m_textLayout);
+        m_attributedStringBox, paragraphProps.paragraphAttributes, contraints, textAlignment, m_textLayout);
     requireNewBrush = true;
   }
 
@@ -218,7 +218,9 @@ void ScrollViewComponentView::updateContentVisualSize() noexcept {
 void ScrollViewComponentView::finalizeUpdates(RNComponentViewUpdateMask updateMask) noexcept {
   // m_element.FinalizeProperties();
 }
-void ScrollViewComponentView::prepareForRecycle() noexcept {}
+void ScrollViewComponentView::prepareForRecycle() noexcept {
+  Super::prepareForRecycle();
+}
 facebook::react::Props::Shared ScrollViewComponentView::props() noexcept {
   assert(false);
   return {};
@@ -846,7 +846,9 @@ void WindowsTextInputComponentView::finalizeUpdates(RNComponentViewUpdateMask up
 
   ensureDrawingSurface();
 }
-void WindowsTextInputComponentView::prepareForRecycle() noexcept {}
+void WindowsTextInputComponentView::prepareForRecycle() noexcept {
+  Super::prepareForRecycle();
+}
 facebook::react::Props::Shared WindowsTextInputComponentView::props() noexcept {
   return m_props;
 }
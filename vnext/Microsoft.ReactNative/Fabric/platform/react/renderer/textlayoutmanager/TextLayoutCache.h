@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/Hash.h>
+#include <react/renderer/attributedstring/primitives.h>
+#include <react/renderer/graphics/Float.h>
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Thread-safe cache that keeps the most recently used values.
+ * Values are created outside of the lock, so threads that miss the same key at the same time may all create the
+ * value. The first value stored is the one returned to all of them.
+ */
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>>
+class LruCache {
+ public:
+  explicit LruCache(size_t capacity) noexcept : m_capacity{capacity} {}
+
+  LruCache(const LruCache &) = delete;
+  LruCache &operator=(const LruCache &) = delete;
+
+  /*
+   * Returns the value for `key`, calling `create(key)` to create it on a miss.
+   */
+  template <typename TCreate>
+  TValue get(const TKey &key, TCreate &&create) {
+    {
+      std::scoped_lock lock{m_mutex};
+      if (auto value = find(key)) {
+        return *value;
+      }
+    }
+
+    TValue value = create(key);
+
+    std::scoped_lock lock{m_mutex};
+    if (auto existing = find(key)) {
+      return *existing;
+    }
+
+    auto it = m_entries.emplace(key, Entry{value, {}}).first;
+    m_order.push_front(&it->first);
+    it->second.position = m_order.begin();
+
+    if (m_entries.size() > m_capacity) {
+      auto leastRecentlyUsed = m_entries.find(*m_order.back());
+      m_order.pop_back();
+      m_entries.erase(leastRecentlyUsed);
+    }
+
+    return value;
+  }
+
+  size_t size() const {
+    std::scoped_lock lock{m_mutex};
+    return m_entries.size();
+  }
+
+  void clear() {
+    std::scoped_lock lock{m_mutex};
+    m_order.clear();
+    m_entries.clear();
+  }
+
+ private:
+  struct Entry {
+    TValue value;
+    typename std::list<const TKey *>::iterator position;
+  };
+
+  // Returns the value for `key` and marks it as the most recently used one. Must be called under the lock.
+  const TValue *find(const TKey &key) {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+      return nullptr;
+    }
+
+    m_order.splice(m_order.begin(), m_order, it->second.position);
+    return &it->second.value;
+  }
+
+  const size_t m_capacity;
+  mutable std::mutex m_mutex;
+  std::unordered_map<TKey, Entry, THash> m_entries;
+
+  // Keys of m_entries from the most to the least recently used.
+  std::list<const TKey *> m_order;
+};
+
+/*
+ * Identifies a text format, which holds the font of the outermost fragment of a text.
+ */
+struct TextFormatCacheKey {
+  std::string fontFamily{};
+  FontWeight fontWeight{FontWeight::Regular};
+  FontStyle fontStyle{FontStyle::Normal};
+  Float fontSize{0};
+};
+
+inline bool operator==(const TextFormatCacheKey &lhs, const TextFormatCacheKey &rhs) {
+  return lhs.fontFamily == rhs.fontFamily && lhs.fontWeight == rhs.fontWeight && lhs.fontStyle == rhs.fontStyle &&
+      lhs.fontSize == rhs.fontSize;
+}
+
+inline bool operator!=(const TextFormatCacheKey &lhs, const TextFormatCacheKey &rhs) {
+  return !(lhs == rhs);
+}
+
+} // namespace react
+} // namespace facebook
+
+namespace std {
+
+template <>
+struct hash<facebook::react::TextFormatCacheKey> {
+  size_t operator()(const facebook::react::TextFormatCacheKey &key) const {
+    return folly::hash::hash_combine(key.fontFamily, key.fontWeight, key.fontStyle, key.fontSize);
+  }
+};
+
+} // namespace std
@@ -7,122 +7,165 @@
 
 #include <Fabric/DWriteHelpers.h>
 #include <dwrite.h>
+#include "TextLayoutCache.h"
 #include "TextLayoutManager.h"
 
 #include <unicode.h>
 
 namespace facebook::react {
 
-void TextLayoutManager::GetTextLayout(
-    AttributedStringBox attributedStringBox,
-    ParagraphAttributes paragraphAttributes,
-    LayoutConstraints layoutConstraints,
-    const std::optional<TextAlignment> &textAlignment,
-    winrt::com_ptr<IDWriteTextLayout> &spTextLayout) noexcept {
-  if (attributedStringBox.getValue().isEmpty())
-    return;
+namespace {
+
+// Most recently used text formats. Text measurements are cached by TextLayoutManager::m_measureCache.
+constexpr size_t TextFormatCacheCapacity = 64;
+
+LruCache<TextFormatCacheKey, winrt::com_ptr<IDWriteTextFormat>> &GetTextFormatCache() noexcept {
+  static LruCache<TextFormatCacheKey, winrt::com_ptr<IDWriteTextFormat>> s_cache{TextFormatCacheCapacity};
+  return s_cache;
+}
 
-  auto fragments = attributedStringBox.getValue().getFragments();
-  auto outerFragment = fragments[0];
-
-  DWRITE_FONT_STYLE style = DWRITE_FONT_STYLE_NORMAL;
-  if (outerFragment.textAttributes.fontStyle == facebook::react::FontStyle::Italic)
-    style = DWRITE_FONT_STYLE_ITALIC;
-  else if (outerFragment.textAttributes.fontStyle == facebook::react::FontStyle::Oblique)
-    style = DWRITE_FONT_STYLE_OBLIQUE;
-
-  winrt::com_ptr<IDWriteTextFormat> spTextFormat;
-  winrt::check_hresult(Microsoft::ReactNative::DWriteFactory()->CreateTextFormat(
-      outerFragment.textAttributes.fontFamily.empty()
-          ? L"Segoe UI"
-          : Microsoft::Common::Unicode::Utf8ToUtf16(outerFragment.textAttributes.fontFamily).c_str(),
-      nullptr, // Font collection (nullptr sets it to use the system font collection).
-      static_cast<DWRITE_FONT_WEIGHT>(outerFragment.textAttributes.fontWeight.value_or(
-          static_cast<facebook::react::FontWeight>(DWRITE_FONT_WEIGHT_REGULAR))),
-      style,
-      DWRITE_FONT_STRETCH_NORMAL,
-      outerFragment.textAttributes.fontSize,
-      L"",
-      spTextFormat.put()));
-
-  DWRITE_TEXT_ALIGNMENT alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
-  if (textAlignment) {
-    switch (*textAlignment) {
-      case facebook::react::TextAlignment::Center:
-        alignment = DWRITE_TEXT_ALIGNMENT_CENTER;
-        break;
-      case facebook::react::TextAlignment::Justified:
-        alignment = DWRITE_TEXT_ALIGNMENT_JUSTIFIED;
-        break;
-      case facebook::react::TextAlignment::Left:
-        alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
-        break;
-      case facebook::react::TextAlignment::Right:
-        alignment = DWRITE_TEXT_ALIGNMENT_TRAILING;
-        break;
-      // TODO use LTR values
-      case facebook::react::TextAlignment::Natural:
-        alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
-        break;
-      default:
-        assert(false);
-    }
+DWRITE_FONT_STYLE GetFontStyle(const TextAttributes &attributes) noexcept {
+  if (attributes.fontStyle == facebook::react::FontStyle::Italic)
+    return DWRITE_FONT_STYLE_ITALIC;
+  if (attributes.fontStyle == facebook::react::FontStyle::Oblique)
+    return DWRITE_FONT_STYLE_OBLIQUE;
+  return DWRITE_FONT_STYLE_NORMAL;
+}
+
+DWRITE_FONT_WEIGHT GetFontWeight(const TextAttributes &attributes) noexcept {
+  return static_cast<DWRITE_FONT_WEIGHT>(
+      attributes.fontWeight.value_or(static_cast<facebook::react::FontWeight>(DWRITE_FONT_WEIGHT_REGULAR)));
+}
+
+std::wstring GetFontFamily(const std::string &fontFamily) {
+  return fontFamily.empty() ? L"Segoe UI" : Microsoft::Common::Unicode::Utf8ToUtf16(fontFamily);
+}
+
+DWRITE_TEXT_ALIGNMENT GetDWriteTextAlignment(const std::optional<TextAlignment> &textAlignment) noexcept {
+  if (!textAlignment)
+    return DWRITE_TEXT_ALIGNMENT_LEADING;
+
+  switch (*textAlignment) {
+    case facebook::react::TextAlignment::Center:
+      return DWRITE_TEXT_ALIGNMENT_CENTER;
+    case facebook::react::TextAlignment::Justified:
+      return DWRITE_TEXT_ALIGNMENT_JUSTIFIED;
+    case facebook::react::TextAlignment::Left:
+      return DWRITE_TEXT_ALIGNMENT_LEADING;
+    case facebook::react::TextAlignment::Right:
+      return DWRITE_TEXT_ALIGNMENT_TRAILING;
+    // TODO use LTR values
+    case facebook::react::TextAlignment::Natural:
+      return DWRITE_TEXT_ALIGNMENT_LEADING;
+    default:
+      assert(false);
+      return DWRITE_TEXT_ALIGNMENT_LEADING;
   }
-  winrt::check_hresult(spTextFormat->SetTextAlignment(alignment));
+}
+
+winrt::com_ptr<IDWriteTextFormat> GetTextFormat(const TextAttributes &attributes) {
+  TextFormatCacheKey key{
+      attributes.fontFamily,
+      static_cast<FontWeight>(GetFontWeight(attributes)),
+      attributes.fontStyle.value_or(facebook::react::FontStyle::Normal),
+      attributes.fontSize};
+
+  return GetTextFormatCache().get(key, [&attributes](const TextFormatCacheKey &key) {
+    winrt::com_ptr<IDWriteTextFormat> spTextFormat;
+    winrt::check_hresult(Microsoft::ReactNative::DWriteFactory()->CreateTextFormat(
+        GetFontFamily(key.fontFamily).c_str(),
+        nullptr, // Font collection (nullptr sets it to use the system font collection).
+        GetFontWeight(attributes),
+        GetFontStyle(attributes),
+        DWRITE_FONT_STRETCH_NORMAL,
+        key.fontSize,
+        L"",
+        spTextFormat.put()));
+    return spTextFormat;
+  });
+}
+
+winrt::com_ptr<IDWriteTextLayout> CreateTextLayout(
+    const AttributedString &attributedString,
+    const std::optional<TextAlignment> &textAlignment,
+    Float maximumWidth,
+    Float maximumHeight) {
+  const auto &fragments = attributedString.getFragments();
+  auto spTextFormat = GetTextFormat(fragments[0].textAttributes);
 
-  auto str = Microsoft::Common::Unicode::Utf8ToUtf16(attributedStringBox.getValue().getString());
+  auto str = Microsoft::Common::Unicode::Utf8ToUtf16(attributedString.getString());
 
+  winrt::com_ptr<IDWriteTextLayout> spTextLayout;
   winrt::check_hresult(Microsoft::ReactNative::DWriteFactory()->CreateTextLayout(
       str.c_str(), // The string to be laid out and formatted.
       static_cast<UINT32>(str.length()), // The length of the string.
       spTextFormat.get(), // The text format to apply to the string (contains font information, etc).
-      layoutConstraints.maximumSize.width, // The width of the layout box.
-      layoutConstraints.maximumSize.height, // The height of the layout box.
+      maximumWidth, // The width of the layout box.
+      maximumHeight, // The height of the layout box.
       spTextLayout.put() // The IDWriteTextLayout interface pointer.
       ));
 
+  // The alignment is set on the layout so that the text format can be shared.
+  winrt::check_hresult(spTextLayout->SetTextAlignment(GetDWriteTextAlignment(textAlignment)));
+
   unsigned int position = 0;
   unsigned int length = 0;
   for (const auto &fragment : fragments) {
     length = static_cast<UINT32>(fragment.string.length());
     DWRITE_TEXT_RANGE range = {position, length};
-    TextAttributes attributes = fragment.textAttributes;
-    DWRITE_FONT_STYLE fragmentStyle = DWRITE_FONT_STYLE_NORMAL;
-    if (attributes.fontStyle == facebook::react::FontStyle::Italic)
-      fragmentStyle = DWRITE_FONT_STYLE_ITALIC;
-    else if (attributes.fontStyle == facebook::react::FontStyle::Oblique)
-      fragmentStyle = DWRITE_FONT_STYLE_OBLIQUE;
-
-    winrt::check_hresult(spTextLayout->SetFontFamilyName(
-        attributes.fontFamily.empty() ? L"Segoe UI"
-                                      : Microsoft::Common::Unicode::Utf8ToUtf16(attributes.fontFamily).c_str(),
-        range));
-    winrt::check_hresult(spTextLayout->SetFontWeight(
-        static_cast<DWRITE_FONT_WEIGHT>(
-            attributes.fontWeight.value_or(static_cast<facebook::react::FontWeight>(DWRITE_FONT_WEIGHT_REGULAR))),
-        range));
-    winrt::check_hresult(spTextLayout->SetFontStyle(fragmentStyle, range));
+    const TextAttributes &attributes = fragment.textAttributes;
+
+    winrt::check_hresult(spTextLayout->SetFontFamilyName(GetFontFamily(attributes.fontFamily).c_str(), range));
+    winrt::check_hresult(spTextLayout->SetFontWeight(GetFontWeight(attributes), range));
+    winrt::check_hresult(spTextLayout->SetFontStyle(GetFontStyle(attributes), range));
     winrt::check_hresult(spTextLayout->SetFontSize(attributes.fontSize, range));
 
     position += length;
   }
+
+  return spTextLayout;
 }
 
-TextMeasurement TextLayoutManager::measure(
+} // namespace
+
+void TextLayoutManager::GetTextLayout(
     AttributedStringBox attributedStringBox,
     ParagraphAttributes paragraphAttributes,
-    LayoutConstraints layoutConstraints) const {
-  winrt::com_ptr<IDWriteTextLayout> spTextLayout;
+    LayoutConstraints layoutConstraints,
+    const std::optional<TextAlignment> &textAlignment,
+    winrt::com_ptr<IDWriteTextLayout> &spTextLayout) noexcept {
+  if (attributedStringBox.getValue().isEmpty())
+    return;
 
-  GetTextLayout(attributedStringBox, paragraphAttributes, layoutConstraints, TextAlignment::Left, spTextLayout);
+  spTextLayout = CreateTextLayout(
+      attributedStringBox.getValue(),
+      textAlignment,
+      layoutConstraints.maximumSize.width,
+      layoutConstraints.maximumSize.height);
+}
 
-  TextMeasurement tm{};
-  if (spTextLayout) {
-    DWRITE_TEXT_METRICS dtm{};
-    winrt::check_hresult(spTextLayout->GetMetrics(&dtm));
-    tm.size = {dtm.width, dtm.height};
-  }
-  return tm;
+TextMeasurement TextLayoutManager::measure(
+    AttributedStringBox attributedStringBox,
+    ParagraphAttributes paragraphAttributes,
+    LayoutConstraints layoutConstraints) const {
+  if (attributedStringBox.getValue().isEmpty())
+    return {};
+
+  return m_measureCache.get(
+      {attributedStringBox.getValue(), paragraphAttributes, layoutConstraints}, [](const TextMeasureCacheKey &key) {
+        // The alignment does not change the metrics of the text.
+        auto spTextLayout = CreateTextLayout(
+            key.attributedString,
+            std::nullopt,
+            key.layoutConstraints.maximumSize.width,
+            key.layoutConstraints.maximumSize.height);
+
+        DWRITE_TEXT_METRICS dtm{};
+        winrt::check_hresult(spTextLayout->GetMetrics(&dtm));
+        TextMeasurement measurement{};
+        measurement.size = {dtm.width, dtm.height};
+        return measurement;
+      });
 }
 
 /**
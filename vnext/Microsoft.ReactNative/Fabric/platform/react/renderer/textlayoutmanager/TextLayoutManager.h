@@ -71,6 +71,10 @@ class TextLayoutManager {
 
  private:
   ContextContainer::Shared m_contextContainer;
+
+  // Only measurements are shared. Each ParagraphComponentView creates its own layout, because it applies the drawing
+  // attributes to the layout before it draws it.
+  TextMeasureCache m_measureCache{};
 };
 
 } // namespace react
@@ -8,6 +8,10 @@
 #include <UI.Xaml.Media.h>
 #include <Views/ShadowNodeBase.h>
 #include <cxxreact/SystraceSection.h>
+#include <ParallelYogaLayout.h>
+#include <array>
+#include <charconv>
+#include <string_view>
 #include "Modules/I18nManagerModule.h"
 #include "NativeUIManager.h"
 
@@ -26,19 +30,22 @@ using namespace xaml::Media;
 } // namespace winrt
 
 using namespace facebook::react;
+using Microsoft::React::ParallelYogaLayout;
 
 namespace Microsoft::ReactNative {
 
-static YogaNodePtr make_yoga_node(YGConfigRef config) {
-  YogaNodePtr result(YGNodeNewWithConfig(config));
-  return result;
-}
-
 static inline bool YogaFloatEquals(float x, float y) {
   // Epsilon value of 0.0001f is taken from the YGFloatsEqual method in Yoga.
   return std::fabs(x - y) < 0.0001f;
 };
 
+// Calls the view manager measure function stored in the Yoga context. ParallelYogaLayout runs it in the UI thread.
+static YGSize
+MeasureYogaNode(YGNodeRef node, float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode) {
+  auto context = reinterpret_cast<YogaContext *>(YGNodeGetContext(node));
+  return ParallelYogaLayout::Measure(context->measureFunc, node, width, widthMode, height, heightMode);
+}
+
 #if defined(_DEBUG)
 static int YogaLog(
     const YGConfigRef /*config*/,
@@ -225,7 +232,7 @@ void NativeUIManager::AddRootView(ShadowNode &shadowNode, facebook::react::IReac
   view.as<xaml::FrameworkElement>().FlowDirection(
       I18nManager::IsRTL(m_context.Properties()) ? xaml::FlowDirection::RightToLeft : xaml::FlowDirection::LeftToRight);
 
-  m_tagsToYogaNodes.emplace(shadowNode.m_tag, make_yoga_node(m_yogaConfig));
+  m_tagsToYogaNodes.emplace(shadowNode.m_tag, m_yogaNodePool.MakeNode(m_yogaConfig));
 
   auto element = view.as<xaml::FrameworkElement>();
   Microsoft::ReactNative::SetTag(element, shadowNode.m_tag);
@@ -272,9 +279,12 @@ static float NumberOrDefault(const winrt::Microsoft::ReactNative::JSValue &value
     result = value.AsSingle();
   else if (value.IsNull())
     result = defaultValue;
-  else if (value.Type() == winrt::Microsoft::ReactNative::JSValueType::String)
-    result = std::stof(value.AsString());
-  else
+  else if (value.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    // Unlike std::stof, std::from_chars does not throw and does not depend on the current locale.
+    // The result keeps the default value if the string is not a number.
+    const std::string &str = value.AsString();
+    std::from_chars(str.data(), str.data() + str.size(), result);
+  } else
     assert(false);
 
   return result;
@@ -405,6 +415,179 @@ static void SetYogaValueAutoHelper(
   }
 }
 
+// Yoga style props handled by StyleYogaNode.
+enum class YogaStyleProp : uint8_t {
+  Unknown,
+  FlexDirection,
+  JustifyContent,
+  FlexWrap,
+  AlignItems,
+  AlignSelf,
+  AlignContent,
+  Flex,
+  FlexGrow,
+  FlexShrink,
+  FlexBasis,
+  Position,
+  Overflow,
+  Display,
+  Direction,
+  AspectRatio,
+  Left,
+  Top,
+  Right,
+  Bottom,
+  End,
+  Start,
+  Width,
+  MinWidth,
+  MaxWidth,
+  Height,
+  MinHeight,
+  MaxHeight,
+  Margin,
+  MarginLeft,
+  MarginStart,
+  MarginTop,
+  MarginRight,
+  MarginEnd,
+  MarginBottom,
+  MarginHorizontal,
+  MarginVertical,
+  Padding,
+  PaddingLeft,
+  PaddingStart,
+  PaddingTop,
+  PaddingRight,
+  PaddingEnd,
+  PaddingBottom,
+  PaddingHorizontal,
+  PaddingVertical,
+  BorderWidth,
+  BorderLeftWidth,
+  BorderStartWidth,
+  BorderTopWidth,
+  BorderRightWidth,
+  BorderEndWidth,
+  BorderBottomWidth,
+};
+
+struct YogaStylePropName {
+  std::string_view Name;
+  YogaStyleProp Prop;
+};
+
+static constexpr YogaStylePropName s_yogaStylePropNames[] = {
+    {"flexDirection", YogaStyleProp::FlexDirection},
+    {"justifyContent", YogaStyleProp::JustifyContent},
+    {"flexWrap", YogaStyleProp::FlexWrap},
+    {"alignItems", YogaStyleProp::AlignItems},
+    {"alignSelf", YogaStyleProp::AlignSelf},
+    {"alignContent", YogaStyleProp::AlignContent},
+    {"flex", YogaStyleProp::Flex},
+    {"flexGrow", YogaStyleProp::FlexGrow},
+    {"flexShrink", YogaStyleProp::FlexShrink},
+    {"flexBasis", YogaStyleProp::FlexBasis},
+    {"position", YogaStyleProp::Position},
+    {"overflow", YogaStyleProp::Overflow},
+    {"display", YogaStyleProp::Display},
+    {"direction", YogaStyleProp::Direction},
+    {"aspectRatio", YogaStyleProp::AspectRatio},
+    {"left", YogaStyleProp::Left},
+    {"top", YogaStyleProp::Top},
+    {"right", YogaStyleProp::Right},
+    {"bottom", YogaStyleProp::Bottom},
+    {"end", YogaStyleProp::End},
+    {"start", YogaStyleProp::Start},
+    {"width", YogaStyleProp::Width},
+    {"minWidth", YogaStyleProp::MinWidth},
+    {"maxWidth", YogaStyleProp::MaxWidth},
+    {"height", YogaStyleProp::Height},
+    {"minHeight", YogaStyleProp::MinHeight},
+    {"maxHeight", YogaStyleProp::MaxHeight},
+    {"margin", YogaStyleProp::Margin},
+    {"marginLeft", YogaStyleProp::MarginLeft},
+    {"marginStart", YogaStyleProp::MarginStart},
+    {"marginTop", YogaStyleProp::MarginTop},
+    {"marginRight", YogaStyleProp::MarginRight},
+    {"marginEnd", YogaStyleProp::MarginEnd},
+    {"marginBottom", YogaStyleProp::MarginBottom},
+    {"marginHorizontal", YogaStyleProp::MarginHorizontal},
+    {"marginVertical", YogaStyleProp::MarginVertical},
+    {"padding", YogaStyleProp::Padding},
+    {"paddingLeft", YogaStyleProp::PaddingLeft},
+    {"paddingStart", YogaStyleProp::PaddingStart},
+    {"paddingTop", YogaStyleProp::PaddingTop},
+    {"paddingRight", YogaStyleProp::PaddingRight},
+    {"paddingEnd", YogaStyleProp::PaddingEnd},
+    {"paddingBottom", YogaStyleProp::PaddingBottom},
+    {"paddingHorizontal", YogaStyleProp::PaddingHorizontal},
+    {"paddingVertical", YogaStyleProp::PaddingVertical},
+    {"borderWidth", YogaStyleProp::BorderWidth},
+    {"borderLeftWidth", YogaStyleProp::BorderLeftWidth},
+    {"borderStartWidth", YogaStyleProp::BorderStartWidth},
+    {"borderTopWidth", YogaStyleProp::BorderTopWidth},
+    {"borderRightWidth", YogaStyleProp::BorderRightWidth},
+    {"borderEndWidth", YogaStyleProp::BorderEndWidth},
+    {"borderBottomWidth", YogaStyleProp::BorderBottomWidth},
+};
+
+static constexpr uint32_t YogaStylePropHash(std::string_view name, uint32_t seed) noexcept {
+  // FNV-1a hash mixed with the seed.
+  uint32_t hash = 2166136261u ^ seed;
+  for (char ch : name) {
+    hash ^= static_cast<uint8_t>(ch);
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+// Perfect hash table for the style prop names: every name has its own slot.
+// The hash seed that gives no collisions is found at compile time.
+struct YogaStylePropTable {
+  static constexpr uint32_t Size = 512;
+  static constexpr uint32_t MaxSeed = 10000;
+
+  uint32_t Seed{0};
+  bool IsPerfect{false};
+  std::array<uint8_t, Size> Slots{}; // Index in s_yogaStylePropNames plus one, or zero for an empty slot.
+};
+
+static_assert(std::size(s_yogaStylePropNames) < 256, "Slots store name indexes as uint8_t");
+
+static constexpr YogaStylePropTable MakeYogaStylePropTable() noexcept {
+  for (uint32_t seed = 0; seed < YogaStylePropTable::MaxSeed; ++seed) {
+    YogaStylePropTable table{};
+    table.Seed = seed;
+    table.IsPerfect = true;
+    for (size_t i = 0; i < std::size(s_yogaStylePropNames) && table.IsPerfect; ++i) {
+      uint8_t &slot = table.Slots[YogaStylePropHash(s_yogaStylePropNames[i].Name, seed) % YogaStylePropTable::Size];
+      table.IsPerfect = (slot == 0);
+      slot = static_cast<uint8_t>(i + 1);
+    }
+
+    if (table.IsPerfect) {
+      return table;
+    }
+  }
+
+  return YogaStylePropTable{};
+}
+
+static constexpr YogaStylePropTable s_yogaStylePropTable = MakeYogaStylePropTable();
+static_assert(s_yogaStylePropTable.IsPerfect, "Cannot find a perfect hash seed. Are there duplicate style prop names?");
+
+static YogaStyleProp GetYogaStyleProp(std::string_view key) noexcept {
+  uint8_t slot =
+      s_yogaStylePropTable.Slots[YogaStylePropHash(key, s_yogaStylePropTable.Seed) % YogaStylePropTable::Size];
+  if (slot != 0 && s_yogaStylePropNames[slot - 1].Name == key) {
+    return s_yogaStylePropNames[slot - 1].Prop;
+  }
+
+  return YogaStyleProp::Unknown;
+}
+
 static void StyleYogaNode(
     ShadowNodeBase &shadowNode,
     const YGNodeRef yogaNode,
@@ -413,354 +596,466 @@ static void StyleYogaNode(
     const std::string &key = pair.first;
     const auto &value = pair.second;
 
-    if (key == "flexDirection") {
-      YGFlexDirection direction = YGFlexDirectionColumn;
-
-      if (value == "column" || value.IsNull())
-        direction = YGFlexDirectionColumn;
-      else if (value == "row")
-        direction = YGFlexDirectionRow;
-      else if (value == "column-reverse")
-        direction = YGFlexDirectionColumnReverse;
-      else if (value == "row-reverse")
-        direction = YGFlexDirectionRowReverse;
-      else
-        assert(false);
+    switch (GetYogaStyleProp(key)) {
+      case YogaStyleProp::FlexDirection: {
+        YGFlexDirection direction = YGFlexDirectionColumn;
+
+        if (value == "column" || value.IsNull())
+          direction = YGFlexDirectionColumn;
+        else if (value == "row")
+          direction = YGFlexDirectionRow;
+        else if (value == "column-reverse")
+          direction = YGFlexDirectionColumnReverse;
+        else if (value == "row-reverse")
+          direction = YGFlexDirectionRowReverse;
+        else
+          assert(false);
+
+        YGNodeStyleSetFlexDirection(yogaNode, direction);
+        break;
+      }
+      case YogaStyleProp::JustifyContent: {
+        YGJustify justify = YGJustifyFlexStart;
+
+        if (value == "flex-start" || value.IsNull())
+          justify = YGJustifyFlexStart;
+        else if (value == "flex-end")
+          justify = YGJustifyFlexEnd;
+        else if (value == "center")
+          justify = YGJustifyCenter;
+        else if (value == "space-between")
+          justify = YGJustifySpaceBetween;
+        else if (value == "space-around")
+          justify = YGJustifySpaceAround;
+        else if (value == "space-evenly")
+          justify = YGJustifySpaceEvenly;
+        else
+          assert(false);
+
+        YGNodeStyleSetJustifyContent(yogaNode, justify);
+        break;
+      }
+      case YogaStyleProp::FlexWrap: {
+        YGWrap wrap = YGWrapNoWrap;
+
+        if (value == "nowrap" || value.IsNull())
+          wrap = YGWrapNoWrap;
+        else if (value == "wrap")
+          wrap = YGWrapWrap;
+        else if (value == "wrap-reverse")
+          wrap = YGWrapWrapReverse;
+        else
+          assert(false);
+
+        YGNodeStyleSetFlexWrap(yogaNode, wrap);
+        break;
+      }
+      case YogaStyleProp::AlignItems: {
+        YGAlign align = YGAlignStretch;
+
+        if (value == "stretch" || value.IsNull())
+          align = YGAlignStretch;
+        else if (value == "flex-start")
+          align = YGAlignFlexStart;
+        else if (value == "flex-end")
+          align = YGAlignFlexEnd;
+        else if (value == "center")
+          align = YGAlignCenter;
+        else if (value == "baseline")
+          align = YGAlignBaseline;
+        else
+          assert(false);
+
+        YGNodeStyleSetAlignItems(yogaNode, align);
+        break;
+      }
+      case YogaStyleProp::AlignSelf: {
+        YGAlign align = YGAlignAuto;
+
+        if (value == "auto" || value.IsNull())
+          align = YGAlignAuto;
+        else if (value == "stretch")
+          align = YGAlignStretch;
+        else if (value == "flex-start")
+          align = YGAlignFlexStart;
+        else if (value == "flex-end")
+          align = YGAlignFlexEnd;
+        else if (value == "center")
+          align = YGAlignCenter;
+        else if (value == "baseline")
+          align = YGAlignBaseline;
+        else
+          assert(false);
+
+        YGNodeStyleSetAlignSelf(yogaNode, align);
+        break;
+      }
+      case YogaStyleProp::AlignContent: {
+        YGAlign align = YGAlignFlexStart;
+
+        if (value == "stretch")
+          align = YGAlignStretch;
+        else if (value == "flex-start" || value.IsNull())
+          align = YGAlignFlexStart;
+        else if (value == "flex-end")
+          align = YGAlignFlexEnd;
+        else if (value == "center")
+          align = YGAlignCenter;
+        else if (value == "space-between")
+          align = YGAlignSpaceBetween;
+        else if (value == "space-around")
+          align = YGAlignSpaceAround;
+        else
+          assert(false);
+
+        YGNodeStyleSetAlignContent(yogaNode, align);
+        break;
+      }
+      case YogaStyleProp::Flex: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      YGNodeStyleSetFlexDirection(yogaNode, direction);
-    } else if (key == "justifyContent") {
-      YGJustify justify = YGJustifyFlexStart;
-
-      if (value == "flex-start" || value.IsNull())
-        justify = YGJustifyFlexStart;
-      else if (value == "flex-end")
-        justify = YGJustifyFlexEnd;
-      else if (value == "center")
-        justify = YGJustifyCenter;
-      else if (value == "space-between")
-        justify = YGJustifySpaceBetween;
-      else if (value == "space-around")
-        justify = YGJustifySpaceAround;
-      else if (value == "space-evenly")
-        justify = YGJustifySpaceEvenly;
-      else
-        assert(false);
+        YGNodeStyleSetFlex(yogaNode, result);
+        break;
+      }
+      case YogaStyleProp::FlexGrow: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      YGNodeStyleSetJustifyContent(yogaNode, justify);
-    } else if (key == "flexWrap") {
-      YGWrap wrap = YGWrapNoWrap;
-
-      if (value == "nowrap" || value.IsNull())
-        wrap = YGWrapNoWrap;
-      else if (value == "wrap")
-        wrap = YGWrapWrap;
-      else if (value == "wrap-reverse")
-        wrap = YGWrapWrapReverse;
-      else
-        assert(false);
+        YGNodeStyleSetFlexGrow(yogaNode, result);
+        break;
+      }
+      case YogaStyleProp::FlexShrink: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      YGNodeStyleSetFlexWrap(yogaNode, wrap);
-    } else if (key == "alignItems") {
-      YGAlign align = YGAlignStretch;
-
-      if (value == "stretch" || value.IsNull())
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
+        YGNodeStyleSetFlexShrink(yogaNode, result);
+        break;
+      }
+      case YogaStyleProp::FlexBasis: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetAlignItems(yogaNode, align);
-    } else if (key == "alignSelf") {
-      YGAlign align = YGAlignAuto;
-
-      if (value == "auto" || value.IsNull())
-        align = YGAlignAuto;
-      else if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
+        SetYogaUnitValueAutoHelper(
+            yogaNode, result, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
+        break;
+      }
+      case YogaStyleProp::Position: {
+        YGPositionType position = YGPositionTypeRelative;
+
+        if (value == "relative" || value.IsNull())
+          position = YGPositionTypeRelative;
+        else if (value == "absolute")
+          position = YGPositionTypeAbsolute;
+        else if (value == "static")
+          position = YGPositionTypeStatic;
+        else
+          assert(false);
+
+        YGNodeStyleSetPositionType(yogaNode, position);
+        break;
+      }
+      case YogaStyleProp::Overflow: {
+        YGOverflow overflow = YGOverflowVisible;
+        if (value == "visible" || value.IsNull())
+          overflow = YGOverflowVisible;
+        else if (value == "hidden")
+          overflow = YGOverflowHidden;
+        else if (value == "scroll")
+          overflow = YGOverflowScroll;
+
+        YGNodeStyleSetOverflow(yogaNode, overflow);
+        break;
+      }
+      case YogaStyleProp::Display: {
+        YGDisplay display = YGDisplayFlex;
+        if (value == "flex" || value.IsNull())
+          display = YGDisplayFlex;
+        else if (value == "none")
+          display = YGDisplayNone;
+
+        YGNodeStyleSetDisplay(yogaNode, display);
+        break;
+      }
+      case YogaStyleProp::Direction: {
+        // https://github.com/microsoft/react-native-windows/issues/4668
+        // In order to support the direction property, we tell yoga to always layout
+        // in LTR direction, then push the appropriate FlowDirection into XAML.
+        // This way XAML handles flipping in RTL mode, which works both for RN components
+        // as well as native components that have purely XAML sub-trees (eg ComboBox).
+        YGDirection direction = YGDirectionLTR;
+
+        YGNodeStyleSetDirection(yogaNode, direction);
+        break;
+      }
+      case YogaStyleProp::AspectRatio: {
+        float result = NumberOrDefault(value, 1.0f /*default*/);
 
-      YGNodeStyleSetAlignSelf(yogaNode, align);
-    } else if (key == "alignContent") {
-      YGAlign align = YGAlignFlexStart;
-
-      if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start" || value.IsNull())
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "space-between")
-        align = YGAlignSpaceBetween;
-      else if (value == "space-around")
-        align = YGAlignSpaceAround;
-      else
-        assert(false);
+        YGNodeStyleSetAspectRatio(yogaNode, result);
+        break;
+      }
+      case YogaStyleProp::Left: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetAlignContent(yogaNode, align);
-    } else if (key == "flex") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlex(yogaNode, result);
-    } else if (key == "flexGrow") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlexGrow(yogaNode, result);
-    } else if (key == "flexShrink") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlexShrink(yogaNode, result);
-    } else if (key == "flexBasis") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
-    } else if (key == "position") {
-      YGPositionType position = YGPositionTypeRelative;
-
-      if (value == "relative" || value.IsNull())
-        position = YGPositionTypeRelative;
-      else if (value == "absolute")
-        position = YGPositionTypeAbsolute;
-      else if (value == "static")
-        position = YGPositionTypeStatic;
-      else
-        assert(false);
+        SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
+      }
+      case YogaStyleProp::Top: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetPositionType(yogaNode, position);
-    } else if (key == "overflow") {
-      YGOverflow overflow = YGOverflowVisible;
-      if (value == "visible" || value.IsNull())
-        overflow = YGOverflowVisible;
-      else if (value == "hidden")
-        overflow = YGOverflowHidden;
-      else if (value == "scroll")
-        overflow = YGOverflowScroll;
-
-      YGNodeStyleSetOverflow(yogaNode, overflow);
-    } else if (key == "display") {
-      YGDisplay display = YGDisplayFlex;
-      if (value == "flex" || value.IsNull())
-        display = YGDisplayFlex;
-      else if (value == "none")
-        display = YGDisplayNone;
-
-      YGNodeStyleSetDisplay(yogaNode, display);
-    } else if (key == "direction") {
-      // https://github.com/microsoft/react-native-windows/issues/4668
-      // In order to support the direction property, we tell yoga to always layout
-      // in LTR direction, then push the appropriate FlowDirection into XAML.
-      // This way XAML handles flipping in RTL mode, which works both for RN components
-      // as well as native components that have purely XAML sub-trees (eg ComboBox).
-      YGDirection direction = YGDirectionLTR;
-
-      YGNodeStyleSetDirection(yogaNode, direction);
-    } else if (key == "aspectRatio") {
-      float result = NumberOrDefault(value, 1.0f /*default*/);
-
-      YGNodeStyleSetAspectRatio(yogaNode, result);
-    } else if (key == "left") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "top") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "right") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "bottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "end") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "start") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "width") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
-    } else if (key == "minWidth") {
-      YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent);
-    } else if (key == "maxWidth") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent);
-    } else if (key == "height") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
-    } else if (key == "minHeight") {
-      YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent);
-    } else if (key == "maxHeight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent);
-    } else if (key == "margin") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeAll, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginLeft") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeLeft, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginStart") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeStart, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginTop") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeTop, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeRight, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginEnd") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeEnd, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginBottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeBottom, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginHorizontal") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeHorizontal,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "marginVertical") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeVertical,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "padding") {
-      if (!shadowNode.ImplementsPadding()) {
+        SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
+      }
+      case YogaStyleProp::Right: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeAll, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
       }
-    } else if (key == "paddingLeft") {
-      if (!shadowNode.ImplementsPadding()) {
+      case YogaStyleProp::Bottom: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
       }
-    } else if (key == "paddingStart") {
-      if (!shadowNode.ImplementsPadding()) {
+      case YogaStyleProp::End: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
       }
-    } else if (key == "paddingTop") {
-      if (!shadowNode.ImplementsPadding()) {
+      case YogaStyleProp::Start: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
       }
-    } else if (key == "paddingRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+      case YogaStyleProp::Width: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-    } else if (key == "paddingEnd") {
-      if (!shadowNode.ImplementsPadding()) {
+        SetYogaUnitValueAutoHelper(
+            yogaNode, result, YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
+        break;
+      }
+      case YogaStyleProp::MinWidth: {
+        YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent);
+        break;
+      }
+      case YogaStyleProp::MaxWidth: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent);
+        break;
       }
-    } else if (key == "paddingBottom") {
-      if (!shadowNode.ImplementsPadding()) {
+      case YogaStyleProp::Height: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaUnitValueAutoHelper(
+            yogaNode, result, YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
+        break;
+      }
+      case YogaStyleProp::MinHeight: {
+        YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent);
+        break;
       }
-    } else if (key == "paddingHorizontal") {
-      if (!shadowNode.ImplementsPadding()) {
+      case YogaStyleProp::MaxHeight: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeHorizontal, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent);
+        break;
       }
-    } else if (key == "paddingVertical") {
-      if (!shadowNode.ImplementsPadding()) {
+      case YogaStyleProp::Margin: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeVertical, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeAll, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
       }
-    } else if (key == "borderWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+      case YogaStyleProp::MarginLeft: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeAll, result);
-    } else if (key == "borderLeftWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeLeft, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case YogaStyleProp::MarginStart: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeLeft, result);
-    } else if (key == "borderStartWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeStart, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case YogaStyleProp::MarginTop: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeStart, result);
-    } else if (key == "borderTopWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeTop, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case YogaStyleProp::MarginRight: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeTop, result);
-    } else if (key == "borderRightWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeRight, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case YogaStyleProp::MarginEnd: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeEnd, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case YogaStyleProp::MarginBottom: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueAutoHelper(
+            yogaNode,
+            YGEdgeBottom,
+            result,
+            YGNodeStyleSetMargin,
+            YGNodeStyleSetMarginPercent,
+            YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case YogaStyleProp::MarginHorizontal: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueAutoHelper(
+            yogaNode,
+            YGEdgeHorizontal,
+            result,
+            YGNodeStyleSetMargin,
+            YGNodeStyleSetMarginPercent,
+            YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case YogaStyleProp::MarginVertical: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueAutoHelper(
+            yogaNode,
+            YGEdgeVertical,
+            result,
+            YGNodeStyleSetMargin,
+            YGNodeStyleSetMarginPercent,
+            YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case YogaStyleProp::Padding: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeRight, result);
-    } else if (key == "borderEndWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+          SetYogaValueHelper(yogaNode, YGEdgeAll, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case YogaStyleProp::PaddingLeft: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeEnd, result);
-    } else if (key == "borderBottomWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+          SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case YogaStyleProp::PaddingStart: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case YogaStyleProp::PaddingTop: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case YogaStyleProp::PaddingRight: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        break;
+      }
+      case YogaStyleProp::PaddingEnd: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case YogaStyleProp::PaddingBottom: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case YogaStyleProp::PaddingHorizontal: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeHorizontal, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case YogaStyleProp::PaddingVertical: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeVertical, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case YogaStyleProp::BorderWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeBottom, result);
+        YGNodeStyleSetBorder(yogaNode, YGEdgeAll, result);
+        break;
+      }
+      case YogaStyleProp::BorderLeftWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeLeft, result);
+        break;
+      }
+      case YogaStyleProp::BorderStartWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeStart, result);
+        break;
+      }
+      case YogaStyleProp::BorderTopWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeTop, result);
+        break;
+      }
+      case YogaStyleProp::BorderRightWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeRight, result);
+        break;
+      }
+      case YogaStyleProp::BorderEndWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeEnd, result);
+        break;
+      }
+      case YogaStyleProp::BorderBottomWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeBottom, result);
+        break;
+      }
+      case YogaStyleProp::Unknown:
+        break;
     }
   }
 }
@@ -776,16 +1071,18 @@ void NativeUIManager::CreateView(ShadowNode &shadowNode, React::JSValueObject &p
       m_extraLayoutNodes.push_back(node.m_tag);
     }
 
-    auto result = m_tagsToYogaNodes.emplace(node.m_tag, make_yoga_node(m_yogaConfig));
+    auto result = m_tagsToYogaNodes.try_emplace(node.m_tag);
     if (result.second == true) {
+      result.first->second = m_yogaNodePool.MakeNode(m_yogaConfig);
       YGNodeRef yogaNode = result.first->second.get();
       StyleYogaNode(node, yogaNode, props);
 
       YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
       if (func != nullptr) {
-        YGNodeSetMeasureFunc(yogaNode, func);
+        // The view manager function is called through ParallelYogaLayout::Measure to run it in the UI thread.
+        YGNodeSetMeasureFunc(yogaNode, MeasureYogaNode);
 
-        auto context = std::make_unique<Microsoft::ReactNative::YogaContext>(node.GetView());
+        auto context = std::make_unique<Microsoft::ReactNative::YogaContext>(node.GetView(), func);
         YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
 
         m_tagsToYogaContext.emplace(node.m_tag, std::move(context));
@@ -829,7 +1126,12 @@ void NativeUIManager::RemoveView(ShadowNode &shadowNode, bool removeChildren /*=
     }
   }
 
-  m_tagsToYogaNodes.erase(node.m_tag);
+  auto it = m_tagsToYogaNodes.find(node.m_tag);
+  if (it != m_tagsToYogaNodes.end()) {
+    m_yogaNodePool.RecycleNode(std::move(it->second));
+    m_tagsToYogaNodes.erase(it);
+  }
+
   m_tagsToYogaContext.erase(node.m_tag);
 }
 
@@ -843,7 +1145,7 @@ void NativeUIManager::ReplaceView(ShadowNode &shadowNode) {
       YGNodeRef yogaNode = it->second.get();
 
       if (pViewManager->IsNativeControlWithSelfLayout()) {
-        auto context = std::make_unique<YogaContext>(node.GetView());
+        auto context = std::make_unique<YogaContext>(node.GetView(), pViewManager->GetYogaCustomMeasureFunc());
         YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
 
         m_tagsToYogaContext.erase(node.m_tag);
@@ -886,66 +1188,112 @@ void NativeUIManager::DoLayout() {
   }
 
   auto &rootTags = m_host->GetAllRootTags();
+  std::vector<ParallelYogaLayout::Root> roots;
+  roots.reserve(rootTags.size());
   for (int64_t rootTag : rootTags) {
     ShadowNodeBase &rootShadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(rootTag));
     const auto rootElement = rootShadowNode.GetView().as<xaml::FrameworkElement>();
     float actualWidth = static_cast<float>(rootElement.ActualWidth());
     float actualHeight = static_cast<float>(rootElement.ActualHeight());
-    ApplyLayout(rootTag, actualWidth, actualHeight);
+    if (YGNodeRef rootNode = GetYogaNode(rootTag)) {
+      roots.push_back({rootNode, actualWidth, actualHeight});
+    } else {
+      assert(false);
+    }
+  }
+
+  // Yoga trees of the root views are independent. If more than one of them must be laid out,
+  // then we calculate them in parallel and apply the results in the UI thread.
+  const auto dirtyRootCount =
+      std::count_if(roots.begin(), roots.end(), [](const auto &root) { return YGNodeIsDirty(root.Node); });
+  if (dirtyRootCount > 1) {
+    ParallelYogaLayout::Calculate(std::move(roots));
+  } else {
+    for (const auto &root : roots) {
+      ParallelYogaLayout::CalculateLayout(root);
+    }
+  }
+
+  for (int64_t rootTag : rootTags) {
+    if (GetYogaNode(rootTag)) {
+      UpdateLayoutProps(rootTag);
+    }
   }
 }
 
 void NativeUIManager::ApplyLayout(int64_t tag, float width, float height) {
   if (YGNodeRef rootNode = GetYogaNode(tag)) {
-    SystraceSection s("NativeUIManager::DoLayout::YGNodeCalculateLayout");
-    // We must always run layout in LTR mode, which might seem unintuitive.
-    // We will flip the root of the tree into RTL by forcing the root XAML node's FlowDirection to RightToLeft
-    // which will inherit down the XAML tree, allowing all native controls to pick it up.
-    YGNodeCalculateLayout(rootNode, width, height, YGDirectionLTR);
+    ParallelYogaLayout::CalculateLayout({rootNode, width, height});
   } else {
     assert(false);
     return;
   }
 
-  {
-    SystraceSection s("NativeUIManager::DoLayout::SetLayoutProps");
-    SetLayoutPropsRecursive(tag);
-  }
+  UpdateLayoutProps(tag);
+}
+
+void NativeUIManager::UpdateLayoutProps(int64_t tag) {
+  SystraceSection s("NativeUIManager::DoLayout::SetLayoutProps");
+  // Reuse the update list buffer. It is swapped out in case a view manager calls ApplyLayout re-entrantly.
+  std::vector<LayoutUpdate> layoutUpdates;
+  layoutUpdates.swap(m_layoutUpdates);
+  CollectLayoutUpdates(tag, layoutUpdates);
+  ApplyLayoutUpdates(layoutUpdates);
+  layoutUpdates.clear();
+  m_layoutUpdates.swap(layoutUpdates);
 }
 
-void NativeUIManager::SetLayoutPropsRecursive(int64_t tag) {
+void NativeUIManager::CollectLayoutUpdates(int64_t tag, std::vector<LayoutUpdate> &layoutUpdates) {
   ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(tag));
-  auto *pViewManager = shadowNode.GetViewManager();
-  if (!pViewManager->IsNativeControlWithSelfLayout()) {
+  YGNodeRef yogaNode = GetYogaNode(tag);
+  if (yogaNode) {
+    // Yoga visits children only when it lays out their parent. If the node has no new layout,
+    // then none of the nodes in its subtree has it either, and we do not need to walk them.
+    if (!YGNodeGetHasNewLayout(yogaNode))
+      return;
+    YGNodeSetHasNewLayout(yogaNode, false);
+  }
+
+  if (!shadowNode.GetViewManager()->IsNativeControlWithSelfLayout()) {
     for (const auto child : shadowNode.m_children) {
-      SetLayoutPropsRecursive(child);
+      CollectLayoutUpdates(child, layoutUpdates);
     }
   }
 
-  const auto tagToYogaNode = m_tagsToYogaNodes.find(tag);
-  if (auto yogaNode = GetYogaNode(tag)) {
-    if (!YGNodeGetHasNewLayout(yogaNode))
-      return;
-    YGNodeSetHasNewLayout(yogaNode, false);
+  if (yogaNode) {
+    layoutUpdates.push_back(
+        {&shadowNode,
+         YGNodeLayoutGetLeft(yogaNode),
+         YGNodeLayoutGetTop(yogaNode),
+         YGNodeLayoutGetWidth(yogaNode),
+         YGNodeLayoutGetHeight(yogaNode)});
+  }
+}
+
+void NativeUIManager::ApplyLayoutUpdates(const std::vector<LayoutUpdate> &layoutUpdates) {
+  // Children are updated before their parents, in the same order as before the layout updates were collected.
+  for (const auto &update : layoutUpdates) {
+    update.ShadowNode->GetViewManager()->SetLayoutProps(
+        *update.ShadowNode, update.ShadowNode->GetView(), update.Left, update.Top, update.Width, update.Height);
+  }
 
-    float left = YGNodeLayoutGetLeft(yogaNode);
-    float top = YGNodeLayoutGetTop(yogaNode);
-    float width = YGNodeLayoutGetWidth(yogaNode);
-    float height = YGNodeLayoutGetHeight(yogaNode);
-    auto view = shadowNode.GetView();
-    auto pViewManager = shadowNode.GetViewManager();
-    pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
+  // Dispatch the topLayout events after all views have their new layout.
+  for (const auto &update : layoutUpdates) {
+    ShadowNodeBase &shadowNode = *update.ShadowNode;
     if (shadowNode.m_onLayoutRegistered) {
-      const auto hasLayoutChanged = !YogaFloatEquals(left, shadowNode.m_layout.Left) ||
-          !YogaFloatEquals(top, shadowNode.m_layout.Top) || !YogaFloatEquals(width, shadowNode.m_layout.Width) ||
-          !YogaFloatEquals(height, shadowNode.m_layout.Height);
+      const auto hasLayoutChanged = !YogaFloatEquals(update.Left, shadowNode.m_layout.Left) ||
+          !YogaFloatEquals(update.Top, shadowNode.m_layout.Top) ||
+          !YogaFloatEquals(update.Width, shadowNode.m_layout.Width) ||
+          !YogaFloatEquals(update.Height, shadowNode.m_layout.Height);
       if (hasLayoutChanged) {
-        React::JSValueObject layout{{"x", left}, {"y", top}, {"height", height}, {"width", width}};
-        React::JSValueObject eventData{{"target", tag}, {"layout", std::move(layout)}};
-        pViewManager->DispatchCoalescingEvent(tag, L"topLayout", MakeJSValueWriter(std::move(eventData)));
+        React::JSValueObject layout{
+            {"x", update.Left}, {"y", update.Top}, {"height", update.Height}, {"width", update.Width}};
+        React::JSValueObject eventData{{"target", shadowNode.m_tag}, {"layout", std::move(layout)}};
+        shadowNode.GetViewManager()->DispatchCoalescingEvent(
+            shadowNode.m_tag, L"topLayout", MakeJSValueWriter(std::move(eventData)));
       }
     }
-    shadowNode.m_layout = {left, top, width, height};
+    shadowNode.m_layout = {update.Left, update.Top, update.Width, update.Height};
   }
 }
 
@@ -12,6 +12,7 @@
 
 #include <ReactHost/React.h>
 #include <ReactRootView.h>
+#include <YogaNodePool.h>
 #include <nativemodules.h>
 #include <map>
 #include <memory>
@@ -24,13 +25,7 @@ struct IXamlReactControl;
 
 namespace Microsoft::ReactNative {
 
-struct YogaNodeDeleter {
-  void operator()(YGNodeRef node) {
-    YGNodeFree(node);
-  }
-};
-
-typedef std::unique_ptr<YGNode, YogaNodeDeleter> YogaNodePtr;
+using Microsoft::React::YogaNodePtr;
 
 class NativeUIManager final : public INativeUIManager {
  public:
@@ -105,7 +100,18 @@ class NativeUIManager final : public INativeUIManager {
   void ApplyLayout(int64_t tag, float width = YGUndefined, float height = YGUndefined);
 
  private:
-  void SetLayoutPropsRecursive(int64_t tag);
+  // The layout of a shadow node computed by Yoga.
+  struct LayoutUpdate {
+    ShadowNodeBase *ShadowNode;
+    float Left;
+    float Top;
+    float Width;
+    float Height;
+  };
+
+  void UpdateLayoutProps(int64_t tag);
+  void CollectLayoutUpdates(int64_t tag, std::vector<LayoutUpdate> &layoutUpdates);
+  void ApplyLayoutUpdates(const std::vector<LayoutUpdate> &layoutUpdates);
   YGNodeRef GetYogaNode(int64_t tag) const;
 
   winrt::weak_ref<winrt::Microsoft::ReactNative::ReactRootView> GetParentXamlReactControl(int64_t tag) const;
@@ -117,10 +123,12 @@ class NativeUIManager final : public INativeUIManager {
   bool m_inBatch = false;
 
   std::unordered_map<int64_t, YogaNodePtr> m_tagsToYogaNodes;
+  Microsoft::React::YogaNodePool m_yogaNodePool;
   std::unordered_map<int64_t, std::unique_ptr<YogaContext>> m_tagsToYogaContext;
   std::vector<xaml::FrameworkElement::SizeChanged_revoker> m_sizeChangedVector;
   std::vector<std::function<void()>> m_batchCompletedCallbacks;
   std::vector<int64_t> m_extraLayoutNodes;
+  std::vector<LayoutUpdate> m_layoutUpdates;
 
   std::map<int64_t, winrt::weak_ref<winrt::Microsoft::ReactNative::ReactRootView>> m_tagsToXamlReactControl;
 };
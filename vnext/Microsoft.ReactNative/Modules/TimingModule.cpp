@@ -7,6 +7,7 @@
 #include "TimingModule.h"
 
 #include <InstanceManager.h>
+#include <QuirkSettings.h>
 #include <UI.Xaml.Media.h>
 #include <Utils/ValueUtils.h>
 #include <XamlUtils.h>
@@ -30,42 +31,8 @@ static bool IsAnimationFrameRequest(TTimeSpan period, bool repeat) {
   return !repeat && period == std::chrono::milliseconds(1);
 }
 
-//
-// TimerQueue
-//
-
-TimerQueue::TimerQueue() {
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Push(int64_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-  m_timerVector.emplace_back(id, targetTime, period, repeat);
-  std::push_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Pop() {
-  std::pop_heap(m_timerVector.begin(), m_timerVector.end());
-  m_timerVector.pop_back();
-}
-
-Timer &TimerQueue::Front() {
-  return m_timerVector.front();
-}
-
-void TimerQueue::Remove(int64_t id) {
-  // TODO: This is very inefficient, but doing this with a heap is inherently
-  // hard. If performance is not good
-  //	enough for the scenarios then a different structure is probably needed.
-  auto found = std::find(m_timerVector.begin(), m_timerVector.end(), id);
-  if (found != m_timerVector.end())
-    m_timerVector.erase(found);
-
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-bool TimerQueue::IsEmpty() {
-  return m_timerVector.empty();
-}
+// Idle callbacks get a frame's worth of time, as on the other platforms.
+static constexpr auto IdleCallbackFrameDuration = std::chrono::milliseconds(16);
 
 //
 // Timing
@@ -74,24 +41,28 @@ bool TimerQueue::IsEmpty() {
 void Timing::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
   m_usePostForRendering = !xaml::TryGetCurrentApplication();
+  m_coalescingWindow = winrt::Microsoft::ReactNative::implementation::QuirkSettings::GetTimerCoalescingWindow(
+      m_context.Properties());
 }
 
 void Timing::OnTick() {
   winrt::Microsoft::ReactNative::JSValueArray readyTimers;
   auto now = TDateTime::clock::now();
+  m_dispatcherTimerTargetTime = {};
 
   auto emittedAnimationFrame = false;
   while (!m_timerQueue.IsEmpty() && m_timerQueue.Front().TargetTime < now) {
     // Pop first timer from the queue and add it to list of timers ready to fire
-    Timer next = m_timerQueue.Front();
-    m_timerQueue.Pop();
+    Timer next = m_timerQueue.Pop();
     readyTimers.push_back(next.Id);
 
     // If timer is repeating push it back onto the queue for the next repetition
-    if (next.Repeat)
-      m_timerQueue.Push(next.Id, now + next.Period, next.Period, true);
-    else if (IsAnimationFrameRequest(next.Period, next.Repeat))
+    if (next.Repeat) {
+      next.TargetTime = now + next.Period;
+      m_timerQueue.Push(std::move(next));
+    } else if (IsAnimationFrameRequest(next.Period, next.Repeat)) {
       emittedAnimationFrame = true;
+    }
   }
 
   if (m_timerQueue.IsEmpty()) {
@@ -158,17 +129,34 @@ void Timing::StartRendering() {
 }
 
 void Timing::StartDispatcherTimer() {
-  const auto &nextTimer = m_timerQueue.Front();
+  const auto targetTime = CoalescedTargetTime(m_timerQueue.Front().TargetTime);
   m_rendering.revoke();
   m_usingRendering = false;
   auto timer = EnsureDispatcherTimer();
-  timer.Interval(std::max(nextTimer.TargetTime - TDateTime::clock::now(), TTimeSpan::zero()));
+
+  // Timers sharing a coalesced wakeup do not need to re-arm the timer.
+  if (timer.IsRunning() && targetTime == m_dispatcherTimerTargetTime)
+    return;
+
+  m_dispatcherTimerTargetTime = targetTime;
+  timer.Interval(std::max(targetTime - TDateTime::clock::now(), TTimeSpan::zero()));
   timer.Start();
 }
 
+// Rounds the target time up to the next multiple of the coalescing window, so
+// that all timers due within the same window wake up together.
+TDateTime Timing::CoalescedTargetTime(TDateTime targetTime) const noexcept {
+  if (m_coalescingWindow <= TTimeSpan::zero())
+    return targetTime;
+
+  const auto windows = (targetTime.time_since_epoch() + m_coalescingWindow - TTimeSpan{1}) / m_coalescingWindow;
+  return TDateTime{windows * m_coalescingWindow};
+}
+
 void Timing::StopTicks() {
   m_rendering.revoke();
   m_usingRendering = false;
+  m_dispatcherTimerTargetTime = {};
   if (m_dispatcherQueueTimer)
     m_dispatcherQueueTimer.Stop();
 }
@@ -188,7 +176,7 @@ void Timing::createTimerOnQueue(int64_t id, double duration, double jsScheduling
   const int64_t msFrom1601to1970 = 11644473600000;
   TDateTime scheduledTime(TimeSpanFromMs(jsSchedulingTime + msFrom1601to1970));
   auto initialTargetTime = scheduledTime + period;
-  m_timerQueue.Push(id, initialTargetTime, period, repeat);
+  m_timerQueue.Push(Timer(id, initialTargetTime, period, repeat));
   if (!m_usingRendering) {
     if (IsAnimationFrameRequest(period, repeat)) {
       StartRendering();
@@ -222,8 +210,63 @@ void Timing::deleteTimer(double id) noexcept {
       });
 }
 
-void Timing::setSendIdleEvents(bool /*sendIdleEvents*/) noexcept {
-  // TODO: Implement.
+void Timing::setSendIdleEventsOnQueue(bool sendIdleEvents) noexcept {
+  m_sendIdleEvents = sendIdleEvents;
+  if (sendIdleEvents) {
+    ScheduleIdleCallback();
+  } else if (m_idleTimer) {
+    m_idleTimer.Stop();
+  }
+}
+
+void Timing::setSendIdleEvents(bool sendIdleEvents) noexcept {
+  winrt::Microsoft::ReactNative::implementation::ReactCoreInjection::PostToUIBatchingQueue(
+      m_context.Handle(), [wkThis = std::weak_ptr(this->shared_from_this()), sendIdleEvents]() {
+        if (auto pThis = wkThis.lock()) {
+          pThis->setSendIdleEventsOnQueue(sendIdleEvents);
+        }
+      });
+}
+
+void Timing::ScheduleIdleCallback() noexcept {
+  if (m_idleCallbackPending)
+    return;
+
+  const auto queue = winrt::dispatching::DispatcherQueue::GetForCurrentThread();
+  if (!queue)
+    return;
+
+  m_idleCallbackPending = queue.TryEnqueue(
+      winrt::dispatching::DispatcherQueuePriority::Low, [wkThis = std::weak_ptr(this->shared_from_this())]() {
+        if (auto pThis = wkThis.lock()) {
+          pThis->OnIdle();
+        }
+      });
+}
+
+void Timing::OnIdle() noexcept {
+  m_idleCallbackPending = false;
+  if (!m_sendIdleEvents)
+    return;
+
+  // JS gives idle callbacks whatever is left of the frame that started at this
+  // time, in milliseconds since the epoch.
+  const auto frameTime =
+      std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
+  m_context.CallJSFunction(L"JSTimers", L"callIdleCallbacks", winrt::Microsoft::ReactNative::JSValueArray{frameTime});
+
+  // Look for the next idle period once the next frame has started.
+  if (!m_idleTimer) {
+    m_idleTimer = winrt::dispatching::DispatcherQueue::GetForCurrentThread().CreateTimer();
+    m_idleTimer.IsRepeating(false);
+    m_idleTimer.Interval(IdleCallbackFrameDuration);
+    m_idleTimer.Tick([wkThis = std::weak_ptr(this->shared_from_this())](auto &&...) {
+      if (auto pThis = wkThis.lock()) {
+        pThis->ScheduleIdleCallback();
+      }
+    });
+  }
+  m_idleTimer.Start();
 }
 
 } // namespace Microsoft::ReactNative
@@ -6,6 +6,7 @@
 #include "../../codegen/NativeTimingSpec.g.h"
 
 #include <ReactCoreInjection.h>
+#include <Utils/IndexedTimerHeap.h>
 
 namespace Microsoft::ReactNative {
 
@@ -22,34 +23,14 @@ struct Timer {
     Repeat = repeat;
   }
 
-  bool operator<(const Timer &timer) const {
-    return timer.TargetTime < TargetTime;
-  }
-
-  bool operator==(int64_t id) const {
-    return id == Id;
-  }
-
   int64_t Id;
   TDateTime TargetTime;
   TTimeSpan Period;
   bool Repeat;
 };
 
-class TimerQueue {
- public:
-  TimerQueue();
-
-  void Push(int64_t id, TDateTime targetTime, TTimeSpan period, bool repeat);
-  void Pop();
-  Timer &Front();
-  void Remove(int64_t id);
-
-  bool IsEmpty();
-
- private:
-  std::vector<Timer> m_timerVector;
-};
+// Timers ordered by target time. Deleting a timer is O(log n).
+using TimerQueue = Microsoft::React::IndexedTimerHeap<Timer, &Timer::Id, &Timer::TargetTime>;
 
 REACT_MODULE(Timing)
 struct Timing : public std::enable_shared_from_this<Timing> {
@@ -70,19 +51,34 @@ struct Timing : public std::enable_shared_from_this<Timing> {
  private:
   void createTimerOnQueue(int64_t id, double duration, double jsSchedulingTime, bool repeat) noexcept;
   void deleteTimerOnQueue(int64_t id) noexcept;
+  void setSendIdleEventsOnQueue(bool sendIdleEvents) noexcept;
   void OnTick();
   winrt::dispatching::DispatcherQueueTimer EnsureDispatcherTimer();
   void StartRendering();
   void PostRenderFrame() noexcept;
   void StartDispatcherTimer();
   void StopTicks();
+  TDateTime CoalescedTargetTime(TDateTime targetTime) const noexcept;
+  void ScheduleIdleCallback() noexcept;
+  void OnIdle() noexcept;
 
   React::ReactContext m_context;
   TimerQueue m_timerQueue;
   xaml::Media::CompositionTarget::Rendering_revoker m_rendering;
   winrt::dispatching::DispatcherQueueTimer m_dispatcherQueueTimer{nullptr};
+  TDateTime m_dispatcherTimerTargetTime{};
   bool m_usingRendering{false};
   bool m_usePostForRendering{false};
+
+  // Timer wakeups are aligned to multiples of this window, see
+  // QuirkSettings::SetTimerCoalescingWindow. Zero disables coalescing.
+  TTimeSpan m_coalescingWindow{0};
+
+  // Idle callbacks are delivered at most once per frame, from a low priority
+  // task that only runs once the UI queue has no other work pending.
+  winrt::dispatching::DispatcherQueueTimer m_idleTimer{nullptr};
+  bool m_sendIdleEvents{false};
+  bool m_idleCallbackPending{false};
 };
 
 } // namespace Microsoft::ReactNative
@@ -64,6 +64,19 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> MapWindowDeactivatedToAppSt
   properties.Set(MapWindowDeactivatedToAppStateInactiveProperty(), value);
 }
 
+winrt::Microsoft::ReactNative::ReactPropertyId<winrt::Windows::Foundation::TimeSpan>
+TimerCoalescingWindowProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<winrt::Windows::Foundation::TimeSpan> propId{
+      L"ReactNative.QuirkSettings", L"TimerCoalescingWindow"};
+  return propId;
+}
+
+/*static*/ void QuirkSettings::SetTimerCoalescingWindow(
+    winrt::Microsoft::ReactNative::ReactPropertyBag properties,
+    winrt::Windows::Foundation::TimeSpan window) noexcept {
+  properties.Set(TimerCoalescingWindowProperty(), window);
+}
+
 #pragma region IDL interface
 
 /*static*/ void QuirkSettings::SetMatchAndroidAndIOSStretchBehavior(
@@ -96,6 +109,12 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> MapWindowDeactivatedToAppSt
   SetMapWindowDeactivatedToAppStateInactive(ReactPropertyBag(settings.Properties()), value);
 }
 
+/*static*/ void QuirkSettings::SetTimerCoalescingWindow(
+    winrt::Microsoft::ReactNative::ReactInstanceSettings settings,
+    winrt::Windows::Foundation::TimeSpan window) noexcept {
+  SetTimerCoalescingWindow(ReactPropertyBag(settings.Properties()), window);
+}
+
 #pragma endregion IDL interface
 
 /*static*/ bool QuirkSettings::GetMatchAndroidAndIOSStretchBehavior(ReactPropertyBag properties) noexcept {
@@ -120,4 +139,9 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> MapWindowDeactivatedToAppSt
   return properties.Get(MapWindowDeactivatedToAppStateInactiveProperty()).value_or(false);
 }
 
+/*static*/ winrt::Windows::Foundation::TimeSpan QuirkSettings::GetTimerCoalescingWindow(
+    ReactPropertyBag properties) noexcept {
+  return properties.Get(TimerCoalescingWindowProperty()).value_or(winrt::Windows::Foundation::TimeSpan::zero());
+}
+
 } // namespace winrt::Microsoft::ReactNative::implementation
@@ -37,6 +37,12 @@ struct QuirkSettings : QuirkSettingsT<QuirkSettings> {
   static bool GetMapWindowDeactivatedToAppStateInactive(
       winrt::Microsoft::ReactNative::ReactPropertyBag properties) noexcept;
 
+  static void SetTimerCoalescingWindow(
+      winrt::Microsoft::ReactNative::ReactPropertyBag properties,
+      winrt::Windows::Foundation::TimeSpan window) noexcept;
+  static winrt::Windows::Foundation::TimeSpan GetTimerCoalescingWindow(
+      winrt::Microsoft::ReactNative::ReactPropertyBag properties) noexcept;
+
 #pragma region Public API - part of IDL interface
   static void SetMatchAndroidAndIOSStretchBehavior(
       winrt::Microsoft::ReactNative::ReactInstanceSettings settings,
@@ -54,6 +60,10 @@ struct QuirkSettings : QuirkSettingsT<QuirkSettings> {
   static void SetMapWindowDeactivatedToAppStateInactive(
       winrt::Microsoft::ReactNative::ReactInstanceSettings settings,
       bool value) noexcept;
+
+  static void SetTimerCoalescingWindow(
+      winrt::Microsoft::ReactNative::ReactInstanceSettings settings,
+      winrt::Windows::Foundation::TimeSpan window) noexcept;
 #pragma endregion Public API - part of IDL interface
 };
 
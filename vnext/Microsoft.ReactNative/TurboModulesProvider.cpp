@@ -91,6 +91,30 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   TurboModuleImpl
 -------------------------------------------------------------------------------*/
 
+// Caches the members that TurboModuleImpl creates for a JSI runtime.
+// It is owned by the LongLivedObjectCollection used with the runtime, and it is released together
+// with the other long lived JSI values when the runtime is torn down.
+struct TurboModuleMemberCache : LongLivedJsiRuntime {
+  static std::weak_ptr<TurboModuleMemberCache> CreateWeak(
+      std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
+      facebook::jsi::Runtime &runtime) noexcept {
+    auto value =
+        std::shared_ptr<TurboModuleMemberCache>(new TurboModuleMemberCache(longLivedObjectCollection, runtime));
+    longLivedObjectCollection->add(value);
+    return value;
+  }
+
+  // Members created by TurboModuleImpl::CreateMember, keyed by their UTF-8 names.
+  std::unordered_map<std::string, facebook::jsi::Value> Members;
+
+  // Property names returned by TurboModuleImpl::getPropertyNames.
+  std::vector<facebook::jsi::PropNameID> PropertyNames;
+  bool ArePropertyNamesSet{false};
+
+ protected:
+  using LongLivedJsiRuntime::LongLivedJsiRuntime;
+};
+
 class TurboModuleImpl : public facebook::react::TurboModule {
  public:
   TurboModuleImpl(
@@ -114,6 +138,83 @@ class TurboModuleImpl : public facebook::react::TurboModule {
       return m_hostObjectWrapper->getPropertyNames(rt);
     }
 
+    auto memberCache = GetMemberCache(rt);
+    if (!memberCache) {
+      return CreatePropertyNames(rt);
+    }
+
+    if (!memberCache->ArePropertyNamesSet) {
+      memberCache->PropertyNames = CreatePropertyNames(rt);
+      memberCache->ArePropertyNamesSet = true;
+    }
+
+    std::vector<facebook::jsi::PropNameID> propertyNames;
+    propertyNames.reserve(memberCache->PropertyNames.size());
+    for (auto const &propertyName : memberCache->PropertyNames) {
+      propertyNames.emplace_back(rt, propertyName);
+    }
+
+    return propertyNames;
+  }
+
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &propName) override {
+    if (m_hostObjectWrapper) {
+      return m_hostObjectWrapper->get(runtime, propName);
+    }
+
+    std::string key = propName.utf8(runtime);
+    auto memberCache = GetMemberCache(runtime);
+    if (!memberCache) {
+      return CreateMember(runtime, propName, key);
+    }
+
+    auto it = memberCache->Members.find(key);
+    if (it == memberCache->Members.end()) {
+      facebook::jsi::Value member = CreateMember(runtime, propName, key);
+      if (member.isUndefined()) {
+        // do not cache unknown names: JS code may probe for any name
+        return member;
+      }
+
+      it = memberCache->Members.emplace(std::move(key), std::move(member)).first;
+    }
+
+    return facebook::jsi::Value(runtime, it->second);
+  }
+
+  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
+      override {
+    if (m_hostObjectWrapper) {
+      return m_hostObjectWrapper->set(rt, name, value);
+    }
+
+    facebook::react::TurboModule::set(rt, name, value);
+  }
+
+ private:
+  // Returns the member cache for the runtime, or nullptr if members cannot be cached.
+  // A new cache is created if the module is accessed from a different runtime, or if the previous
+  // cache was released with the LongLivedObjectCollection of a torn down runtime. The previous cache
+  // is left to its collection because its JSI values must not be released from another runtime.
+  std::shared_ptr<TurboModuleMemberCache> GetMemberCache(facebook::jsi::Runtime &runtime) noexcept {
+    if (m_memberCacheRuntime == &runtime) {
+      if (auto memberCache = m_memberCache.lock()) {
+        return memberCache;
+      }
+    }
+
+    auto longLivedObjectCollection = m_longLivedObjectCollection.lock();
+    if (!longLivedObjectCollection) {
+      return nullptr;
+    }
+
+    auto memberCache = TurboModuleMemberCache::CreateWeak(longLivedObjectCollection, runtime).lock();
+    m_memberCache = memberCache;
+    m_memberCacheRuntime = &runtime;
+    return memberCache;
+  }
+
+  std::vector<facebook::jsi::PropNameID> CreatePropertyNames(facebook::jsi::Runtime &rt) {
     std::vector<facebook::jsi::PropNameID> propertyNames;
     propertyNames.reserve(
         m_moduleBuilder->Methods().size() + m_moduleBuilder->SyncMethods().size() +
@@ -132,16 +233,10 @@ class TurboModuleImpl : public facebook::react::TurboModule {
     }
 
     return propertyNames;
-  };
-
-  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &propName) override {
-    if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->get(runtime, propName);
-    }
-
-    // it is not safe to assume that "runtime" never changes, so members are not cached here
-    std::string key = propName.utf8(runtime);
+  }
 
+  facebook::jsi::Value
+  CreateMember(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &propName, const std::string &key) {
     if (key == "getConstants" && !m_moduleBuilder->ConstantProviders().empty()) {
       // try to find getConstants if there is any constant
       return facebook::jsi::Function::createFromHostFunction(
@@ -326,16 +421,6 @@ class TurboModuleImpl : public facebook::react::TurboModule {
     return facebook::jsi::Value::undefined();
   }
 
-  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
-      override {
-    if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->set(rt, name, value);
-    }
-
-    facebook::react::TurboModule::set(rt, name, value);
-  }
-
- private:
   static MethodResultCallback MakeCallback(
       facebook::jsi::Runtime &rt,
       const std::shared_ptr<facebook::react::LongLivedObjectCollection> &longLivedObjectCollection,
@@ -358,6 +443,8 @@ class TurboModuleImpl : public facebook::react::TurboModule {
   IInspectable m_providedModule;
   std::shared_ptr<implementation::HostObjectWrapper> m_hostObjectWrapper;
   std::weak_ptr<facebook::react::LongLivedObjectCollection> m_longLivedObjectCollection;
+  std::weak_ptr<TurboModuleMemberCache> m_memberCache;
+  facebook::jsi::Runtime *m_memberCacheRuntime{nullptr};
 };
 
 /*-------------------------------------------------------------------------------
@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ImageCache.h"
+
+#include <Shared/cdebug.h>
+#include <winrt/Windows.Web.Http.Headers.h>
+
+namespace winrt {
+using namespace Windows::Foundation;
+using namespace Windows::Storage::Streams;
+using namespace Windows::Web::Http;
+} // namespace winrt
+
+namespace Microsoft::ReactNative {
+
+/*static*/ ImageCache &ImageCache::Instance() noexcept {
+  static ImageCache instance;
+  return instance;
+}
+
+ImageCache::ImageCache() noexcept
+    : m_downloader{[this](ReactImageSource source, std::shared_ptr<DownloadResult> result) {
+        return DownloadFromHttpAsync(std::move(source), std::move(result));
+      }} {}
+
+ImageCache::ImageCache(Downloader &&downloader) noexcept : m_downloader{std::move(downloader)} {}
+
+winrt::IAsyncOperation<winrt::IBuffer> ImageCache::GetImageBufferAsync(ReactImageSource source) {
+  const bool isGetRequest = source.method.empty() || _stricmp(source.method.c_str(), "GET") == 0;
+  if (!isGetRequest) {
+    auto result = std::make_shared<DownloadResult>();
+    co_await DownloadAsync(std::move(source), result);
+    co_return result->Buffer;
+  }
+
+  std::string key = MakeKey(source);
+  std::shared_ptr<InFlightDownload> inFlightDownload;
+  bool isNewDownload = false;
+  {
+    std::lock_guard lock{m_mutex};
+    if (winrt::IBuffer buffer = TryGetCachedBuffer(key)) {
+      ++m_memoryHits;
+      co_return buffer;
+    }
+
+    auto it = m_inFlightDownloads.find(key);
+    if (it != m_inFlightDownloads.end()) {
+      ++m_inFlightHits;
+      inFlightDownload = it->second;
+    } else {
+      inFlightDownload = std::make_shared<InFlightDownload>();
+      m_inFlightDownloads.emplace(key, inFlightDownload);
+      isNewDownload = true;
+    }
+  }
+
+  if (!isNewDownload) {
+    co_await winrt::resume_on_signal(inFlightDownload->Completed.get());
+    co_return inFlightDownload->Buffer;
+  }
+
+  auto result = std::make_shared<DownloadResult>();
+  try {
+    co_await DownloadAsync(std::move(source), result);
+  } catch (...) {
+    // The waiting requests must be completed even if the download fails unexpectedly.
+    result->Buffer = nullptr;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+    m_inFlightDownloads.erase(key);
+    if (result->Buffer && result->IsCacheable) {
+      AddCachedBuffer(std::move(key), *result);
+    }
+  }
+
+  inFlightDownload->Buffer = result->Buffer;
+  SetEvent(inFlightDownload->Completed.get());
+  co_return result->Buffer;
+}
+
+ImageCacheStats ImageCache::Stats() const noexcept {
+  return ImageCacheStats{m_memoryHits, m_inFlightHits, m_httpCacheHits, m_downloads};
+}
+
+/*static*/ std::string ImageCache::MakeKey(ReactImageSource const &source) noexcept {
+  // Different headers, such as authorization, may return different images for the same URI.
+  std::string key = source.uri;
+  for (auto const &header : source.headers) {
+    key.append("\n").append(header.first).append(":").append(header.second);
+  }
+
+  return key;
+}
+
+winrt::IAsyncAction ImageCache::DownloadAsync(ReactImageSource source, std::shared_ptr<DownloadResult> result) {
+  ++m_downloads;
+  co_await m_downloader(std::move(source), std::move(result));
+}
+
+winrt::IAsyncAction ImageCache::DownloadFromHttpAsync(
+    ReactImageSource source,
+    std::shared_ptr<DownloadResult> result) {
+  try {
+    auto httpMethod{
+        source.method.empty() ? winrt::HttpMethod::Get() : winrt::HttpMethod{winrt::to_hstring(source.method)}};
+
+    winrt::Uri uri{winrt::to_hstring(source.uri)};
+    winrt::HttpRequestMessage request{httpMethod, uri};
+
+    for (auto &header : source.headers) {
+      if (_stricmp(header.first.c_str(), "authorization") == 0) {
+        request.Headers().TryAppendWithoutValidation(winrt::to_hstring(header.first), winrt::to_hstring(header.second));
+      } else {
+        request.Headers().Append(winrt::to_hstring(header.first), winrt::to_hstring(header.second));
+      }
+    }
+
+    winrt::HttpResponseMessage response{co_await m_httpClient.SendRequestAsync(request)};
+
+    if (response && response.StatusCode() == winrt::HttpStatusCode::Ok) {
+      if (response.Source() == winrt::HttpResponseMessageSource::Cache) {
+        ++m_httpCacheHits;
+      }
+
+      result->Buffer = co_await response.Content().ReadAsBufferAsync();
+      result->IsCacheable = result->Buffer.Length() <= MaxCachedImageSize;
+
+      auto cacheControl = response.Headers().CacheControl();
+      for (auto const &directive : cacheControl) {
+        auto name = directive.Name();
+        if (_wcsicmp(name.c_str(), L"no-store") == 0 || _wcsicmp(name.c_str(), L"no-cache") == 0) {
+          result->IsCacheable = false;
+        }
+      }
+
+      if (auto maxAge = cacheControl.MaxAge()) {
+        result->ExpiresAt = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(maxAge.Value());
+      }
+    }
+  } catch (winrt::hresult_error const &e) {
+    DEBUG_HRESULT_ERROR(e);
+    result->Buffer = nullptr;
+  }
+}
+
+winrt::IBuffer ImageCache::TryGetCachedBuffer(std::string const &key) noexcept {
+  auto it = m_cacheIndex.find(key);
+  if (it == m_cacheIndex.end()) {
+    return nullptr;
+  }
+
+  auto entry = it->second;
+  if (entry->ExpiresAt && *entry->ExpiresAt <= std::chrono::steady_clock::now()) {
+    m_cacheSize -= entry->Buffer.Length();
+    m_cacheIndex.erase(it);
+    m_cacheEntries.erase(entry);
+    return nullptr;
+  }
+
+  m_cacheEntries.splice(m_cacheEntries.begin(), m_cacheEntries, entry);
+  return entry->Buffer;
+}
+
+void ImageCache::AddCachedBuffer(std::string &&key, DownloadResult const &result) noexcept {
+  if (m_cacheIndex.count(key) != 0) {
+    return;
+  }
+
+  const uint32_t size = result.Buffer.Length();
+  while (!m_cacheEntries.empty() && m_cacheSize + size > MaxMemoryCacheSize) {
+    CacheEntry &last = m_cacheEntries.back();
+    m_cacheSize -= last.Buffer.Length();
+    m_cacheIndex.erase(last.Key);
+    m_cacheEntries.pop_back();
+  }
+
+  m_cacheEntries.push_front(CacheEntry{std::move(key), result.Buffer, result.ExpiresAt});
+  m_cacheIndex.emplace(m_cacheEntries.front().Key, m_cacheEntries.begin());
+  m_cacheSize += size;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <winrt/Windows.Storage.Streams.h>
+#include <winrt/Windows.Web.Http.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include "ImageUtils.h"
+
+namespace Microsoft::ReactNative {
+
+struct ImageCacheStats {
+  // Requests served from the memory cache.
+  uint64_t MemoryHits{0};
+  // Requests that joined a download of the same image that was already in progress.
+  uint64_t InFlightHits{0};
+  // Downloads served by the HTTP cache without transferring the image again.
+  uint64_t HttpCacheHits{0};
+  // Requests sent to the network or to the HTTP cache.
+  uint64_t Downloads{0};
+};
+
+// Loads encoded images for the Paper and Fabric image components.
+// - Concurrent requests for the same image share one download.
+// - Downloaded images are kept in a memory cache of encoded bytes with LRU eviction.
+//   Responses with the no-store or no-cache directive are not kept, and max-age limits how long they are kept.
+// - All downloads use one HttpClient. Its HttpBaseProtocolFilter keeps the disk cache, and it revalidates
+//   the cached responses using their Cache-Control, Expires, and ETag headers.
+// Only GET requests are cached. Other requests are always downloaded.
+struct ImageCache {
+  static constexpr uint32_t MaxMemoryCacheSize = 32 * 1024 * 1024;
+  static constexpr uint32_t MaxCachedImageSize = 4 * 1024 * 1024;
+
+  struct DownloadResult {
+    winrt::Windows::Storage::Streams::IBuffer Buffer;
+    bool IsCacheable{false};
+    std::optional<std::chrono::steady_clock::time_point> ExpiresAt;
+  };
+
+  // Downloads the image into the result. The buffer is left null if the image cannot be downloaded.
+  using Downloader =
+      std::function<winrt::Windows::Foundation::IAsyncAction(ReactImageSource, std::shared_ptr<DownloadResult>)>;
+
+  static ImageCache &Instance() noexcept;
+
+  // Downloads the images with the HttpClient.
+  ImageCache() noexcept;
+
+  // Downloads the images with the downloader. Used by tests.
+  explicit ImageCache(Downloader &&downloader) noexcept;
+
+  // Returns the encoded image or nullptr if it cannot be downloaded.
+  winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Storage::Streams::IBuffer> GetImageBufferAsync(
+      ReactImageSource source);
+
+  ImageCacheStats Stats() const noexcept;
+
+ private:
+  struct InFlightDownload {
+    winrt::handle Completed{
+        CreateEvent(/*attributes*/ nullptr, /*manual reset*/ true, /*state*/ false, /*name*/ nullptr)};
+    winrt::Windows::Storage::Streams::IBuffer Buffer;
+  };
+
+  struct CacheEntry {
+    std::string Key;
+    winrt::Windows::Storage::Streams::IBuffer Buffer;
+    std::optional<std::chrono::steady_clock::time_point> ExpiresAt;
+  };
+
+  static std::string MakeKey(ReactImageSource const &source) noexcept;
+  winrt::Windows::Foundation::IAsyncAction DownloadAsync(
+      ReactImageSource source,
+      std::shared_ptr<DownloadResult> result);
+  winrt::Windows::Foundation::IAsyncAction DownloadFromHttpAsync(
+      ReactImageSource source,
+      std::shared_ptr<DownloadResult> result);
+
+  // These methods must be called under the m_mutex lock.
+  winrt::Windows::Storage::Streams::IBuffer TryGetCachedBuffer(std::string const &key) noexcept;
+  void AddCachedBuffer(std::string &&key, DownloadResult const &result) noexcept;
+
+ private:
+  winrt::Windows::Web::Http::HttpClient m_httpClient;
+  const Downloader m_downloader;
+
+  std::mutex m_mutex;
+  std::unordered_map<std::string, std::shared_ptr<InFlightDownload>> m_inFlightDownloads;
+  std::list<CacheEntry> m_cacheEntries; // The most recently used entries are at the front.
+  std::unordered_map<std::string, std::list<CacheEntry>::iterator> m_cacheIndex;
+  uint32_t m_cacheSize{0};
+
+  std::atomic<uint64_t> m_memoryHits{0};
+  std::atomic<uint64_t> m_inFlightHits{0};
+  std::atomic<uint64_t> m_httpCacheHits{0};
+  std::atomic<uint64_t> m_downloads{0};
+};
+
+} // namespace Microsoft::ReactNative
@@ -4,15 +4,14 @@
 #include "pch.h"
 #include "ImageUtils.h"
 
+#include "ImageCache.h"
+
 #include <Shared/cdebug.h>
 #include <winrt/Windows.Security.Cryptography.h>
-#include <winrt/Windows.Web.Http.Headers.h>
-#include <winrt/Windows.Web.Http.h>
 
 namespace winrt {
 using namespace Windows::Foundation;
 using namespace Windows::Storage::Streams;
-using namespace Windows::Web::Http;
 } // namespace winrt
 
 namespace Microsoft::ReactNative {
@@ -21,30 +20,9 @@ winrt::IAsyncOperation<winrt::IRandomAccessStream> GetImageStreamAsync(ReactImag
   try {
     co_await winrt::resume_background();
 
-    auto httpMethod{
-        source.method.empty() ? winrt::HttpMethod::Get() : winrt::HttpMethod{winrt::to_hstring(source.method)}};
-
-    winrt::Uri uri{winrt::to_hstring(source.uri)};
-    winrt::HttpRequestMessage request{httpMethod, uri};
-
-    if (!source.headers.empty()) {
-      for (auto &header : source.headers) {
-        if (_stricmp(header.first.c_str(), "authorization") == 0) {
-          request.Headers().TryAppendWithoutValidation(
-              winrt::to_hstring(header.first), winrt::to_hstring(header.second));
-        } else {
-          request.Headers().Append(winrt::to_hstring(header.first), winrt::to_hstring(header.second));
-        }
-      }
-    }
-
-    winrt::HttpClient httpClient;
-    winrt::HttpResponseMessage response{co_await httpClient.SendRequestAsync(request)};
-
-    if (response && response.StatusCode() == winrt::HttpStatusCode::Ok) {
-      winrt::IInputStream inputStream{co_await response.Content().ReadAsInputStreamAsync()};
+    if (winrt::IBuffer buffer = co_await ImageCache::Instance().GetImageBufferAsync(std::move(source))) {
       winrt::InMemoryRandomAccessStream memoryStream;
-      co_await winrt::RandomAccessStream::CopyAsync(inputStream, memoryStream);
+      co_await memoryStream.WriteAsync(buffer);
       memoryStream.Seek(0);
 
       co_return memoryStream;
@@ -3,6 +3,7 @@
 
 #include "pch.h"
 
+#include <MemoryMappedBuffer.h>
 #include <Utils/LocalBundleReader.h>
 #include <winrt/Windows.Storage.Streams.h>
 #include <winrt/Windows.Storage.h>
@@ -54,6 +55,38 @@ std::string GetBundleFromEmbeddedResource(winrt::hstring str) {
   return std::string(start, start + size);
 }
 
+// Returns nullptr if the file cannot be mapped, e.g. because the app has no direct access to its path.
+std::shared_ptr<const facebook::react::JSBigString> TryMapBundle(const std::string &bundlePath) noexcept {
+  if (bundlePath.empty()) {
+    return nullptr;
+  }
+
+  try {
+    return Microsoft::JSI::MakeMemoryMappedBigString(bundlePath);
+  } catch (const std::exception &) {
+    return nullptr;
+  }
+}
+
+std::string GetBundleFromBuffer(const winrt::Windows::Storage::Streams::IBuffer &fileBuffer) {
+  // Read the buffer manually to avoid a Utf8 -> Utf16 -> Utf8 encoding
+  // roundtrip.
+  auto dataReader{winrt::Windows::Storage::Streams::DataReader::FromBuffer(fileBuffer)};
+
+  // No need to use length + 1, STL guarantees that string storage is null-terminated.
+  std::string script(fileBuffer.Length(), '\0');
+
+  // Construct the array_view to slice into the first fileBuffer.Length bytes.
+  // DataReader.ReadBytes will read as many bytes as are present in the
+  // array_view. The backing string has fileBuffer.Length() + 1 bytes, without
+  // an explicit end it will read 1 byte to many and throw.
+  dataReader.ReadBytes(winrt::array_view<uint8_t>{
+      reinterpret_cast<uint8_t *>(&script[0]), reinterpret_cast<uint8_t *>(&script[script.length()])});
+  dataReader.Close();
+
+  return script;
+}
+
 std::future<std::string> LocalBundleReader::LoadBundleAsync(const std::string &bundleUri) {
   winrt::hstring str(Microsoft::Common::Unicode::Utf8ToUtf16(bundleUri));
 
@@ -71,23 +104,41 @@ std::future<std::string> LocalBundleReader::LoadBundleAsync(const std::string &b
     file = co_await winrt::Windows::Storage::StorageFile::GetFileFromPathAsync(str);
   }
 
-  // Read the buffer manually to avoid a Utf8 -> Utf16 -> Utf8 encoding
-  // roundtrip.
   auto fileBuffer{co_await winrt::Windows::Storage::FileIO::ReadBufferAsync(file)};
-  auto dataReader{winrt::Windows::Storage::Streams::DataReader::FromBuffer(fileBuffer)};
+  co_return GetBundleFromBuffer(fileBuffer);
+}
 
-  // No need to use length + 1, STL guarantees that string storage is null-terminated.
-  std::string script(fileBuffer.Length(), '\0');
+std::future<std::shared_ptr<const facebook::react::JSBigString>> LocalBundleReader::LoadBundleBigStringAsync(
+    const std::string &bundleUri) {
+  const bool isApplicationUri = bundleUri._Starts_with("ms-app");
+  const bool isResourceUri = bundleUri._Starts_with("resource://");
+  if (!isApplicationUri && !isResourceUri) {
+    if (auto bigString = TryMapBundle(bundleUri)) {
+      co_return bigString;
+    }
+  }
 
-  // Construct the array_view to slice into the first fileBuffer.Length bytes.
-  // DataReader.ReadBytes will read as many bytes as are present in the
-  // array_view. The backing string has fileBuffer.Length() + 1 bytes, without
-  // an explicit end it will read 1 byte to many and throw.
-  dataReader.ReadBytes(winrt::array_view<uint8_t>{
-      reinterpret_cast<uint8_t *>(&script[0]), reinterpret_cast<uint8_t *>(&script[script.length()])});
-  dataReader.Close();
+  winrt::hstring str(Microsoft::Common::Unicode::Utf8ToUtf16(bundleUri));
+
+  co_await winrt::resume_background();
+
+  winrt::Windows::Storage::StorageFile file{nullptr};
+  if (isApplicationUri) {
+    winrt::Windows::Foundation::Uri uri(str);
+    file = co_await winrt::Windows::Storage::StorageFile::GetFileFromApplicationUriAsync(uri);
+
+    // Files in the app package and in the app data folders can be opened by their path.
+    if (auto bigString = TryMapBundle(winrt::to_string(file.Path()))) {
+      co_return bigString;
+    }
+  } else if (isResourceUri) {
+    co_return std::make_shared<const facebook::react::JSBigStdString>(GetBundleFromEmbeddedResource(str));
+  } else {
+    file = co_await winrt::Windows::Storage::StorageFile::GetFileFromPathAsync(str);
+  }
 
-  co_return script;
+  auto fileBuffer{co_await winrt::Windows::Storage::FileIO::ReadBufferAsync(file)};
+  co_return std::make_shared<const facebook::react::JSBigStdString>(GetBundleFromBuffer(fileBuffer));
 }
 
 std::string LocalBundleReader::LoadBundle(const std::string &bundlePath) {
@@ -95,7 +146,7 @@ std::string LocalBundleReader::LoadBundle(const std::string &bundlePath) {
 }
 
 StorageFileBigString::StorageFileBigString(const std::string &path) {
-  m_futureBuffer = LocalBundleReader::LoadBundleAsync(path);
+  m_futureBuffer = LocalBundleReader::LoadBundleBigStringAsync(path);
 }
 
 bool StorageFileBigString::isAscii() const {
@@ -104,17 +155,17 @@ bool StorageFileBigString::isAscii() const {
 
 const char *StorageFileBigString::c_str() const {
   ensure();
-  return m_string.c_str();
+  return m_bigString->c_str();
 }
 
 size_t StorageFileBigString::size() const {
   ensure();
-  return m_string.size();
+  return m_bigString->size();
 }
 
 void StorageFileBigString::ensure() const {
-  if (m_string.empty()) {
-    m_string = m_futureBuffer.get();
+  if (!m_bigString) {
+    m_bigString = m_futureBuffer.get();
   }
 }
 
@@ -4,6 +4,7 @@
 #pragma once
 #include <cxxreact/JSBigString.h>
 #include <future>
+#include <memory>
 #include <string>
 
 namespace Microsoft::ReactNative {
@@ -12,6 +13,10 @@ class LocalBundleReader {
  public:
   static std::future<std::string> LoadBundleAsync(const std::string &bundlePath);
   static std::string LoadBundle(const std::string &bundlePath);
+
+  // Maps the bundle file into memory if it can be opened by its path. Otherwise reads it like LoadBundleAsync.
+  static std::future<std::shared_ptr<const facebook::react::JSBigString>> LoadBundleBigStringAsync(
+      const std::string &bundleUri);
 };
 
 class StorageFileBigString : public facebook::react::JSBigString {
@@ -24,8 +29,8 @@ class StorageFileBigString : public facebook::react::JSBigString {
   void ensure() const;
 
  private:
-  mutable std::future<std::string> m_futureBuffer;
-  mutable std::string m_string;
+  mutable std::future<std::shared_ptr<const facebook::react::JSBigString>> m_futureBuffer;
+  mutable std::shared_ptr<const facebook::react::JSBigString> m_bigString;
 };
 
 } // namespace Microsoft::ReactNative
@@ -152,15 +152,20 @@ void ReactImage::Source(ReactImageSource source) {
     winrt::hstring scheme{uri ? uri.SchemeName() : L""};
     winrt::hstring ext{uri ? uri.Extension() : L""};
 
-    if (((scheme == L"http") || (scheme == L"https")) && !source.headers.empty()) {
-      source.sourceType = ImageSourceType::Download;
-    } else if (scheme == L"data") {
+    if (scheme == L"data") {
       source.sourceType = ImageSourceType::InlineData;
       if (source.uri.find("image/svg+xml;base64") != std::string::npos) {
         source.sourceFormat = ImageSourceFormat::Svg;
       }
-    } else if (ext == L".svg" || ext == L".svgz") {
-      source.sourceFormat = ImageSourceFormat::Svg;
+    } else {
+      // Downloads go through the ImageCache, so that images shown by several views are only downloaded once.
+      if ((scheme == L"http") || (scheme == L"https")) {
+        source.sourceType = ImageSourceType::Download;
+      }
+
+      if (ext == L".svg" || ext == L".svgz") {
+        source.sourceFormat = ImageSourceFormat::Svg;
+      }
     }
 
     m_imageSource = source;
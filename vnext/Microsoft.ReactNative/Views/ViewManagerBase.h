@@ -19,9 +19,11 @@ struct ShadowNodeBase;
 struct ShadowNode;
 
 struct YogaContext {
-  YogaContext(const XamlView &view_) : view(view_) {}
+  YogaContext(const XamlView &view_, YGMeasureFunc measureFunc_ = nullptr) : view(view_), measureFunc(measureFunc_) {}
 
   XamlView view;
+  // The view manager measure function. NativeUIManager calls it on the UI thread.
+  YGMeasureFunc measureFunc;
 };
 
 REACTWINDOWS_EXPORT YGSize DefaultYogaSelfMeasureFunc(
@@ -5,6 +5,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
 #include "motifCpp/testCheck.h"
 
 namespace Mso {
@@ -66,6 +68,62 @@ TEST_CLASS (DispatchQueueTest) {
     Mso::Test_ThreadPoolSchedulerWin_WaitForThreadPoolWorkCompletion();
     Mso::Test_ThreadPoolSchedulerWin_EnableThreadPoolWorkTracking(false);
   }
+
+  TEST_METHOD(DispatchQueue_PriorityLanes) {
+    std::vector<int> results;
+    Mso::ManualResetEvent completed;
+    Mso::DispatchQueue queue = Mso::DispatchQueue::MakeSerialQueue();
+    {
+      // Post all tasks while suspended so that they are invoked in the priority order.
+      auto suspendGuard = queue.Suspend();
+      queue.Post([&]() noexcept { results.push_back(5); }, Mso::DispatchTaskPriority::Idle);
+      queue.Post([&]() noexcept { completed.Set(); }, Mso::DispatchTaskPriority::Idle);
+      queue.Post([&]() noexcept { results.push_back(3); });
+      queue.Post([&]() noexcept { results.push_back(1); }, Mso::DispatchTaskPriority::High);
+      queue.Post([&]() noexcept { results.push_back(4); }, Mso::DispatchTaskPriority::Normal);
+      queue.Post([&]() noexcept { results.push_back(2); }, Mso::DispatchTaskPriority::High);
+    }
+
+    completed.Wait();
+    TestCheck(results == (std::vector<int>{1, 2, 3, 4, 5}));
+  }
+
+  TEST_METHOD(DispatchQueue_PostDelayed) {
+    std::vector<int> results;
+    Mso::ManualResetEvent completed;
+    Mso::DispatchQueue queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto startTime = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point invokeTime;
+
+    queue.PostDelayed(
+        [&]() noexcept {
+          results.push_back(3);
+          invokeTime = std::chrono::steady_clock::now();
+          completed.Set();
+        },
+        std::chrono::milliseconds(50));
+    queue.PostAt([&]() noexcept { results.push_back(2); }, startTime + std::chrono::milliseconds(20));
+    queue.Post([&]() noexcept { results.push_back(1); });
+
+    completed.Wait();
+    TestCheck(results == (std::vector<int>{1, 2, 3}));
+    TestCheck(invokeTime - startTime >= std::chrono::milliseconds(50));
+  }
+
+  TEST_METHOD(DispatchQueue_PostDelayedCanceledOnShutdown) {
+    bool isInvoked{false};
+    bool isCanceled{false};
+    Mso::DispatchQueue queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.PostDelayed(
+        Mso::MakeDispatchTask([&]() noexcept { isInvoked = true; }, [&]() noexcept { isCanceled = true; }),
+        std::chrono::hours(1));
+
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+
+    TestCheck(!isInvoked);
+    TestCheck(isCanceled);
+  }
 };
 
 } // namespace DispatchQueueTests
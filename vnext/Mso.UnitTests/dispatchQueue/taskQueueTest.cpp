@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "src/dispatchQueue/taskQueue.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "motifCpp/testCheck.h"
+
+namespace DispatchQueueTests {
+
+namespace {
+
+constexpr uint32_t ProducerCount{4};
+constexpr uint32_t TasksPerProducer{50000};
+
+// Records in results[producer] the index of each task as it is invoked.
+Mso::DispatchTask MakeRecordingTask(std::vector<std::vector<uint32_t>> &results, uint32_t producer, uint32_t index) {
+  return [&results, producer, index]() noexcept { results[producer].push_back(index); };
+}
+
+} // namespace
+
+TEST_CLASS (TaskQueueTest) {
+  TEST_METHOD(TaskQueue_DequeueInEnqueueOrder) {
+    std::vector<std::vector<uint32_t>> results(1);
+    Mso::TaskQueue queue{Mso::WeakPtr<IUnknown>{}};
+    for (uint32_t i = 0; i < 10; ++i) {
+      queue.Enqueue(MakeRecordingTask(results, 0, i));
+    }
+
+    TestCheck(queue.Size() == 10);
+
+    // Interleave enqueueing with dequeueing from a partly consumed read list.
+    Mso::DispatchTask task;
+    for (uint32_t i = 0; i < 5; ++i) {
+      TestCheck(queue.TryDequeue(task));
+      task();
+    }
+
+    for (uint32_t i = 10; i < 15; ++i) {
+      queue.Enqueue(MakeRecordingTask(results, 0, i));
+    }
+
+    while (queue.TryDequeue(task)) {
+      task();
+    }
+
+    TestCheck(queue.IsEmpty());
+    TestCheck(results[0].size() == 15);
+    for (uint32_t i = 0; i < 15; ++i) {
+      TestCheckEqual(i, results[0][i]);
+    }
+  }
+
+  TEST_METHOD(TaskQueue_DequeueAll) {
+    std::vector<std::vector<uint32_t>> results(1);
+    Mso::TaskQueue queue{Mso::WeakPtr<IUnknown>{}};
+    for (uint32_t i = 0; i < 3; ++i) {
+      queue.Enqueue(MakeRecordingTask(results, 0, i));
+    }
+
+    Mso::DispatchTask task;
+    TestCheck(queue.TryDequeue(task));
+    queue.Enqueue(MakeRecordingTask(results, 0, 3));
+
+    std::vector<Mso::DispatchTask> tasks;
+    TestCheck(queue.DequeueAll(tasks));
+    TestCheck(tasks.size() == 3);
+    TestCheck(queue.IsEmpty());
+    TestCheck(!queue.DequeueAll(tasks));
+
+    for (auto &pendingTask : tasks) {
+      pendingTask();
+    }
+
+    TestCheck(results[0] == (std::vector<uint32_t>{1, 2, 3}));
+  }
+
+  TEST_METHOD(TaskQueue_ConcurrentProducersKeepOrder) {
+    std::vector<std::vector<uint32_t>> results(ProducerCount);
+    Mso::TaskQueue queue{Mso::WeakPtr<IUnknown>{}};
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < ProducerCount; ++producer) {
+      producers.emplace_back([&queue, &results, producer]() {
+        for (uint32_t i = 0; i < TasksPerProducer; ++i) {
+          queue.Enqueue(MakeRecordingTask(results, producer, i));
+        }
+      });
+    }
+
+    uint32_t dequeuedCount{0};
+    Mso::DispatchTask task;
+    while (dequeuedCount < ProducerCount * TasksPerProducer) {
+      if (queue.TryDequeue(task)) {
+        task();
+        ++dequeuedCount;
+      }
+    }
+
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    TestCheck(queue.IsEmpty());
+    for (auto &producerResults : results) {
+      TestCheck(producerResults.size() == TasksPerProducer);
+      for (uint32_t i = 0; i < TasksPerProducer; ++i) {
+        TestCheckEqual(i, producerResults[i]);
+      }
+    }
+  }
+};
+
+#ifdef PERF_TESTS
+
+namespace {
+
+// The task queue used before TaskQueue became lock-free: two vectors swapped under a mutex.
+struct DoubleBufferTaskQueue {
+  void Enqueue(Mso::DispatchTask &&task) noexcept {
+    std::lock_guard lock{m_mutex};
+    m_writeBuffer.push_back(std::move(task));
+  }
+
+  bool TryDequeue(Mso::DispatchTask &task) noexcept {
+    std::lock_guard lock{m_mutex};
+    if (m_readIndex == m_readBuffer.size()) {
+      m_readBuffer.clear();
+      m_readIndex = 0;
+      m_readBuffer.swap(m_writeBuffer);
+    }
+
+    if (m_readIndex < m_readBuffer.size()) {
+      task = std::move(m_readBuffer[m_readIndex++]);
+      return true;
+    }
+
+    return false;
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::vector<Mso::DispatchTask> m_writeBuffer;
+  std::vector<Mso::DispatchTask> m_readBuffer;
+  size_t m_readIndex{0};
+};
+
+// Measures how long it takes producerCount threads to post tasksPerProducer tasks each
+// while one consumer thread drains the queue.
+template <typename TQueue>
+double MeasureContention(TQueue &queue, uint32_t producerCount, uint32_t tasksPerProducer) {
+  std::atomic<uint32_t> invokeCount{0};
+  auto start = std::chrono::steady_clock::now();
+
+  std::thread consumer([&]() {
+    Mso::DispatchTask task;
+    uint32_t dequeuedCount{0};
+    while (dequeuedCount < producerCount * tasksPerProducer) {
+      if (queue.TryDequeue(task)) {
+        task();
+        ++dequeuedCount;
+      }
+    }
+  });
+
+  std::vector<std::thread> producers;
+  for (uint32_t producer = 0; producer < producerCount; ++producer) {
+    producers.emplace_back([&]() {
+      for (uint32_t i = 0; i < tasksPerProducer; ++i) {
+        queue.Enqueue([&invokeCount]() noexcept { invokeCount.fetch_add(1, std::memory_order_relaxed); });
+      }
+    });
+  }
+
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  consumer.join();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST_CLASS (TaskQueuePerfTest) {
+  TEST_METHOD(TaskQueuePerf_ProducerContention) {
+    constexpr uint32_t tasksPerProducer{200000};
+    for (uint32_t producerCount : {1, 2, 4, 8}) {
+      Mso::TaskQueue lockFreeQueue{Mso::WeakPtr<IUnknown>{}};
+      double lockFreeTime = MeasureContention(lockFreeQueue, producerCount, tasksPerProducer);
+
+      DoubleBufferTaskQueue doubleBufferQueue;
+      double doubleBufferTime = MeasureContention(doubleBufferQueue, producerCount, tasksPerProducer);
+
+      double taskCount = static_cast<double>(producerCount) * tasksPerProducer;
+      std::printf(
+          "TaskQueuePerf_ProducerContention: producers=%u; TaskQueue=%.1f ns/task; DoubleBuffer=%.1f ns/task\n",
+          producerCount,
+          lockFreeTime / taskCount * 1e9,
+          doubleBufferTime / taskCount * 1e9);
+    }
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace DispatchQueueTests
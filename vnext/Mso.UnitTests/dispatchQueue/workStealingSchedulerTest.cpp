@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "src/dispatchQueue/workStealingScheduler.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "motifCpp/testCheck.h"
+
+using namespace std::chrono_literals;
+
+namespace DispatchQueueTests {
+
+namespace {
+
+Mso::DispatchQueue MakeWorkStealingQueue(uint32_t maxThreads) noexcept {
+  return Mso::DispatchQueue::MakeCustomQueue(Mso::DispatchQueueStatic::MakeWorkStealingScheduler(maxThreads));
+}
+
+struct CompletionEvent {
+  void Set() noexcept {
+    std::lock_guard lock{m_mutex};
+    m_isSet = true;
+    m_whenSet.notify_all();
+  }
+
+  void Wait() noexcept {
+    std::unique_lock lock{m_mutex};
+    m_whenSet.wait(lock, [this]() { return m_isSet; });
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_whenSet;
+  bool m_isSet{false};
+};
+
+} // namespace
+
+TEST_CLASS (WorkStealingSchedulerTest) {
+  TEST_METHOD(WorkStealingScheduler_SerialQueueKeepsOrder) {
+    std::vector<uint32_t> results;
+    std::atomic<bool> hasThreadAccess{true};
+    Mso::DispatchQueue queue = MakeWorkStealingQueue(1);
+    TestCheck(queue.IsSerial());
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+      queue.Post([&results, &hasThreadAccess, queue, i]() noexcept {
+        hasThreadAccess = hasThreadAccess && queue.HasThreadAccess();
+        results.push_back(i);
+      });
+    }
+
+    CompletionEvent completed;
+    queue.Post([&completed]() noexcept { completed.Set(); });
+    completed.Wait();
+
+    TestCheck(!queue.HasThreadAccess());
+    TestCheck(hasThreadAccess);
+    TestCheckEqual(size_t{1000}, results.size());
+    for (uint32_t i = 0; i < 1000; ++i) {
+      TestCheckEqual(i, results[i]);
+    }
+  }
+
+  TEST_METHOD(WorkStealingScheduler_ConcurrentQueueRunsContinuations) {
+    // Each task posts continuations from a pool thread, which go to the worker's own deque.
+    constexpr uint32_t rootTaskCount{100};
+    constexpr uint32_t continuationCount{100};
+    constexpr uint32_t totalTaskCount{rootTaskCount * (continuationCount + 1)};
+    std::atomic<uint32_t> invokeCount{0};
+    CompletionEvent completed;
+    auto countInvoke = [&invokeCount, &completed]() noexcept {
+      if (++invokeCount == totalTaskCount) {
+        completed.Set();
+      }
+    };
+
+    Mso::DispatchQueue queue = MakeWorkStealingQueue(0);
+    TestCheck(!queue.IsSerial());
+
+    for (uint32_t i = 0; i < rootTaskCount; ++i) {
+      queue.Post([countInvoke, queue]() noexcept {
+        for (uint32_t j = 0; j < continuationCount; ++j) {
+          queue.Post(countInvoke);
+        }
+
+        countInvoke();
+      });
+    }
+
+    completed.Wait();
+    TestCheckEqual(totalTaskCount, invokeCount.load());
+  }
+
+  TEST_METHOD(WorkStealingScheduler_ReleaseFromTask) {
+    // Check that there is no dead lock if the last queue reference is released by its own task.
+    CompletionEvent completed;
+    {
+      Mso::DispatchQueue queue = MakeWorkStealingQueue(1);
+      queue.Post([&completed, queue]() mutable noexcept {
+        queue = nullptr;
+        completed.Set();
+      });
+    }
+
+    completed.Wait();
+  }
+
+  TEST_METHOD(WorkStealingScheduler_DeferredWorkIsStolenLast) {
+    // Two workers: the first one is blocked by the gate task until the second one has both deferred and normal work
+    // in its deque. The first one then steals, and it must take the normal work.
+    // The pool is never deleted. Shutdown lets its workers exit.
+    auto threadPool = new Mso::WorkStealingThreadPool{2};
+    auto makeQueue = [threadPool]() noexcept {
+      return Mso::DispatchQueue::MakeCustomQueue(
+          Mso::Make<Mso::WorkStealingScheduler, Mso::IDispatchQueueScheduler>(*threadPool, 1u));
+    };
+
+    Mso::DispatchQueue gateQueue = makeQueue();
+    Mso::DispatchQueue slicedQueue = makeQueue();
+    Mso::DispatchQueue normalQueue = makeQueue();
+    Mso::DispatchQueue blockingQueue = makeQueue();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    CompletionEvent gateStarted;
+    CompletionEvent gateReleased;
+    CompletionEvent firstRun;
+    CompletionEvent allRun;
+    auto record = [&](char const *name) noexcept {
+      std::lock_guard lock{mutex};
+      order.push_back(name);
+      if (order.size() == 1) {
+        firstRun.Set();
+      } else if (order.size() == 2) {
+        allRun.Set();
+      }
+    };
+
+    gateQueue.Post([&]() noexcept {
+      gateStarted.Set();
+      gateReleased.Wait();
+    });
+    gateStarted.Wait();
+
+    slicedQueue.Post([&]() noexcept {
+      // Posted from the second worker, these go to its own deque.
+      normalQueue.Post([&]() noexcept { record("normal"); });
+      blockingQueue.Post([&]() noexcept {
+        // The second worker takes it from the back of its deque and waits here while the first worker steals.
+        gateReleased.Set();
+        firstRun.Wait();
+      });
+
+      // Use up the time slice, so that the next slicedQueue task is deferred.
+      slicedQueue.Post([&]() noexcept { record("deferred"); });
+      std::this_thread::sleep_for(20ms);
+    });
+
+    allRun.Wait();
+    threadPool->Shutdown();
+
+    TestCheckEqual(size_t{2}, order.size());
+    TestCheckEqual("normal", order[0]);
+    TestCheckEqual("deferred", order[1]);
+  }
+};
+
+} // namespace DispatchQueueTests
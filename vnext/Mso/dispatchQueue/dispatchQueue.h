@@ -5,6 +5,7 @@
 #ifndef MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 #define MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 
+#include <chrono>
 #include <optional>
 #include <thread>
 #include "functional/functor.h"
@@ -48,6 +49,17 @@ enum class PendingTaskAction {
   Cancel,
 };
 
+//! Priority lane of a posted task. Tasks from a higher priority lane are invoked first.
+//! Tasks in the same lane are invoked in the order they were posted.
+enum class DispatchTaskPriority {
+  //! For tasks that must not wait behind other work, such as input handling.
+  High,
+  //! The lane used by Post, InvokeElsePost, and DeferElsePost.
+  Normal,
+  //! For background work that runs only when there are no other tasks.
+  Idle,
+};
+
 //! Callback type to handle queue local values
 using SwapDispatchLocalValueCallback = void (*)(void **localValue, void **tlsValue) noexcept;
 
@@ -149,6 +161,23 @@ struct DispatchQueue {
   //! Post the task to the end of the queue for asynchronous invocation.
   void Post(DispatchTask &&task) const noexcept;
 
+  //! Post the task to the end of the priority lane for asynchronous invocation.
+  void Post(DispatchTask &&task, DispatchTaskPriority priority) const noexcept;
+
+  //! Post the task to the priority lane after the delay expires.
+  //! Delayed tasks that are not due yet are canceled when the queue is shutdown.
+  void PostDelayed(
+      DispatchTask &&task,
+      std::chrono::steady_clock::duration delay,
+      DispatchTaskPriority priority = DispatchTaskPriority::Normal) const noexcept;
+
+  //! Post the task to the priority lane when the due time is reached.
+  //! Delayed tasks that are not due yet are canceled when the queue is shutdown.
+  void PostAt(
+      DispatchTask &&task,
+      std::chrono::steady_clock::time_point dueTime,
+      DispatchTaskPriority priority = DispatchTaskPriority::Normal) const noexcept;
+
   //! Invoke the task immediately if the queue uses the current thread. Otherwise, post it.
   //! The immediate execution ignores the suspend or shutdown states.
   void InvokeElsePost(DispatchTask &&task) const noexcept;
@@ -405,6 +434,16 @@ struct IDispatchQueueService : IUnknown {
 
   //! Calls ICancellationListener::OnCancel in case if task implements the ICancellationListener interface.
   virtual void CancelTask(DispatchTask &&task) noexcept = 0;
+
+  //! Add task to the end of the asynchronous queue lane for the provided priority.
+  //! Unlike Post, it ignores task batching for priorities other than DispatchTaskPriority::Normal.
+  virtual void PostWithPriority(DispatchTask &&task, DispatchTaskPriority priority) noexcept = 0;
+
+  //! Add task to the asynchronous queue lane for the provided priority when the due time is reached.
+  virtual void PostAt(
+      DispatchTask &&task,
+      std::chrono::steady_clock::time_point dueTime,
+      DispatchTaskPriority priority) noexcept = 0;
 };
 
 //! The interface for dispatch queue static members.
@@ -578,6 +617,24 @@ inline void DispatchQueue::Post(DispatchTask &&task) const noexcept {
   m_state->Post(std::move(task));
 }
 
+inline void DispatchQueue::Post(DispatchTask &&task, DispatchTaskPriority priority) const noexcept {
+  m_state->PostWithPriority(std::move(task), priority);
+}
+
+inline void DispatchQueue::PostDelayed(
+    DispatchTask &&task,
+    std::chrono::steady_clock::duration delay,
+    DispatchTaskPriority priority /*= DispatchTaskPriority::Normal*/) const noexcept {
+  m_state->PostAt(std::move(task), std::chrono::steady_clock::now() + delay, priority);
+}
+
+inline void DispatchQueue::PostAt(
+    DispatchTask &&task,
+    std::chrono::steady_clock::time_point dueTime,
+    DispatchTaskPriority priority /*= DispatchTaskPriority::Normal*/) const noexcept {
+  m_state->PostAt(std::move(task), dueTime, priority);
+}
+
 inline void DispatchQueue::InvokeElsePost(DispatchTask &&task) const noexcept {
   m_state->InvokeElsePost(std::move(task));
 }
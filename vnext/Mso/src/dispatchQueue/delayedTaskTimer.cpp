@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "delayedTaskTimer.h"
+#include "queueService.h"
+
+namespace Mso {
+
+//=============================================================================
+// DelayedTaskTimer implementation.
+//=============================================================================
+
+/*static*/ DelayedTaskTimer &DelayedTaskTimer::Instance() noexcept {
+  // The instance is never destroyed: queues released by it on process exit would call back into it.
+  static DelayedTaskTimer *instance{new DelayedTaskTimer()};
+  return *instance;
+}
+
+DelayedTaskTimer::DelayedTaskTimer() noexcept : m_thread{[this]() noexcept { Run(); }} {}
+
+void DelayedTaskTimer::Schedule(QueueService &queue, std::chrono::steady_clock::time_point dueTime) noexcept {
+  {
+    std::lock_guard lock{m_mutex};
+    Mso::CntPtr<QueueService> queuePtr;
+    auto it = m_registrations.find(&queue);
+    if (it != m_registrations.end()) {
+      if (it->second->first <= dueTime) {
+        return;
+      }
+
+      queuePtr = std::move(it->second->second);
+      m_dueTimes.erase(it->second);
+    } else {
+      queuePtr = Mso::CntPtr<QueueService>{&queue};
+    }
+
+    auto dueTimeIt = m_dueTimes.emplace(dueTime, std::move(queuePtr));
+    m_registrations[&queue] = dueTimeIt;
+    if (dueTimeIt != m_dueTimes.begin()) {
+      return;
+    }
+  }
+
+  m_wakeUp.notify_one();
+}
+
+void DelayedTaskTimer::Unschedule(QueueService &queue) noexcept {
+  Mso::CntPtr<QueueService> queuePtr;
+
+  {
+    std::lock_guard lock{m_mutex};
+    auto it = m_registrations.find(&queue);
+    if (it != m_registrations.end()) {
+      queuePtr = std::move(it->second->second);
+      m_dueTimes.erase(it->second);
+      m_registrations.erase(it);
+    }
+  }
+}
+
+void DelayedTaskTimer::Run() noexcept {
+  std::unique_lock lock{m_mutex};
+  for (;;) {
+    if (m_dueTimes.empty()) {
+      m_wakeUp.wait(lock);
+      continue;
+    }
+
+    auto it = m_dueTimes.begin();
+    if (std::chrono::steady_clock::now() < it->first) {
+      m_wakeUp.wait_until(lock, it->first);
+      continue;
+    }
+
+    Mso::CntPtr<QueueService> queue = std::move(it->second);
+    m_registrations.erase(queue.Get());
+    m_dueTimes.erase(it);
+
+    lock.unlock();
+    queue->PostDueTasks();
+    queue = nullptr;
+    lock.lock();
+  }
+}
+
+} // namespace Mso
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include "object/refCountedObject.h"
+
+namespace Mso {
+
+// Forward declarations
+struct QueueService;
+
+//! Process-wide timer thread that wakes up dispatch queues when their delayed tasks are due.
+//! Each QueueService keeps its delayed tasks in its own heap and registers here only the due time of
+//! the earliest one. The registration keeps the queue alive the same way as a posted task does.
+struct DelayedTaskTimer {
+  static DelayedTaskTimer &Instance() noexcept;
+
+  DelayedTaskTimer() noexcept;
+
+  DelayedTaskTimer(DelayedTaskTimer const &other) = delete;
+  DelayedTaskTimer &operator=(DelayedTaskTimer const &other) = delete;
+
+  //! Calls QueueService::PostDueTasks at the due time. A queue has at most one registration,
+  //! and it is only replaced by a registration with an earlier due time.
+  void Schedule(QueueService &queue, std::chrono::steady_clock::time_point dueTime) noexcept;
+
+  //! Removes the queue registration if there is one.
+  void Unschedule(QueueService &queue) noexcept;
+
+ private:
+  using DueTimeMap = std::multimap<std::chrono::steady_clock::time_point, Mso::CntPtr<QueueService>>;
+
+  void Run() noexcept;
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_wakeUp;
+  DueTimeMap m_dueTimes;
+  std::unordered_map<QueueService *, DueTimeMap::iterator> m_registrations;
+  std::thread m_thread; // it must be last in the initialization list
+};
+
+} // namespace Mso
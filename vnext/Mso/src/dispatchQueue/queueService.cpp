@@ -2,6 +2,8 @@
 // Licensed under the MIT license.
 
 #include "queueService.h"
+#include <algorithm>
+#include "delayedTaskTimer.h"
 #include "taskBatch.h"
 #include "taskContext.h"
 
@@ -23,34 +25,40 @@ QueueService::~QueueService() noexcept {
 void QueueService::Post(DispatchTask &&task) noexcept {
   VerifyElseCrashSz(task, "The task is empty");
 
-  bool isShutdown = false;
-  bool shouldSchedule = false;
-
-  {
+  if (m_taskBatchCount.load() != 0) {
     std::lock_guard lock{m_mutex};
     auto it = m_taskBatches.find(std::this_thread::get_id());
     if (it != m_taskBatches.end()) {
       it->second->AddTask(std::move(task));
-    } else {
-      isShutdown = m_shutdownAction.has_value();
-      if (!isShutdown) {
-        m_queue.Enqueue(std::move(task));
-        shouldSchedule = (m_suspendCounter == 0);
-      }
+      return;
     }
   }
 
+  EnqueueTask(std::move(task), DispatchTaskPriority::Normal);
+}
+
+void QueueService::EnqueueTask(DispatchTask &&task, DispatchTaskPriority priority) noexcept {
+  if (m_postState.fetch_add(PostInProgressStep) & ShutdownFlag) {
+    m_postState.fetch_sub(PostInProgressStep);
+    CancelTask(std::move(task));
+    return;
+  }
+
+  Lane(priority).Enqueue(std::move(task));
+
+  // Resume decrements the counter before it reads the queue size, so either we see the queue resumed
+  // or Resume sees our task.
+  bool shouldSchedule = (m_suspendCounter.load() == 0);
+  m_postState.fetch_sub(PostInProgressStep);
+
   if (shouldSchedule) {
     m_scheduler->Post();
-  } else if (isShutdown) {
-    CancelTask(std::move(task));
   }
 }
 
 bool QueueService::ShouldYield(TaskYieldReason *yieldReason) noexcept {
   auto setReason = [&](TaskYieldReason reason) noexcept { return yieldReason ? *yieldReason = reason : reason, true; };
-  std::lock_guard lock{m_mutex};
-  return (m_shutdownAction.has_value() && setReason(TaskYieldReason::QueueShutdown)) ||
+  return ((m_postState.load() & ShutdownFlag) && setReason(TaskYieldReason::QueueShutdown)) ||
       (m_suspendCounter > 0 && setReason(TaskYieldReason::QueueSuspended));
 }
 
@@ -91,7 +99,8 @@ void QueueService::BeginTaskBatching() noexcept {
   auto taskBatch{Mso::Make<TaskBatch>()};
   std::lock_guard lock{m_mutex};
   auto result = m_taskBatches.try_emplace(std::this_thread::get_id(), std::move(taskBatch));
-  if (result.second) {
+  ++m_taskBatchCount;
+  if (!result.second) {
     taskBatch->SetEnclosingBatch(std::move(result.first->second));
     result.first->second = std::move(taskBatch);
   }
@@ -103,6 +112,7 @@ DispatchTask QueueService::EndTaskBatching() noexcept {
   auto it = m_taskBatches.find(std::this_thread::get_id());
   if (it != m_taskBatches.end()) {
     taskBatch = std::move(it->second);
+    --m_taskBatchCount;
     if (auto enclosingBatch = taskBatch->TakeEnclosingBatch()) {
       it->second = std::move(enclosingBatch);
     } else {
@@ -116,6 +126,10 @@ DispatchTask QueueService::EndTaskBatching() noexcept {
 }
 
 bool QueueService::HasTaskBatching() noexcept {
+  if (m_taskBatchCount.load() == 0) {
+    return false;
+  }
+
   std::lock_guard lock{m_mutex};
   return m_taskBatches.find(std::this_thread::get_id()) != m_taskBatches.end();
 }
@@ -144,19 +158,20 @@ bool QueueService::TrySwapLocalValue(
 }
 
 void QueueService::Suspend() noexcept {
-  std::lock_guard lock{m_mutex};
   ++m_suspendCounter;
 }
 
 void QueueService::Resume() noexcept {
   size_t postCount{0};
 
-  {
-    std::lock_guard lock{m_mutex};
-    VerifyElseCrashSz(m_suspendCounter > 0, "m_suspendCounter must not be negative");
+  int32_t suspendCounter = --m_suspendCounter;
+  VerifyElseCrashSz(suspendCounter >= 0, "m_suspendCounter must not be negative");
 
-    if (--m_suspendCounter == 0) {
-      postCount = m_queue.Size();
+  // A task posted concurrently may be scheduled by both Post and Resume.
+  // The extra scheduler Post finds no task to dequeue.
+  if (suspendCounter == 0) {
+    for (auto &queue : m_queues) {
+      postCount += queue.Size();
     }
   }
 
@@ -168,14 +183,20 @@ void QueueService::Resume() noexcept {
 void QueueService::Shutdown(PendingTaskAction pendingTaskAction) noexcept {
   std::vector<DispatchTask> tasksToCancel;
 
-  {
-    std::lock_guard lock{m_mutex};
-    m_shutdownAction = pendingTaskAction;
-    if (pendingTaskAction == PendingTaskAction::Cancel) {
-      m_queue.DequeueAll(/*out*/ tasksToCancel);
+  // Wait for the Post calls that got in before the shutdown to finish enqueueing.
+  m_postState.fetch_or(ShutdownFlag);
+  while (m_postState.load() != ShutdownFlag) {
+    std::this_thread::yield();
+  }
+
+  if (pendingTaskAction == PendingTaskAction::Cancel) {
+    for (auto &queue : m_queues) {
+      queue.DequeueAll(/*out*/ tasksToCancel);
     }
   }
 
+  CancelDelayedTasks();
+
   for (auto &task : tasksToCancel) {
     CancelTask(std::move(task));
   }
@@ -189,13 +210,23 @@ void QueueService::AwaitTermination() noexcept {
 }
 
 bool QueueService::HasTasks() noexcept {
-  std::lock_guard lock{m_mutex};
-  return m_suspendCounter == 0 && !m_queue.IsEmpty();
+  return m_suspendCounter == 0 &&
+      std::any_of(m_queues.begin(), m_queues.end(), [](TaskQueue const &queue) noexcept { return !queue.IsEmpty(); });
 }
 
 bool QueueService::TryDequeTask(/*out*/ DispatchTask &task) noexcept {
-  std::lock_guard lock{m_mutex};
-  return m_suspendCounter == 0 && m_queue.TryDequeue(/*out*/ task);
+  if (m_suspendCounter != 0) {
+    return false;
+  }
+
+  // Lanes are checked in priority order, so a posted high priority task is invoked next.
+  for (auto &queue : m_queues) {
+    if (queue.TryDequeue(/*out*/ task)) {
+      return true;
+    }
+  }
+
+  return false;
 }
 
 void QueueService::InvokeTask(
@@ -217,6 +248,101 @@ void QueueService::CancelTask(DispatchTask &&task) noexcept {
   }
 }
 
+void QueueService::PostWithPriority(DispatchTask &&task, DispatchTaskPriority priority) noexcept {
+  if (priority == DispatchTaskPriority::Normal) {
+    Post(std::move(task));
+    return;
+  }
+
+  VerifyElseCrashSz(task, "The task is empty");
+  EnqueueTask(std::move(task), priority);
+}
+
+void QueueService::PostAt(
+    DispatchTask &&task,
+    std::chrono::steady_clock::time_point dueTime,
+    DispatchTaskPriority priority) noexcept {
+  VerifyElseCrashSz(task, "The task is empty");
+
+  if (dueTime <= std::chrono::steady_clock::now()) {
+    PostWithPriority(std::move(task), priority);
+    return;
+  }
+
+  bool isShutdown{false};
+  bool isEarliestTask{false};
+
+  {
+    // Shutdown sets the flag before it takes the delayed tasks under the same lock.
+    std::lock_guard lock{m_delayedTaskMutex};
+    isShutdown = (m_postState.load() & ShutdownFlag) != 0;
+    if (!isShutdown) {
+      uint64_t sequence = m_nextDelayedTaskSequence++;
+      m_delayedTasks.push_back(DelayedTask{dueTime, sequence, priority, std::move(task)});
+      std::push_heap(m_delayedTasks.begin(), m_delayedTasks.end(), IsDueLater);
+      isEarliestTask = m_delayedTasks.front().Sequence == sequence;
+    }
+  }
+
+  if (isShutdown) {
+    CancelTask(std::move(task));
+  } else if (isEarliestTask) {
+    DelayedTaskTimer::Instance().Schedule(*this, dueTime);
+  }
+}
+
+void QueueService::PostDueTasks() noexcept {
+  std::vector<DelayedTask> dueTasks;
+  std::optional<std::chrono::steady_clock::time_point> nextDueTime;
+
+  {
+    std::lock_guard lock{m_delayedTaskMutex};
+    auto now = std::chrono::steady_clock::now();
+    while (!m_delayedTasks.empty() && m_delayedTasks.front().DueTime <= now) {
+      std::pop_heap(m_delayedTasks.begin(), m_delayedTasks.end(), IsDueLater);
+      dueTasks.push_back(std::move(m_delayedTasks.back()));
+      m_delayedTasks.pop_back();
+    }
+
+    if (!m_delayedTasks.empty()) {
+      nextDueTime = m_delayedTasks.front().DueTime;
+    }
+  }
+
+  for (auto &dueTask : dueTasks) {
+    EnqueueTask(std::move(dueTask.Task), dueTask.Priority);
+  }
+
+  if (nextDueTime) {
+    DelayedTaskTimer::Instance().Schedule(*this, *nextDueTime);
+  }
+}
+
+/*static*/ bool QueueService::IsDueLater(DelayedTask const &left, DelayedTask const &right) noexcept {
+  return left.DueTime > right.DueTime || (left.DueTime == right.DueTime && left.Sequence > right.Sequence);
+}
+
+void QueueService::CancelDelayedTasks() noexcept {
+  std::vector<DelayedTask> delayedTasks;
+
+  {
+    std::lock_guard lock{m_delayedTaskMutex};
+    delayedTasks.swap(m_delayedTasks);
+  }
+
+  if (!delayedTasks.empty()) {
+    DelayedTaskTimer::Instance().Unschedule(*this);
+  }
+
+  for (auto &delayedTask : delayedTasks) {
+    CancelTask(std::move(delayedTask.Task));
+  }
+}
+
+TaskQueue &QueueService::Lane(DispatchTaskPriority priority) noexcept {
+  return m_queues[static_cast<size_t>(priority)];
+}
+
 //=============================================================================
 // LocalValueEntry implementation.
 //=============================================================================
@@ -3,11 +3,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <thread>
+#include <vector>
 #include "eventWaitHandle/eventWaitHandle.h"
 #include "object/refCountedObject.h"
 #include "taskQueue.h"
+#include "threadMutex.h"
 
 namespace Mso {
 
@@ -50,19 +54,54 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
   bool TryDequeTask(/*out*/ DispatchTask &task) noexcept override;
   void InvokeTask(DispatchTask &&task, std::optional<std::chrono::steady_clock::time_point> endTime) noexcept override;
   void CancelTask(DispatchTask &&task) noexcept override;
+  void PostWithPriority(DispatchTask &&task, DispatchTaskPriority priority) noexcept override;
+  void PostAt(
+      DispatchTask &&task,
+      std::chrono::steady_clock::time_point dueTime,
+      DispatchTaskPriority priority) noexcept override;
+
+ public:
+  //! Moves delayed tasks that are due to their priority lanes. Called by DelayedTaskTimer.
+  void PostDueTasks() noexcept;
 
  private:
+  struct DelayedTask {
+    std::chrono::steady_clock::time_point DueTime;
+    uint64_t Sequence; // Keeps the posting order for tasks with the same due time.
+    DispatchTaskPriority Priority;
+    DispatchTask Task;
+  };
+
+  static bool IsDueLater(DelayedTask const &left, DelayedTask const &right) noexcept;
+
+  void EnqueueTask(DispatchTask &&task, DispatchTaskPriority priority) noexcept;
+  void CancelDelayedTasks() noexcept;
+  TaskQueue &Lane(DispatchTaskPriority priority) noexcept;
+
   bool TrySwapLocalValue(
       SwapDispatchLocalValueCallback swapLocalValue,
       void **tlsValue,
       LocalValueSwapAction action) noexcept;
 
+ private:
+  // m_postState holds the ShutdownFlag bit and counts Post calls in progress in steps of PostInProgressStep.
+  // Shutdown sets the flag and waits for posts in progress to finish, so no task is enqueued after it.
+  static constexpr uint32_t ShutdownFlag{1};
+  static constexpr uint32_t PostInProgressStep{2};
+
  private:
   const Mso::CntPtr<IDispatchQueueScheduler> m_scheduler;
-  ThreadMutex m_mutex;
-  TaskQueue m_queue{static_cast<IDispatchQueue *>(this)};
-  std::optional<PendingTaskAction> m_shutdownAction;
-  int32_t m_suspendCounter{0};
+  ThreadMutex m_mutex; // Protects m_taskBatches and m_localValues.
+  std::array<TaskQueue, 3> m_queues{ // Priority lanes in the DispatchTaskPriority order.
+      TaskQueue{static_cast<IDispatchQueue *>(this)},
+      TaskQueue{static_cast<IDispatchQueue *>(this)},
+      TaskQueue{static_cast<IDispatchQueue *>(this)}};
+  std::mutex m_delayedTaskMutex;
+  std::vector<DelayedTask> m_delayedTasks; // Min-heap by due time. Protected by m_delayedTaskMutex.
+  uint64_t m_nextDelayedTaskSequence{0};
+  std::atomic<uint32_t> m_postState{0};
+  std::atomic<int32_t> m_suspendCounter{0};
+  std::atomic<uint32_t> m_taskBatchCount{0}; // Lets Post skip the m_taskBatches lookup when nothing is batched.
   std::map<std::thread::id, Mso::CntPtr<TaskBatch>> m_taskBatches;
   std::map<ptrdiff_t, QueueLocalValueEntry> m_localValues;
 };
@@ -83,6 +122,7 @@ struct DispatchQueueStatic : Mso::UnknownObject<Mso::RefCountStrategy::NoRefCoun
   static DispatchQueueStatic *Instance() noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeLooperScheduler(DispatchQueueSettings const &settings) noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeThreadPoolScheduler(uint32_t maxThreads) noexcept;
+  static Mso::CntPtr<IDispatchQueueScheduler> MakeWorkStealingScheduler(uint32_t maxThreads) noexcept;
 
  public: // IDispatchQueueStatic
   DispatchQueue CurrentQueue() noexcept override;
@@ -2,38 +2,10 @@
 // Licensed under the MIT license.
 
 #include "taskQueue.h"
+#include <memory>
 
 namespace Mso {
 
-//=============================================================================
-// TaskReadBuffer implementation.
-//=============================================================================
-
-bool TaskReadBuffer::TryDequeue(DispatchTask &item) noexcept {
-  if (m_index < m_buffer.size()) {
-    item = std::move(m_buffer[m_index]);
-    ++m_index;
-    return true;
-  }
-
-  return false;
-}
-
-void TaskReadBuffer::SwapBuffer(std::vector<DispatchTask> &buffer) noexcept {
-  // Before swapping erase deleted items in the beginning of the buffer.
-  m_buffer.erase(m_buffer.begin(), m_buffer.begin() + m_index);
-  m_index = 0;
-  m_buffer.swap(buffer);
-}
-
-size_t TaskReadBuffer::Size() const noexcept {
-  return m_buffer.size() - m_index;
-}
-
-bool TaskReadBuffer::IsEmpty() const noexcept {
-  return m_index == m_buffer.size();
-}
-
 //=============================================================================
 // TaskQueue implementation.
 //=============================================================================
@@ -42,59 +14,114 @@ TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept : m_weakOwn
 
 TaskQueue::~TaskQueue() noexcept {
   VerifyElseCrashSz(IsEmpty(), "Queue must be empty before destruction.");
+  VerifyElseCrashSz(!m_readHead && !m_writeHead.load(), "Queue must be empty before destruction.");
 }
 
 void TaskQueue::Enqueue(DispatchTask &&task) noexcept {
-  bool queueWasEmpty{IsEmpty()};
-  m_writeBuffer.push_back(std::move(task));
-  if (queueWasEmpty) {
-    m_strongOwnerPtr = m_weakOwnerPtr.GetStrongPtr();
+  Node *node = new Node{std::move(task), m_writeHead.load(std::memory_order_relaxed)};
+  while (!m_writeHead.compare_exchange_weak(node->Next, node, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+
+  if (m_size.fetch_add(1) == 0) {
+    UpdateOwnerReference();
   }
 }
 
 bool TaskQueue::TryDequeue(/*out*/ DispatchTask &task) noexcept {
-  if (m_readBuffer.IsEmpty() && !m_writeBuffer.empty()) {
-    m_readBuffer.SwapBuffer(m_writeBuffer);
+  {
+    std::lock_guard lock{m_readMutex};
+    if (!m_readHead) {
+      TakeWrittenTasks();
+      if (!m_readHead) {
+        return false;
+      }
+    }
+
+    std::unique_ptr<Node> node{m_readHead};
+    m_readHead = node->Next;
+    task = std::move(node->Task);
   }
 
-  bool result = m_readBuffer.TryDequeue(/*out*/ task);
-  if (result && IsEmpty()) {
-    m_strongOwnerPtr = nullptr;
+  if (m_size.fetch_sub(1) == 1) {
+    UpdateOwnerReference();
   }
 
-  return result;
+  return true;
 }
 
 bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
-  if (IsEmpty()) {
-    return false;
+  int64_t count{0};
+
+  {
+    std::lock_guard lock{m_readMutex};
+    if (!m_readHead) {
+      TakeWrittenTasks();
+    }
+
+    // Tasks pushed after the read list was taken are newer than everything in it.
+    while (m_readHead) {
+      for (Node *node = m_readHead; node; ++count) {
+        std::unique_ptr<Node> current{node};
+        node = node->Next;
+        tasks.push_back(std::move(current->Task));
+      }
+
+      m_readHead = nullptr;
+      TakeWrittenTasks();
+    }
   }
 
-  tasks.reserve(tasks.size() + m_readBuffer.Size() + m_writeBuffer.size());
-
-  if (!m_readBuffer.IsEmpty()) {
-    std::vector<DispatchTask> readBuffer;
-    m_readBuffer.SwapBuffer(readBuffer);
-    tasks.insert(tasks.end(), std::make_move_iterator(readBuffer.begin()), std::make_move_iterator(readBuffer.end()));
+  if (count == 0) {
+    return false;
   }
 
-  if (!m_writeBuffer.empty()) {
-    tasks.insert(
-        tasks.end(), std::make_move_iterator(m_writeBuffer.begin()), std::make_move_iterator(m_writeBuffer.end()));
-    m_writeBuffer.clear();
+  int64_t oldSize = m_size.fetch_sub(count);
+  if (oldSize > 0 && oldSize <= count) {
+    UpdateOwnerReference();
   }
 
-  m_strongOwnerPtr = nullptr;
-
   return true;
 }
 
 size_t TaskQueue::Size() const noexcept {
-  return m_readBuffer.Size() + m_writeBuffer.size();
+  int64_t size = m_size.load();
+  return size > 0 ? static_cast<size_t>(size) : 0;
 }
 
 bool TaskQueue::IsEmpty() const noexcept {
-  return m_readBuffer.IsEmpty() && m_writeBuffer.empty();
+  return m_size.load() <= 0;
+}
+
+void TaskQueue::TakeWrittenTasks() noexcept {
+  Node *node = m_writeHead.exchange(nullptr, std::memory_order_acquire);
+
+  // Reverse the LIFO list of written tasks to get them in the order they were enqueued.
+  Node *readHead{nullptr};
+  while (node) {
+    Node *next = node->Next;
+    node->Next = readHead;
+    readHead = node;
+    node = next;
+  }
+
+  m_readHead = readHead;
+}
+
+void TaskQueue::UpdateOwnerReference() noexcept {
+  // Producers and consumers may cross the empty boundary in any order. Re-check the size under the lock
+  // and let the last one to get here decide. The owner must be released outside of the lock.
+  Mso::CntPtr<IUnknown> releasedOwnerPtr;
+
+  {
+    std::lock_guard lock{m_ownerMutex};
+    if (m_size.load() > 0) {
+      if (!m_strongOwnerPtr) {
+        m_strongOwnerPtr = m_weakOwnerPtr.GetStrongPtr();
+      }
+    } else {
+      releasedOwnerPtr = std::move(m_strongOwnerPtr);
+    }
+  }
 }
 
 } // namespace Mso
@@ -3,36 +3,23 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 #include "dispatchQueue/dispatchQueue.h"
-#include "threadMutex.h"
 
 namespace Mso {
 
-//! ReadBuffer is used by task queue to dequeue items.
-//! It moves read index instead of resizing buffer.
-struct TaskReadBuffer {
-  TaskReadBuffer() = default;
-
-  // Prohibit copy and move
-  TaskReadBuffer(TaskReadBuffer const &other) = delete;
-  TaskReadBuffer &operator=(TaskReadBuffer const &other) = delete;
-
-  bool TryDequeue(DispatchTask &task) noexcept;
-  void SwapBuffer(std::vector<DispatchTask> &buffer) noexcept;
-  size_t Size() const noexcept;
-  bool IsEmpty() const noexcept;
-
- private:
-  std::vector<DispatchTask> m_buffer;
-  size_t m_index{0};
-};
-
-//! Simple queue that uses two buffers: one for pushing items and another for popping them.
-//! Items are always enqueued under lock.
+//! Multi-producer task queue where enqueueing never takes a lock.
+//!
+//! Producers push tasks onto an atomic singly linked list (in LIFO order) with a single compare-exchange.
+//! Consumers detach the whole list with one atomic exchange and reverse it into a private read list,
+//! so a burst of posted tasks costs the consumer one atomic operation rather than one lock per task.
+//!
+//! Dequeue operations are serialized by a read mutex that producers never touch. It is only contended
+//! when a concurrent queue has several threads dequeuing at the same time.
 //!
-//! Internally we have two vectors: one to enqueue items (write) and another to dequeue items (read).
-//! When the read queue is empty we swap them.
+//! The queue keeps a strong reference to its owner while it is not empty.
 struct TaskQueue {
   TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept;
 
@@ -49,10 +36,29 @@ struct TaskQueue {
   bool IsEmpty() const noexcept;
 
  private:
-  std::vector<DispatchTask> m_writeBuffer; // To enqueue items.
-  TaskReadBuffer m_readBuffer; // To dequeue items.
+  struct Node {
+    DispatchTask Task;
+    Node *Next;
+  };
+
+  //! Moves the tasks pushed by producers to the read list. Must be called under m_readMutex.
+  void TakeWrittenTasks() noexcept;
+
+  //! Takes or releases the strong owner reference to match the current queue size.
+  void UpdateOwnerReference() noexcept;
+
+ private:
+  std::atomic<Node *> m_writeHead{nullptr}; // Enqueued tasks in LIFO order.
+  Node *m_readHead{nullptr}; // Tasks to dequeue in FIFO order. Guarded by m_readMutex.
+  std::mutex m_readMutex;
+
+  // Incremented after a task is pushed and decremented after it is dequeued. A consumer may dequeue
+  // a task before its producer counted it, so the size can be negative for a short time.
+  std::atomic<int64_t> m_size{0};
+
+  std::mutex m_ownerMutex;
   Mso::WeakPtr<IUnknown> m_weakOwnerPtr;
-  Mso::CntPtr<IUnknown> m_strongOwnerPtr; // Keep strong reference to the owner when queu is not empty;
+  Mso::CntPtr<IUnknown> m_strongOwnerPtr; // Keep strong reference to the owner when queue is not empty.
 };
 
 } // namespace Mso
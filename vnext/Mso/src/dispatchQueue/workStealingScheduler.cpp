@@ -0,0 +1,296 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "workStealingScheduler.h"
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+using namespace std::chrono_literals;
+
+namespace Mso {
+
+//=============================================================================
+// WorkStealingThreadPool implementation
+//=============================================================================
+
+thread_local uint32_t WorkStealingThreadPool::tls_workerIndex{NotAWorker};
+
+/*static*/ WorkStealingThreadPool &WorkStealingThreadPool::Instance() noexcept {
+  // It is never deleted. See the WorkStealingThreadPool comment.
+  static WorkStealingThreadPool *instance{
+      new WorkStealingThreadPool{std::max(std::thread::hardware_concurrency(), 1u)}};
+  return *instance;
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(uint32_t threadCount) noexcept {
+  for (uint32_t i = 0; i < threadCount; ++i) {
+    m_workers.push_back(std::make_unique<Worker>());
+  }
+
+  for (uint32_t i = 0; i < threadCount; ++i) {
+    std::thread([this, i]() noexcept { RunWorker(i); }).detach();
+  }
+}
+
+uint32_t WorkStealingThreadPool::ThreadCount() const noexcept {
+  return static_cast<uint32_t>(m_workers.size());
+}
+
+bool WorkStealingThreadPool::IsWorkerThread() const noexcept {
+  return tls_workerIndex != NotAWorker;
+}
+
+void WorkStealingThreadPool::Submit(WorkItem &&item, bool isDeferred) noexcept {
+  ++m_pendingCount;
+
+  if (IsWorkerThread()) {
+    Worker &worker = *m_workers[tls_workerIndex];
+    std::lock_guard lock{worker.Mutex};
+    if (isDeferred) {
+      worker.DeferredItems.push_back(std::move(item));
+    } else {
+      worker.Items.push_back(std::move(item));
+    }
+  } else {
+    std::lock_guard lock{m_mutex};
+    m_injectedItems.push_back(std::move(item));
+  }
+
+  // Workers increment m_sleepingCount before they check m_pendingCount, so either they see the new item
+  // or we see them sleeping.
+  if (m_sleepingCount.load() > 0) {
+    std::lock_guard lock{m_mutex};
+    m_wakeUp.notify_one();
+  }
+}
+
+void WorkStealingThreadPool::Shutdown() noexcept {
+  {
+    std::lock_guard lock{m_mutex};
+    m_isShutdown = true;
+  }
+
+  m_wakeUp.notify_all();
+}
+
+bool WorkStealingThreadPool::TryRunPendingWork() noexcept {
+  WorkItem item;
+  if (IsWorkerThread() && TryTakeWork(tls_workerIndex, /*out*/ item)) {
+    item->RunTasks();
+    return true;
+  }
+
+  return false;
+}
+
+void WorkStealingThreadPool::RunWorker(uint32_t workerIndex) noexcept {
+  tls_workerIndex = workerIndex;
+
+  for (;;) {
+    WorkItem item;
+    if (TryTakeWork(workerIndex, /*out*/ item)) {
+      item->RunTasks();
+      continue;
+    }
+
+    std::unique_lock lock{m_mutex};
+    if (m_isShutdown && m_pendingCount.load() == 0) {
+      break;
+    }
+
+    ++m_sleepingCount;
+    m_wakeUp.wait(lock, [this]() noexcept { return m_pendingCount.load() > 0 || m_isShutdown; });
+    --m_sleepingCount;
+  }
+}
+
+bool WorkStealingThreadPool::TryTakeWork(uint32_t workerIndex, /*out*/ WorkItem &item) noexcept {
+  auto takeItem = [&](std::deque<WorkItem> &items, bool fromBack) noexcept {
+    if (items.empty()) {
+      return false;
+    }
+
+    if (fromBack) {
+      item = std::move(items.back());
+      items.pop_back();
+    } else {
+      item = std::move(items.front());
+      items.pop_front();
+    }
+
+    --m_pendingCount;
+    return true;
+  };
+
+  {
+    Worker &worker = *m_workers[workerIndex];
+    std::lock_guard lock{worker.Mutex};
+    if (takeItem(worker.Items, /*fromBack:*/ true)) {
+      return true;
+    }
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+    if (takeItem(m_injectedItems, /*fromBack:*/ false)) {
+      return true;
+    }
+  }
+
+  const uint32_t workerCount = ThreadCount();
+  for (uint32_t i = 1; i < workerCount; ++i) {
+    Worker &victim = *m_workers[(workerIndex + i) % workerCount];
+    std::lock_guard lock{victim.Mutex};
+    if (takeItem(victim.Items, /*fromBack:*/ false)) {
+      return true;
+    }
+  }
+
+  // Deferred items run only when there is no other work. Own deferred items go first to keep the cache warm.
+  for (uint32_t i = 0; i < workerCount; ++i) {
+    Worker &worker = *m_workers[(workerIndex + i) % workerCount];
+    std::lock_guard lock{worker.Mutex};
+    if (takeItem(worker.DeferredItems, /*fromBack:*/ false)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//=============================================================================
+// WorkStealingScheduler implementation
+//=============================================================================
+
+WorkStealingScheduler::WorkStealingScheduler(WorkStealingThreadPool &threadPool, uint32_t maxThreads) noexcept
+    : m_threadPool{threadPool},
+      m_maxThreads{maxThreads == 0 ? m_threadPool.ThreadCount() : maxThreads} {}
+
+WorkStealingScheduler::~WorkStealingScheduler() noexcept {
+  AwaitTermination();
+}
+
+void WorkStealingScheduler::RunTasks() noexcept {
+  bool isTimeSliceExpired{false};
+
+  if (auto queue = m_queue.GetStrongPtr()) {
+    {
+      SchedulerContext context{this};
+      auto endTime = std::chrono::steady_clock::now() + TimeSlice;
+      DispatchTask task;
+      while (queue->TryDequeTask(task)) {
+        queue->InvokeTask(std::move(task), endTime);
+
+        if (std::chrono::steady_clock::now() > endTime) {
+          isTimeSliceExpired = true;
+          break;
+        }
+      }
+    }
+
+    OnWorkCompleted(); // We finished using this thread.
+
+    if (queue->HasTasks()) {
+      Submit(/*isDeferred:*/ isTimeSliceExpired);
+    }
+  } else {
+    OnWorkCompleted();
+  }
+}
+
+void WorkStealingScheduler::IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept {
+  m_queue = std::move(queue);
+}
+
+bool WorkStealingScheduler::HasThreadAccess() noexcept {
+  return SchedulerContext::CurrentScheduler() == this;
+}
+
+bool WorkStealingScheduler::IsSerial() noexcept {
+  return m_maxThreads == 1;
+}
+
+void WorkStealingScheduler::Post() noexcept {
+  Submit(/*isDeferred:*/ false);
+}
+
+void WorkStealingScheduler::Submit(bool isDeferred) noexcept {
+  //! Submit a work item if number of used threads is below m_maxThreads
+  uint32_t usedThreads = m_usedThreads.load(std::memory_order_relaxed);
+  do {
+    if (usedThreads == m_maxThreads) {
+      return;
+    }
+  } while (!m_usedThreads.compare_exchange_weak(
+      usedThreads, usedThreads + 1, std::memory_order_release, std::memory_order_relaxed));
+
+  m_threadPool.Submit(Mso::CntPtr{this}, isDeferred);
+}
+
+void WorkStealingScheduler::OnWorkCompleted() noexcept {
+  if (--m_usedThreads == 0) {
+    std::lock_guard lock{m_mutex};
+    m_whenIdle.notify_all();
+  }
+}
+
+void WorkStealingScheduler::Shutdown() noexcept {
+  // It is not used by this scheduler
+}
+
+void WorkStealingScheduler::AwaitTermination() noexcept {
+  // Avoid deadlock when the dispatch queue and WorkStealingScheduler are released from inside of a task.
+  if (SchedulerContext::CurrentScheduler() == this) {
+    return;
+  }
+
+  if (m_threadPool.IsWorkerThread()) {
+    // The work we wait for may be in this worker's own deque. Keep running pool work while waiting.
+    while (m_usedThreads.load() != 0) {
+      if (!m_threadPool.TryRunPendingWork()) {
+        std::unique_lock lock{m_mutex};
+        m_whenIdle.wait_for(lock, 1ms, [this]() noexcept { return m_usedThreads.load() == 0; });
+      }
+    }
+  } else {
+    std::unique_lock lock{m_mutex};
+    m_whenIdle.wait(lock, [this]() noexcept { return m_usedThreads.load() == 0; });
+  }
+}
+
+//=============================================================================
+// WorkStealingScheduler::SchedulerContext implementation
+//=============================================================================
+
+thread_local WorkStealingScheduler *WorkStealingScheduler::SchedulerContext::tls_scheduler{nullptr};
+
+WorkStealingScheduler::SchedulerContext::SchedulerContext(WorkStealingScheduler *scheduler) noexcept
+    : m_prevScheduler(std::exchange(tls_scheduler, scheduler)) {}
+
+WorkStealingScheduler::SchedulerContext::~SchedulerContext() noexcept {
+  tls_scheduler = m_prevScheduler;
+}
+
+/*static*/ WorkStealingScheduler *WorkStealingScheduler::SchedulerContext::CurrentScheduler() noexcept {
+  return tls_scheduler;
+}
+
+//=============================================================================
+// DispatchQueueStatic::MakeWorkStealingScheduler implementation
+//=============================================================================
+
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeWorkStealingScheduler(
+    uint32_t maxThreads) noexcept {
+  return Mso::Make<WorkStealingScheduler, IDispatchQueueScheduler>(WorkStealingThreadPool::Instance(), maxThreads);
+}
+
+#if defined(MS_TARGET_POSIX)
+// The Win32 thread pool scheduler is not available. Concurrent and serial queues use the portable scheduler.
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeThreadPoolScheduler(
+    uint32_t maxThreads) noexcept {
+  return MakeWorkStealingScheduler(maxThreads);
+}
+#endif
+
+} // namespace Mso
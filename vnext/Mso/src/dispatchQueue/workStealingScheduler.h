@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "queueService.h"
+
+namespace Mso {
+
+struct WorkStealingScheduler;
+
+//! Pool of std::thread workers shared by WorkStealingScheduler instances.
+//!
+//! Each worker owns a deque of work items. Work submitted from a worker thread goes to the back of its own deque
+//! and the worker takes its next item from the back, so a short continuation runs on the core that posted it
+//! while the data it touches is still in the cache. Idle workers steal from the front of other workers' deques.
+//! Work submitted from other threads goes to a shared injection queue.
+//!
+//! Like the system thread pool behind ThreadPoolSchedulerWin, the pool is never destroyed and its workers are
+//! detached. Joining them from a destructor would block under the loader lock when the DLL is unloaded, and would
+//! hang while any work is pending.
+struct WorkStealingThreadPool {
+  using WorkItem = Mso::CntPtr<WorkStealingScheduler>;
+
+  //! The process-wide pool with a worker per hardware thread.
+  static WorkStealingThreadPool &Instance() noexcept;
+
+  WorkStealingThreadPool(uint32_t threadCount) noexcept;
+  ~WorkStealingThreadPool() = delete;
+
+  WorkStealingThreadPool(WorkStealingThreadPool const &other) = delete;
+  WorkStealingThreadPool &operator=(WorkStealingThreadPool const &other) = delete;
+
+  uint32_t ThreadCount() const noexcept;
+  bool IsWorkerThread() const noexcept;
+
+  //! Adds a work item. Deferred items submitted from a worker run only when there is no other work in the pool.
+  void Submit(WorkItem &&item, bool isDeferred) noexcept;
+
+  //! Runs one pending work item if the current thread is a worker.
+  bool TryRunPendingWork() noexcept;
+
+  //! Lets the workers exit once there is no pending work. It does not wait for them.
+  void Shutdown() noexcept;
+
+ private:
+  struct Worker {
+    std::mutex Mutex;
+    std::deque<WorkItem> Items; // The owner uses the back. Other workers steal from the front.
+    std::deque<WorkItem> DeferredItems; // Taken from the front after all other work in the pool.
+  };
+
+  void RunWorker(uint32_t workerIndex) noexcept;
+  bool TryTakeWork(uint32_t workerIndex, /*out*/ WorkItem &item) noexcept;
+
+ private:
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::mutex m_mutex; // Protects m_injectedItems and m_isShutdown.
+  std::condition_variable m_wakeUp;
+  std::deque<WorkItem> m_injectedItems;
+  bool m_isShutdown{false};
+  std::atomic<size_t> m_pendingCount{0}; // Incremented before an item is added, and decremented after it is taken.
+  std::atomic<uint32_t> m_sleepingCount{0};
+
+  constexpr static uint32_t NotAWorker{std::numeric_limits<uint32_t>::max()};
+  static thread_local uint32_t tls_workerIndex;
+};
+
+//! Portable IDispatchQueueScheduler that runs dispatch queue tasks on a WorkStealingThreadPool.
+//! Similar to ThreadPoolSchedulerWin, it submits up to maxThreads work items for its queue at a time.
+struct WorkStealingScheduler : Mso::UnknownObject<IDispatchQueueScheduler> {
+  WorkStealingScheduler(WorkStealingThreadPool &threadPool, uint32_t maxThreads) noexcept;
+  ~WorkStealingScheduler() noexcept override;
+
+  //! Invokes queue tasks until the queue is empty or the time slice expires.
+  void RunTasks() noexcept;
+
+ public: // IDispatchQueueScheduler
+  void IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept override;
+  bool HasThreadAccess() noexcept override;
+  bool IsSerial() noexcept override;
+  void Post() noexcept override;
+  void Shutdown() noexcept override;
+  void AwaitTermination() noexcept override;
+
+ private:
+  void Submit(bool isDeferred) noexcept;
+  void OnWorkCompleted() noexcept;
+
+  // Track the WorkStealingScheduler instance used by current thread.
+  // We use it for HasThreadAccess and to avoid a deadlock on queue shutdown.
+  struct SchedulerContext {
+    SchedulerContext(WorkStealingScheduler *scheduler) noexcept;
+    ~SchedulerContext() noexcept;
+    static WorkStealingScheduler *CurrentScheduler() noexcept;
+
+   private:
+    static thread_local WorkStealingScheduler *tls_scheduler;
+    WorkStealingScheduler *m_prevScheduler{nullptr};
+  };
+
+ private:
+  WorkStealingThreadPool &m_threadPool;
+  Mso::WeakPtr<IDispatchQueueService> m_queue;
+  const uint32_t m_maxThreads{1};
+  std::atomic<uint32_t> m_usedThreads{0};
+  std::mutex m_mutex;
+  std::condition_variable m_whenIdle;
+
+  // When a queue uses up its time slice, its next work item is deferred, so it gives way to the other work in the
+  // pool. The owning worker still runs it once that work is done, without losing its warm cache.
+  constexpr static std::chrono::milliseconds TimeSlice{10};
+};
+
+} // namespace Mso
@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <Microsoft.ReactNative/Fabric/Composition/ComponentViewRecyclePool.h>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+struct FakeView {
+  int id{0};
+  facebook::react::Tag currentTag{0};
+  int recycleCount{0};
+
+  void tag(facebook::react::Tag tag) noexcept {
+    currentTag = tag;
+  }
+
+  void prepareForRecycle() noexcept {
+    ++recycleCount;
+  }
+};
+
+struct FakeViewDescriptor {
+  std::shared_ptr<FakeView> view;
+};
+
+using FakeViewRecyclePool = ComponentViewRecyclePool<FakeView>;
+using FakeViewRegistry = std::unordered_map<facebook::react::Tag, FakeViewDescriptor>;
+
+constexpr facebook::react::ComponentHandle ViewHandle = 1;
+constexpr facebook::react::ComponentHandle ImageHandle = 2;
+
+} // namespace
+
+TEST(ComponentViewRecyclePoolTest, DequeueReturnsViewOfSameType) {
+  FakeViewRecyclePool pool;
+  auto view = std::make_shared<FakeView>();
+  pool.enqueue(ViewHandle, view);
+
+  EXPECT_EQ(nullptr, pool.dequeue(ImageHandle));
+  EXPECT_EQ(view, pool.dequeue(ViewHandle));
+  EXPECT_EQ(nullptr, pool.dequeue(ViewHandle));
+}
+
+TEST(ComponentViewRecyclePoolTest, EnqueueStopsAtMaxSize) {
+  FakeViewRecyclePool pool;
+  pool.setMaxSize(ViewHandle, 2);
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(i >= 2, pool.isFull(ViewHandle));
+    pool.enqueue(ViewHandle, std::make_shared<FakeView>(FakeView{i}));
+  }
+
+  EXPECT_EQ(2u, pool.size(ViewHandle));
+  EXPECT_EQ(1, pool.dequeue(ViewHandle)->id);
+  EXPECT_EQ(0, pool.dequeue(ViewHandle)->id);
+  EXPECT_EQ(nullptr, pool.dequeue(ViewHandle));
+}
+
+TEST(ComponentViewRecyclePoolTest, DefaultMaxSizeAppliesToAllTypes) {
+  FakeViewRecyclePool pool;
+  EXPECT_EQ(FakeViewRecyclePool::DefaultMaxSize, pool.maxSize(ViewHandle));
+
+  pool.setDefaultMaxSize(1);
+  pool.enqueue(ViewHandle, std::make_shared<FakeView>());
+  pool.enqueue(ViewHandle, std::make_shared<FakeView>());
+  pool.enqueue(ImageHandle, std::make_shared<FakeView>());
+
+  EXPECT_EQ(1u, pool.size(ViewHandle));
+  EXPECT_EQ(1u, pool.size(ImageHandle));
+}
+
+TEST(ComponentViewRecyclePoolTest, MaxSizeOverridesDefault) {
+  FakeViewRecyclePool pool;
+  pool.setMaxSize(ImageHandle, 0);
+  pool.setDefaultMaxSize(5);
+
+  EXPECT_EQ(5u, pool.maxSize(ViewHandle));
+  EXPECT_EQ(0u, pool.maxSize(ImageHandle));
+  EXPECT_TRUE(pool.isFull(ImageHandle));
+
+  pool.enqueue(ImageHandle, std::make_shared<FakeView>());
+  EXPECT_EQ(0u, pool.size(ImageHandle));
+}
+
+TEST(ComponentViewRecyclePoolTest, SetMaxSizeTrimsPool) {
+  FakeViewRecyclePool pool;
+  for (int i = 0; i < 4; ++i) {
+    pool.enqueue(ViewHandle, std::make_shared<FakeView>(FakeView{i}));
+  }
+
+  pool.setMaxSize(ViewHandle, 2);
+  EXPECT_EQ(2u, pool.size(ViewHandle));
+  EXPECT_EQ(1, pool.dequeue(ViewHandle)->id);
+
+  pool.setDefaultMaxSize(0);
+  EXPECT_EQ(1u, pool.size(ViewHandle));
+}
+
+TEST(ComponentViewRecyclePoolTest, SetDefaultMaxSizeTrimsPools) {
+  FakeViewRecyclePool pool;
+  for (int i = 0; i < 3; ++i) {
+    pool.enqueue(ViewHandle, std::make_shared<FakeView>());
+    pool.enqueue(ImageHandle, std::make_shared<FakeView>());
+  }
+
+  pool.setDefaultMaxSize(1);
+  EXPECT_EQ(1u, pool.size(ViewHandle));
+  EXPECT_EQ(1u, pool.size(ImageHandle));
+}
+
+TEST(ComponentViewRecyclePoolTest, DequeueExistingTagReturnsRegisteredView) {
+  FakeViewRecyclePool pool;
+  FakeViewRegistry registry;
+  int createCount = 0;
+  auto createView = [&createCount]() {
+    ++createCount;
+    return std::make_shared<FakeView>();
+  };
+
+  auto view = pool.dequeue(registry, ViewHandle, 1, createView).view;
+  pool.enqueue(ViewHandle, std::make_shared<FakeView>());
+
+  // Asking again for the same tag neither creates a view nor takes one from the pool.
+  EXPECT_EQ(view, pool.dequeue(registry, ViewHandle, 1, createView).view);
+  EXPECT_EQ(1, createCount);
+  EXPECT_EQ(1u, pool.size(ViewHandle));
+  EXPECT_EQ(1u, registry.size());
+}
+
+TEST(ComponentViewRecyclePoolTest, EnqueuedViewIsReusedForNewTag) {
+  FakeViewRecyclePool pool;
+  FakeViewRegistry registry;
+  int createCount = 0;
+  auto createView = [&createCount]() {
+    ++createCount;
+    return std::make_shared<FakeView>();
+  };
+
+  auto view = pool.dequeue(registry, ViewHandle, 1, createView).view;
+  pool.enqueue(registry, ViewHandle, 1);
+  EXPECT_TRUE(registry.empty());
+  EXPECT_EQ(1, view->recycleCount);
+
+  EXPECT_EQ(view, pool.dequeue(registry, ViewHandle, 2, createView).view);
+  EXPECT_EQ(2, view->currentTag);
+  EXPECT_EQ(1, createCount);
+
+  // Views are only reused for the same component type.
+  EXPECT_NE(view, pool.dequeue(registry, ImageHandle, 3, createView).view);
+  EXPECT_EQ(2, createCount);
+}
+
+TEST(ComponentViewRecyclePoolTest, EnqueueToFullPoolDropsView) {
+  FakeViewRecyclePool pool;
+  FakeViewRegistry registry;
+  pool.setMaxSize(ViewHandle, 0);
+
+  auto view = pool.dequeue(registry, ViewHandle, 1, []() { return std::make_shared<FakeView>(); }).view;
+  pool.enqueue(registry, ViewHandle, 1);
+
+  EXPECT_TRUE(registry.empty());
+  EXPECT_EQ(0u, pool.size(ViewHandle));
+  EXPECT_EQ(0, view->recycleCount);
+}
+
+TEST(ComponentViewRecyclePoolTest, DefaultMaxSizeFromProperty) {
+  EXPECT_EQ(FakeViewRecyclePool::DefaultMaxSize, FakeViewRecyclePool::DefaultMaxSizeFromProperty(std::nullopt));
+  EXPECT_EQ(16u, FakeViewRecyclePool::DefaultMaxSizeFromProperty(16));
+  EXPECT_EQ(0u, FakeViewRecyclePool::DefaultMaxSizeFromProperty(0));
+  EXPECT_EQ(0u, FakeViewRecyclePool::DefaultMaxSizeFromProperty(-1));
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <Microsoft.ReactNative/Fabric/platform/react/renderer/textlayoutmanager/TextLayoutCache.h>
+#include <react/renderer/graphics/Color.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+#include <functional>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+// Stands in for the platform text layout: counts the measurements that are made.
+struct FakeMeasurer {
+  int callCount{0};
+
+  TextMeasurement operator()(const TextMeasureCacheKey &key) {
+    ++callCount;
+    TextMeasurement measurement{};
+    measurement.size = {
+        key.layoutConstraints.maximumSize.width, static_cast<Float>(key.attributedString.getString().size())};
+    return measurement;
+  }
+};
+
+// Stands in for the creation of a text format: counts the formats that are created.
+struct FakeTextFormatFactory {
+  int callCount{0};
+
+  Float operator()(const TextFormatCacheKey &key) {
+    ++callCount;
+    return key.fontSize;
+  }
+};
+
+AttributedString MakeAttributedString(
+    const std::string &text,
+    SharedColor color = {},
+    FontWeight fontWeight = FontWeight::Regular) {
+  AttributedString::Fragment fragment;
+  fragment.string = text;
+  fragment.textAttributes.fontSize = 14;
+  fragment.textAttributes.fontWeight = fontWeight;
+  fragment.textAttributes.foregroundColor = color;
+
+  AttributedString attributedString;
+  attributedString.appendFragment(fragment);
+  return attributedString;
+}
+
+TextMeasureCacheKey MakeKey(const AttributedString &attributedString, Float maximumWidth = 100) {
+  LayoutConstraints layoutConstraints{};
+  layoutConstraints.maximumSize = {maximumWidth, 50};
+  return {attributedString, {}, layoutConstraints};
+}
+
+TextFormatCacheKey MakeFormatKey(Float fontSize) {
+  return {"Segoe UI", FontWeight::Regular, FontStyle::Normal, fontSize};
+}
+
+} // namespace
+
+TEST(TextLayoutCacheTest, CreatesIdenticalTextFormatOnce) {
+  LruCache<TextFormatCacheKey, Float> cache{4};
+  FakeTextFormatFactory factory;
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(14, cache.get(MakeFormatKey(14), std::ref(factory)));
+  }
+
+  EXPECT_EQ(1, factory.callCount);
+}
+
+TEST(TextLayoutCacheTest, EvictsLeastRecentlyUsed) {
+  LruCache<TextFormatCacheKey, Float> cache{2};
+  FakeTextFormatFactory factory;
+
+  cache.get(MakeFormatKey(10), std::ref(factory));
+  cache.get(MakeFormatKey(11), std::ref(factory));
+  cache.get(MakeFormatKey(10), std::ref(factory));
+  cache.get(MakeFormatKey(12), std::ref(factory)); // Evicts 11.
+  EXPECT_EQ(3, factory.callCount);
+  EXPECT_EQ(2u, cache.size());
+
+  cache.get(MakeFormatKey(10), std::ref(factory));
+  EXPECT_EQ(3, factory.callCount);
+
+  cache.get(MakeFormatKey(11), std::ref(factory));
+  EXPECT_EQ(4, factory.callCount);
+}
+
+TEST(TextLayoutCacheTest, MeasurementKeyIncludesWidthAndParagraphAttributes) {
+  TextMeasureCache cache{};
+  FakeMeasurer measurer;
+
+  cache.get(MakeKey(MakeAttributedString("text"), 100), std::ref(measurer));
+  cache.get(MakeKey(MakeAttributedString("text"), 200), std::ref(measurer));
+  EXPECT_EQ(2, measurer.callCount);
+
+  auto key = MakeKey(MakeAttributedString("text"), 100);
+  key.paragraphAttributes.maximumNumberOfLines = 1;
+  cache.get(key, std::ref(measurer));
+  EXPECT_EQ(3, measurer.callCount);
+}
+
+TEST(TextLayoutCacheTest, DrawingAttributesShareMeasurement) {
+  TextMeasureCache cache{};
+  FakeMeasurer measurer;
+
+  cache.get(MakeKey(MakeAttributedString("text", blackColor())), std::ref(measurer));
+  cache.get(MakeKey(MakeAttributedString("text", whiteColor())), std::ref(measurer));
+  EXPECT_EQ(1, measurer.callCount);
+
+  cache.get(MakeKey(MakeAttributedString("text", blackColor(), FontWeight::Bold)), std::ref(measurer));
+  EXPECT_EQ(2, measurer.callCount);
+}
+
+TEST(TextLayoutCacheTest, TextFormatKeyIdentifiesFont) {
+  TextFormatCacheKey key{"Segoe UI", FontWeight::Regular, FontStyle::Normal, 14};
+  EXPECT_EQ(key, (TextFormatCacheKey{"Segoe UI", FontWeight::Regular, FontStyle::Normal, 14}));
+  EXPECT_NE(key, (TextFormatCacheKey{"Segoe UI", FontWeight::Bold, FontStyle::Normal, 14}));
+  EXPECT_NE(key, (TextFormatCacheKey{"Segoe UI", FontWeight::Regular, FontStyle::Italic, 14}));
+  EXPECT_NE(key, (TextFormatCacheKey{"Segoe UI", FontWeight::Regular, FontStyle::Normal, 16}));
+  EXPECT_NE(key, (TextFormatCacheKey{"Consolas", FontWeight::Regular, FontStyle::Normal, 14}));
+}
+
+} // namespace facebook::react
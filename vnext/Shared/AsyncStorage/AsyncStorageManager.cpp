@@ -113,10 +113,11 @@ void AsyncStorageManager::executeAsyncKVOperation(
 }
 
 void AsyncStorageManager::multiGetInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
-  std::vector<std::tuple<std::string, std::string>> retVals =
-      m_aofKVStorage->multiGet(FollyDynamicConverter::jsArgAsStringVector(args));
-  folly::dynamic jsRetVal = FollyDynamicConverter::tupleStringVectorAsRetVal(retVals);
-  jsCallback({noError, jsRetVal});
+  // Look keys up straight from the JS arguments and copy each found value only
+  // once, into the returned dynamic.
+  auto retVals = m_aofKVStorage->multiGetValues(FollyDynamicConverter::jsArgAsStringViewVector(args));
+  folly::dynamic jsRetVal = FollyDynamicConverter::tupleStringValueVectorAsRetVal(retVals);
+  jsCallback({noError, std::move(jsRetVal)});
 }
 
 void AsyncStorageManager::multiSetInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
@@ -20,6 +20,16 @@ std::vector<string> FollyDynamicConverter::jsArgAsStringVector(const dynamic &ar
   return keys;
 }
 
+std::vector<string_view> FollyDynamicConverter::jsArgAsStringViewVector(const dynamic &args) noexcept {
+  // args is array[array[]], the views point into args
+  std::vector<string_view> keys;
+  keys.reserve(args[0].size());
+  for (const auto &jsKey : args[0]) {
+    keys.emplace_back(jsKey.getString());
+  }
+  return keys;
+}
+
 std::vector<tuple<string, string>> FollyDynamicConverter::jsArgAsTupleStringVector(const dynamic &args) noexcept {
   // args is array[array[array[]]]
   std::vector<tuple<string, string>> kVVector;
@@ -47,5 +57,14 @@ folly::dynamic FollyDynamicConverter::tupleStringVectorAsRetVal(
   }
   return jsRetVals;
 }
+
+folly::dynamic FollyDynamicConverter::tupleStringValueVectorAsRetVal(
+    const std::vector<tuple<string_view, KeyValueTable::Value>> &vec) noexcept {
+  folly::dynamic jsRetVals = folly::dynamic::array;
+  for (const auto &retVal : vec) {
+    jsRetVals.push_back(dynamic::array(string{std::get<0>(retVal)}, *std::get<1>(retVal)));
+  }
+  return jsRetVals;
+}
 } // namespace react
 } // namespace facebook
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <AsyncStorage/KeyValueTable.h>
 #include <cxxreact/CxxModule.h>
 #include <cxxreact/JsArgumentHelpers.h>
 #include <folly/dynamic.h>
@@ -16,9 +17,12 @@ namespace react {
 class FollyDynamicConverter {
  public:
   static std::vector<string> jsArgAsStringVector(const dynamic &args) noexcept;
+  static std::vector<string_view> jsArgAsStringViewVector(const dynamic &args) noexcept;
   static std::vector<tuple<string, string>> jsArgAsTupleStringVector(const dynamic &args) noexcept;
   static folly::dynamic stringVectorAsRetVal(const std::vector<string> &vec) noexcept;
   static folly::dynamic tupleStringVectorAsRetVal(const std::vector<tuple<string, string>> &vec) noexcept;
+  static folly::dynamic tupleStringValueVectorAsRetVal(
+      const std::vector<tuple<string_view, KeyValueTable::Value>> &vec) noexcept;
 };
 } // namespace react
 } // namespace facebook
\ No newline at end of file
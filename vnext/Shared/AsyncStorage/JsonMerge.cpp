@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <AsyncStorage/JsonMerge.h>
+
+#include <folly/json.h>
+
+using namespace std;
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+folly::dynamic parseObject(string_view json) {
+  auto value = folly::parseJson(folly::StringPiece{json.data(), json.size()});
+  if (!value.isObject())
+    throw std::exception("Error: merged values must be JSON objects.");
+  return value;
+}
+
+} // namespace
+
+void JsonMerge::deepMerge(folly::dynamic &target, folly::dynamic &&patch) {
+  for (auto &member : patch.items()) {
+    auto *existing = target.get_ptr(member.first);
+    if (existing && existing->isObject() && member.second.isObject()) {
+      deepMerge(*existing, std::move(member.second));
+    } else {
+      target.insert(member.first, std::move(member.second));
+    }
+  }
+}
+
+string JsonMerge::mergeJson(string_view storedValue, string_view patch) {
+  auto target = parseObject(storedValue);
+  deepMerge(target, parseObject(patch));
+  return folly::toJson(target);
+}
+
+void JsonMerge::validateObject(string_view value) {
+  parseObject(value);
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <string>
+#include <string_view>
+
+namespace facebook {
+namespace react {
+
+// Deep merge used by AsyncStorage's multiMerge.
+//
+// Members of the patch replace members of the target with the same name,
+// except when both are objects, in which case they are merged recursively.
+// Arrays and other values are never merged, only replaced. This matches the
+// merge semantics of the Android and iOS AsyncStorage modules.
+class JsonMerge {
+ public:
+  // Merges patch into target in place. Both must be objects.
+  static void deepMerge(folly::dynamic &target, folly::dynamic &&patch);
+
+  // Parses both values once, merges patch into storedValue and returns the
+  // serialized result. Throws if either value is not a JSON object.
+  static std::string mergeJson(std::string_view storedValue, std::string_view patch);
+
+  // Throws if value is not a JSON object, as mergeJson does.
+  static void validateObject(std::string_view value);
+};
+
+} // namespace react
+} // namespace facebook
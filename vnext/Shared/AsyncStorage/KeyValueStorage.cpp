@@ -3,15 +3,21 @@
 
 #include "pch.h"
 
+#include <AsyncStorage/JsonMerge.h>
 #include <AsyncStorage/KeyValueStorage.h>
 
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
 using namespace std;
 
 namespace facebook {
 namespace react {
 
-KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName)
-    : m_fileIOHelper{make_unique<StorageFileIO>(storageFileName)}, m_kvMap{map<string, string>()} {
+KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName, KeyValueStorageCompactionOptions compactionOptions)
+    : m_fileIOHelper{make_unique<StorageFileIO>(storageFileName)},
+      m_compactionOptions{compactionOptions} {
   // start the load procedure
   m_storageFileLoaded = CreateEventEx(nullptr, nullptr, CREATE_EVENT_MANUAL_RESET, SYNCHRONIZE | EVENT_MODIFY_STATE);
   if (m_storageFileLoaded == NULL)
@@ -20,99 +26,241 @@ KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName)
   m_storageFileLoader = async(launch::async, &KeyValueStorage::load, this);
 }
 
+KeyValueStorage::~KeyValueStorage() {
+  try {
+    waitForCompactionComplete();
+  } catch (const std::exception &) {
+    // Nobody is left to report a failed background compaction to. The file
+    // still holds a consistent prefix and is rewritten on the next load.
+  }
+}
+
 void KeyValueStorage::setStorageLoadedEvent() {
   if (!SetEvent(m_storageFileLoaded))
     StorageFileIO::throwLastErrorMessage();
 }
 
 void KeyValueStorage::load() {
-  bool saveRequired = false; // this flag is used to indicate whether the file
-                             // needs to be cleaned up.
+  // Values stay escaped in the mapped file until they are first read, see
+  // KeyValueTable::assignEncoded. Keys are small and needed for lookups, so
+  // they are unescaped right away.
+  const string_view file = m_fileIOHelper->mapView();
 
   string currentKey;
-  string unescapedLine;
-
-  std::string line;
-  line.reserve(EstimatedValueSize);
-
-  m_fileIOHelper->resetLine();
-
-  while (m_fileIOHelper->getLine(line)) {
-    if (line.size() > 0) {
-      char prefix = line.at(0);
-      line.erase(0, 1);
-      unescapeString(line); // get the line without the prefix ($, %, R) and
-                            // unescapes the \n and \ chars
-      switch (prefix) { // switch on first char in line
-        case KeyPrefix:
-          currentKey = line;
-          break;
-
-        case ValuePrefix:
-          if (m_kvMap.count(currentKey))
-            saveRequired = true;
-          m_kvMap[currentKey] = line;
-          break;
-
-        case RemovePrefix:
-          saveRequired = true;
-          m_kvMap.erase(currentKey);
-          break;
-
-        default:
-          m_fileIOHelper->clear();
-          setStorageLoadedEvent();
-          throw std::exception("Corrupt storage file. Unexpected prefix on line. Storage file cleared.");
-          break;
-      }
+  size_t currentKeyEscapedSize = 0;
+
+  const char *cursor = file.data();
+  const char *const end = file.data() + file.size();
+  while (cursor < end) {
+    auto lineEnd = static_cast<const char *>(memchr(cursor, '\n', end - cursor));
+    if (!lineEnd)
+      break; // torn last line, see below
+
+    string_view line{cursor, static_cast<size_t>(lineEnd - cursor)};
+    cursor = lineEnd + 1;
+    m_fileSize += line.size() + 1;
+
+    if (line.empty())
+      continue;
+
+    // get the line without the prefix ($, %, R)
+    const char prefix = line.front();
+    line.remove_prefix(1);
+
+    if (!hasValidEscapes(line)) {
+      clearCorruptFile();
+      throw std::exception("Corrupt storage file. Found unexpected backslash. Storage file cleared.");
+    }
+
+    switch (prefix) { // switch on first char in line
+      case KeyPrefix:
+        currentKey = unescapeString(line);
+        currentKeyEscapedSize = line.size();
+        break;
+
+      case ValuePrefix:
+        m_liveSize += escapedRecordSize(currentKeyEscapedSize, line.size());
+        if (auto previous = m_table.assignEncoded(currentKey, line))
+          m_liveSize -= escapedRecordSize(currentKeyEscapedSize, previous->size());
+        break;
+
+      case RemovePrefix:
+        if (auto previous = m_table.eraseEncoded(currentKey))
+          m_liveSize -= escapedRecordSize(currentKeyEscapedSize, previous->size());
+        break;
+
+      default:
+        clearCorruptFile();
+        throw std::exception("Corrupt storage file. Unexpected prefix on line. Storage file cleared.");
+        break;
     }
   }
 
-  if (saveRequired) // cleanup the AOF by dumping the in memory map
+  // A size mismatch means the last write was torn and left a partial line
+  // behind. Appending after it would corrupt the next record, so rewrite.
+  const auto fileSize = m_fileIOHelper->seekToEnd();
+  if (fileSize != m_fileSize || isCompactionRequired()) // cleanup the AOF by dumping the in memory map
   {
     saveTable();
   }
   setStorageLoadedEvent();
 }
 
-void KeyValueStorage::saveTable() {
+void KeyValueStorage::clearCorruptFile() {
+  m_table.clear();
+  m_liveSize = 0;
+  m_fileSize = 0;
+
+  m_fileIOHelper->unmapView();
   m_fileIOHelper->clear();
+  setStorageLoadedEvent();
+}
+
+// Values loaded from the file may still point into its mapping. Decode them
+// all before the file gets rewritten, which also requires the view to be gone.
+void KeyValueStorage::releaseFileView() {
+  m_table.decodeAll();
+  m_fileIOHelper->unmapView();
+}
+
+string KeyValueStorage::serializeTable() const {
   stringstream cleanedUpFile;
 
-  for (auto const &entry : m_kvMap) // convert in memory map to a string
-  {
-    string key = entry.first;
-    string value = entry.second;
+  m_table.forEach([&cleanedUpFile](string_view entryKey, const string &entryValue) {
+    // convert in memory table to a string
+    string key{entryKey};
+    string value = entryValue;
 
     escapeString(key);
     escapeString(value);
 
     cleanedUpFile << KeyPrefix << key << '\n' << ValuePrefix << value << '\n';
+  });
+
+  return cleanedUpFile.str();
+}
+
+void KeyValueStorage::saveTable() {
+  releaseFileView();
+  string cleanedUpFile = serializeTable();
+
+  lock_guard<mutex> lock(m_fileMutex);
+  m_fileIOHelper->clear();
+  m_fileIOHelper->append(cleanedUpFile);
+  m_fileIOHelper->flush();
+  m_fileSize = cleanedUpFile.size();
+}
+
+void KeyValueStorage::appendToFile(string &&entry) {
+  lock_guard<mutex> lock(m_fileMutex);
+  m_fileSize += entry.size();
+
+  // The pending compaction rewrites the file from an older snapshot of the
+  // table, so anything written now has to go after it.
+  if (m_compactionPending) {
+    m_deferredAppends.append(entry);
+    return;
   }
 
-  m_fileIOHelper->append(cleanedUpFile.str());
+  m_fileIOHelper->append(entry);
   m_fileIOHelper->flush();
 }
 
+// Callers must either hold m_fileMutex or have exclusive access to the file.
+bool KeyValueStorage::isCompactionRequired() const noexcept {
+  const size_t deadSize = m_fileSize - m_liveSize;
+  if (deadSize == 0)
+    return false;
+
+  if (deadSize >= m_compactionOptions.DeadRecordBytes)
+    return true;
+
+  return m_fileSize >= m_compactionOptions.MinimumFileSize &&
+      deadSize >= m_compactionOptions.DeadRecordRatio * m_fileSize;
+}
+
+void KeyValueStorage::scheduleCompaction() {
+  {
+    lock_guard<mutex> lock(m_fileMutex);
+    if (m_compactionPending || !isCompactionRequired())
+      return;
+  }
+
+  // Surface the failure of a previous compaction before starting a new one.
+  waitForCompactionComplete();
+
+  // Writers are serialized, so the table cannot change between taking the
+  // snapshot and raising m_compactionPending.
+  releaseFileView();
+  string snapshot = serializeTable();
+  {
+    lock_guard<mutex> lock(m_fileMutex);
+    m_compactionPending = true;
+  }
+
+  m_compactionTask = async(launch::async, [this, snapshot = std::move(snapshot)]() {
+    lock_guard<mutex> lock(m_fileMutex);
+    try {
+      m_fileIOHelper->clear();
+      m_fileIOHelper->append(snapshot);
+      m_fileIOHelper->append(m_deferredAppends);
+      m_fileIOHelper->flush();
+    } catch (const std::exception &) {
+      m_deferredAppends.clear();
+      m_compactionPending = false;
+      throw;
+    }
+
+    m_fileSize = snapshot.size() + m_deferredAppends.size();
+    m_deferredAppends.clear();
+    m_compactionPending = false;
+  });
+}
+
+void KeyValueStorage::waitForCompactionComplete() {
+  if (m_compactionTask.valid())
+    m_compactionTask.get();
+}
+
 void KeyValueStorage::waitForStorageLoadComplete() {
   using namespace std::chrono;
   using namespace std::chrono_literals;
 
+  if (m_storageFileLoadComplete)
+    return;
+
   const auto dwMilliseconds = static_cast<DWORD>(duration_cast<milliseconds>(30s).count());
   if (WaitForSingleObject(m_storageFileLoaded, dwMilliseconds) != WAIT_OBJECT_0)
     StorageFileIO::throwLastErrorMessage();
 
-  if (m_storageFileLoader.valid())
+  // Readers and the writer may get here concurrently. Only the first one
+  // reports a load failure, the others see whatever the loader left behind.
+  lock_guard<mutex> lock(m_storageFileLoaderMutex);
+  if (m_storageFileLoader.valid()) {
+    m_storageFileLoadComplete = true;
     m_storageFileLoader.get();
+  }
 }
 
 vector<tuple<string, string>> KeyValueStorage::multiGet(const vector<string> &keys) {
-  waitForStorageLoadComplete();
+  vector<string_view> keyViews{keys.begin(), keys.end()};
 
   vector<tuple<string, string>> result;
+  for (auto const &kv : multiGetValues(keyViews)) {
+    result.emplace_back(get<0>(kv), *get<1>(kv));
+  }
+
+  return result;
+}
+
+vector<tuple<string_view, KeyValueTable::Value>> KeyValueStorage::multiGetValues(const vector<string_view> &keys) {
+  waitForStorageLoadComplete();
+
+  vector<tuple<string_view, KeyValueTable::Value>> result;
+  result.reserve(keys.size());
   for (auto const &k : keys) {
-    if (m_kvMap.find(k) != m_kvMap.end()) {
-      result.emplace_back(k, m_kvMap[k]);
+    if (auto value = m_table.find(k)) {
+      result.emplace_back(k, std::move(value));
     }
   }
 
@@ -121,7 +269,12 @@ vector<tuple<string, string>> KeyValueStorage::multiGet(const vector<string> &ke
 
 void KeyValueStorage::multiSet(const vector<tuple<string, string>> &keyValuePairs) {
   waitForStorageLoadComplete();
+  lock_guard<mutex> writeLock(m_writeMutex);
+  setValues(keyValuePairs);
+}
 
+// Callers must hold m_writeMutex.
+void KeyValueStorage::setValues(const vector<tuple<string, string>> &keyValuePairs) {
   stringstream appendEntry;
   bool fUpdateStorageFile = false;
 
@@ -132,9 +285,14 @@ void KeyValueStorage::multiSet(const vector<tuple<string, string>> &keyValuePair
     // check if we need to modify the storage file
     // 1. if key does not exist
     // 2. if keys exists and value is different
-    if (m_kvMap.find(key) == m_kvMap.end() || m_kvMap[key] != value) {
-      // update the in-memory map
-      m_kvMap[key] = value;
+    auto existing = m_table.find(key);
+    if (!existing || *existing != value) {
+      // update the in-memory table
+      if (existing)
+        m_liveSize -= recordSize(key, *existing);
+      m_liveSize += recordSize(key, value);
+      m_table.insertOrAssign(key, make_shared<const string>(value));
+
       fUpdateStorageFile = true;
       escapeString(key);
       escapeString(value);
@@ -144,41 +302,119 @@ void KeyValueStorage::multiSet(const vector<tuple<string, string>> &keyValuePair
 
   if (fUpdateStorageFile) {
     // write the new keys to the file
-    saveTable();
+    appendToFile(appendEntry.str());
+    scheduleCompaction();
   }
 }
 
 void KeyValueStorage::multiRemove(const vector<string> &keys) {
   waitForStorageLoadComplete();
+  lock_guard<mutex> writeLock(m_writeMutex);
+
+  stringstream appendEntry;
+  bool fUpdateStorageFile = false;
 
   for (auto const &k : keys) {
-    m_kvMap.erase(k);
+    auto previous = m_table.erase(k);
+    if (!previous)
+      continue;
+
+    m_liveSize -= recordSize(k, *previous);
+
+    fUpdateStorageFile = true;
+    string key = k;
+    escapeString(key);
+    appendEntry << KeyPrefix << key << '\n' << RemovePrefix << '\n';
   }
 
-  saveTable();
+  if (fUpdateStorageFile) {
+    appendToFile(appendEntry.str());
+    scheduleCompaction();
+  }
 }
 
+// The stored value is read and rewritten under the write lock, so concurrent
+// merges of the same key never lose each other's changes. All merged values
+// are computed before anything is written: if one of them is not valid JSON
+// the whole call fails and storage is left untouched.
 void KeyValueStorage::multiMerge(const vector<tuple<string, string>> &keyValuePairs) {
-  throw std::exception("Error: not implemented.");
+  waitForStorageLoadComplete();
+  lock_guard<mutex> writeLock(m_writeMutex);
+
+  vector<tuple<string, string>> mergedPairs;
+  mergedPairs.reserve(keyValuePairs.size());
+
+  // A key may be merged more than once in the same call, in which case later
+  // patches apply on top of the earlier ones.
+  unordered_map<string_view, size_t> mergedIndex;
+  for (auto const &kvTuple : keyValuePairs) {
+    const auto &key = get<0>(kvTuple);
+    const auto &patch = get<1>(kvTuple);
+
+    auto pending = mergedIndex.find(key);
+    if (pending != mergedIndex.end()) {
+      auto &merged = get<1>(mergedPairs[pending->second]);
+      merged = JsonMerge::mergeJson(merged, patch);
+      continue;
+    }
+
+    auto existing = m_table.find(key);
+    if (!existing) {
+      // The patch is stored as is, but must still be an object like any merged value.
+      JsonMerge::validateObject(patch);
+    }
+
+    mergedIndex.emplace(key, mergedPairs.size());
+    mergedPairs.emplace_back(key, existing ? JsonMerge::mergeJson(*existing, patch) : patch);
+  }
+
+  setValues(mergedPairs);
 }
 
 void KeyValueStorage::clear() {
   waitForStorageLoadComplete();
+  lock_guard<mutex> writeLock(m_writeMutex);
+  waitForCompactionComplete();
+
+  m_table.clear();
+  m_liveSize = 0;
 
-  m_kvMap.clear();
+  lock_guard<mutex> lock(m_fileMutex);
+  m_fileIOHelper->unmapView();
   m_fileIOHelper->clear();
+  m_fileSize = 0;
 }
 
 vector<string> KeyValueStorage::getAllKeys() {
   waitForStorageLoadComplete();
 
   vector<string> keys;
-  for (auto const &i : m_kvMap) {
-    keys.push_back(i.first);
-  }
+  keys.reserve(m_table.size());
+  m_table.forEach([&keys](string_view key, const string &) { keys.emplace_back(key); });
+
+  // The table is unordered; keep returning keys in the order callers are used to.
+  sort(keys.begin(), keys.end());
   return keys;
 }
 
+size_t KeyValueStorage::escapedLength(string_view unescapedString) noexcept {
+  size_t length = unescapedString.length();
+  for (auto const &c : unescapedString) {
+    if (c == '\n' || c == '\\')
+      length++;
+  }
+  return length;
+}
+
+// Size of "$<key>\n%<value>\n" once written to the storage file.
+size_t KeyValueStorage::recordSize(string_view key, string_view value) noexcept {
+  return escapedRecordSize(escapedLength(key), escapedLength(value));
+}
+
+size_t KeyValueStorage::escapedRecordSize(size_t escapedKeySize, size_t escapedValueSize) noexcept {
+  return escapedKeySize + escapedValueSize + 4;
+}
+
 void KeyValueStorage::escapeString(string &rawString) {
   int cSpecialChars = 0;
   for (auto const &c : rawString) {
@@ -215,34 +451,36 @@ void KeyValueStorage::escapeString(string &rawString) {
   }
 }
 
-void KeyValueStorage::unescapeString(string &escapedString) {
-  char *read = &escapedString[0];
-  char *write = read;
-  int cEscapedChars = 0;
+bool KeyValueStorage::hasValidEscapes(string_view escapedString) noexcept {
+  const char *read = escapedString.data();
+  const char *const end = read + escapedString.size();
 
-  for (; *read; read++, write++) {
-    if (*read != '\\') {
-      *write = *read;
-      continue;
-    }
+  // Escapes are rare, so skip to them with memchr which is vectorized by the CRT.
+  while ((read = static_cast<const char *>(memchr(read, '\\', end - read))) != nullptr) {
+    if (read + 1 == end || (read[1] != '\\' && read[1] != 'n'))
+      return false;
+
+    read += 2;
+  }
 
-    read++;
-    cEscapedChars++;
+  return true;
+}
 
-    switch (*read) {
-      case '\\':
-        *write = '\\';
-        break;
-      case 'n':
-        *write = '\n';
-        break;
-      default:
-        throw std::exception("Corrupt storage file. Found unexpected backslash.");
-    }
+// Assumes hasValidEscapes(escapedString).
+string KeyValueStorage::unescapeString(string_view escapedString) {
+  string result;
+  result.reserve(escapedString.size());
+
+  const char *read = escapedString.data();
+  const char *const end = read + escapedString.size();
+  while (const char *escape = static_cast<const char *>(memchr(read, '\\', end - read))) {
+    result.append(read, escape);
+    result.push_back(escape[1] == 'n' ? '\n' : '\\');
+    read = escape + 2;
   }
-  *write = '\0';
+  result.append(read, end);
 
-  escapedString.resize(escapedString.length() - cEscapedChars);
+  return result;
 }
 } // namespace react
 } // namespace facebook
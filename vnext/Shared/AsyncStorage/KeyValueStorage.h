@@ -3,20 +3,45 @@
 
 #pragma once
 
+#include <atomic>
 #include <future>
-#include <map>
 #include <memory>
+#include <mutex>
+#include <string_view>
 #include <vector>
 
+#include <AsyncStorage/KeyValueTable.h>
 #include <AsyncStorage/StorageFileIO.h>
 
 namespace facebook {
 namespace react {
+
+// Controls when the append-only storage file gets rewritten.
+// Dead records are entries that were overwritten or removed since the last
+// rewrite. Compaction is triggered when either threshold is crossed.
+struct KeyValueStorageCompactionOptions {
+  // Fraction of the file occupied by dead records. Ignored for files smaller
+  // than MinimumFileSize so that small stores are never rewritten eagerly.
+  double DeadRecordRatio{0.5};
+  size_t MinimumFileSize{64 * 1024};
+
+  // Absolute amount of dead records, in bytes.
+  size_t DeadRecordBytes{4 * 1024 * 1024};
+};
+
 class KeyValueStorage {
  public:
-  KeyValueStorage(const WCHAR *storageFileName);
+  KeyValueStorage(
+      const WCHAR *storageFileName,
+      KeyValueStorageCompactionOptions compactionOptions = KeyValueStorageCompactionOptions{});
+  ~KeyValueStorage();
 
   std::vector<std::tuple<std::string, std::string>> multiGet(const std::vector<std::string> &keys);
+
+  // Same as multiGet, but hands out references to the stored values instead of
+  // copying them. Safe to call concurrently with other readers and writers.
+  std::vector<std::tuple<std::string_view, KeyValueTable::Value>> multiGetValues(
+      const std::vector<std::string_view> &keys);
   void multiSet(const std::vector<std::tuple<std::string, std::string>> &keyValuePairs);
   void multiRemove(const std::vector<std::string> &keys);
   void multiMerge(const std::vector<std::tuple<std::string, std::string>> &keyValuePairs);
@@ -31,20 +56,51 @@ class KeyValueStorage {
   static const char RemovePrefix = 'R'; // Keep RemovePrefix to be backward compatible for the storage file format
 
  private:
-  std::map<std::string, std::string> m_kvMap;
+  KeyValueTable m_table{&KeyValueStorage::unescapeString};
   std::unique_ptr<StorageFileIO> m_fileIOHelper;
   HANDLE m_storageFileLoaded;
   std::future<void> m_storageFileLoader;
+  std::mutex m_storageFileLoaderMutex;
+  std::atomic_bool m_storageFileLoadComplete{false};
+
+  // Readers only go through m_table. Writers are serialized so that the file
+  // bookkeeping below and compaction snapshots see a consistent table.
+  std::mutex m_writeMutex;
+
+  // File bookkeeping used to decide when to compact.
+  // m_fileSize counts every byte in the storage file, m_liveSize only the
+  // records that are still reachable through m_table.
+  KeyValueStorageCompactionOptions m_compactionOptions;
+  size_t m_fileSize{0};
+  size_t m_liveSize{0};
+
+  // Guards m_fileIOHelper and the deferred appends while a compaction runs.
+  std::mutex m_fileMutex;
+  bool m_compactionPending{false};
+  std::string m_deferredAppends;
+  std::future<void> m_compactionTask;
 
  private:
   static void escapeString(std::string &unescapedString);
-  static void unescapeString(std::string &escapedString);
+  static std::string unescapeString(std::string_view escapedString);
+  static bool hasValidEscapes(std::string_view escapedString) noexcept;
+  static size_t escapedLength(std::string_view unescapedString) noexcept;
+  static size_t recordSize(std::string_view key, std::string_view value) noexcept;
+  static size_t escapedRecordSize(size_t escapedKeySize, size_t escapedValueSize) noexcept;
 
  private:
   void load();
+  void setValues(const std::vector<std::tuple<std::string, std::string>> &keyValuePairs);
+  void clearCorruptFile();
+  void releaseFileView();
   void waitForStorageLoadComplete();
+  void waitForCompactionComplete();
   void setStorageLoadedEvent();
+  std::string serializeTable() const;
   void saveTable();
+  void appendToFile(std::string &&entry);
+  bool isCompactionRequired() const noexcept;
+  void scheduleCompaction();
 };
 } // namespace react
 } // namespace facebook
@@ -0,0 +1,224 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <AsyncStorage/KeyValueTable.h>
+
+#include <functional>
+#include <mutex>
+#include <utility>
+
+using namespace std;
+
+namespace facebook {
+namespace react {
+
+KeyValueTable::KeyValueTable(Decoder decoder) : m_decoder{decoder} {
+  for (auto &stripe : m_stripes) {
+    stripe.slots.resize(InitialStripeCapacity);
+  }
+}
+
+size_t KeyValueTable::hashKey(string_view key) noexcept {
+  return std::hash<string_view>{}(key);
+}
+
+// The stripe is picked from the high bits of the hash and the slot from the
+// low bits, so that keys sharing a stripe still spread over its slots.
+KeyValueTable::Stripe &KeyValueTable::stripeFor(size_t hash) const noexcept {
+  return m_stripes[hash >> (sizeof(size_t) * 8 - StripeBits)];
+}
+
+size_t KeyValueTable::findSlot(const Stripe &stripe, size_t hash, string_view key) noexcept {
+  const size_t mask = stripe.slots.size() - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    const auto &slot = stripe.slots[i];
+    if (!slot.occupied())
+      return NotFound;
+
+    if (slot.hash == hash && slot.key == key)
+      return i;
+  }
+}
+
+void KeyValueTable::placeSlot(vector<Slot> &slots, Slot &&slot) noexcept {
+  const size_t mask = slots.size() - 1;
+  size_t i = slot.hash & mask;
+  while (slots[i].occupied()) {
+    i = (i + 1) & mask;
+  }
+  slots[i] = std::move(slot);
+}
+
+void KeyValueTable::grow(Stripe &stripe) {
+  vector<Slot> slots(stripe.slots.size() * 2);
+  for (auto &slot : stripe.slots) {
+    if (slot.occupied())
+      placeSlot(slots, std::move(slot));
+  }
+  stripe.slots = std::move(slots);
+}
+
+// Backward-shift deletion: pull later entries of the probe sequence into the
+// hole so lookups never need tombstones.
+void KeyValueTable::removeSlot(Stripe &stripe, size_t i) noexcept {
+  const size_t mask = stripe.slots.size() - 1;
+  for (size_t j = (i + 1) & mask; stripe.slots[j].occupied(); j = (j + 1) & mask) {
+    const size_t ideal = stripe.slots[j].hash & mask;
+    if (((j - ideal) & mask) >= ((j - i) & mask)) {
+      stripe.slots[i] = std::move(stripe.slots[j]);
+      i = j;
+    }
+  }
+  stripe.slots[i] = Slot{};
+  stripe.count--;
+}
+
+void KeyValueTable::decodeSlot(Stripe &stripe, Slot &slot) const {
+  if (!slot.encoded.data())
+    return;
+
+  slot.value = make_shared<const string>(m_decoder ? m_decoder(slot.encoded) : string{slot.encoded});
+  slot.encoded = {};
+  stripe.encodedCount--;
+}
+
+void KeyValueTable::decodeStripe(Stripe &stripe) const {
+  for (auto &slot : stripe.slots) {
+    if (stripe.encodedCount == 0)
+      return;
+
+    decodeSlot(stripe, slot);
+  }
+}
+
+KeyValueTable::Value KeyValueTable::find(string_view key) const {
+  const size_t hash = hashKey(key);
+  auto &stripe = stripeFor(hash);
+
+  {
+    shared_lock<shared_mutex> lock(stripe.mutex);
+    const size_t i = findSlot(stripe, hash, key);
+    if (i == NotFound)
+      return nullptr;
+
+    if (stripe.slots[i].value)
+      return stripe.slots[i].value;
+  }
+
+  // First access to an encoded value. Decode it once under the write lock; the
+  // slot may have moved or gone away in between.
+  unique_lock<shared_mutex> lock(stripe.mutex);
+  const size_t i = findSlot(stripe, hash, key);
+  if (i == NotFound)
+    return nullptr;
+
+  decodeSlot(stripe, stripe.slots[i]);
+  return stripe.slots[i].value;
+}
+
+KeyValueTable::Value KeyValueTable::insertOrAssign(string_view key, Value value) {
+  const size_t hash = hashKey(key);
+  auto &stripe = stripeFor(hash);
+
+  unique_lock<shared_mutex> lock(stripe.mutex);
+  const size_t i = findSlot(stripe, hash, key);
+  if (i != NotFound) {
+    decodeSlot(stripe, stripe.slots[i]);
+    std::swap(stripe.slots[i].value, value);
+    return value;
+  }
+
+  // Keep the load factor under 3/4 so probe sequences stay short.
+  if ((stripe.count + 1) * 4 > stripe.slots.size() * 3)
+    grow(stripe);
+
+  placeSlot(stripe.slots, Slot{hash, string{key}, std::move(value), {}});
+  stripe.count++;
+  m_size++;
+  return nullptr;
+}
+
+KeyValueTable::Value KeyValueTable::erase(string_view key) {
+  const size_t hash = hashKey(key);
+  auto &stripe = stripeFor(hash);
+
+  unique_lock<shared_mutex> lock(stripe.mutex);
+  const size_t i = findSlot(stripe, hash, key);
+  if (i == NotFound)
+    return nullptr;
+
+  decodeSlot(stripe, stripe.slots[i]);
+  Value previous = std::move(stripe.slots[i].value);
+  removeSlot(stripe, i);
+  m_size--;
+  return previous;
+}
+
+optional<string_view> KeyValueTable::assignEncoded(string_view key, string_view encodedValue) {
+  const size_t hash = hashKey(key);
+  auto &stripe = stripeFor(hash);
+
+  unique_lock<shared_mutex> lock(stripe.mutex);
+  const size_t i = findSlot(stripe, hash, key);
+  if (i != NotFound) {
+    auto &slot = stripe.slots[i];
+    if (!slot.encoded.data()) {
+      slot.value = nullptr;
+      stripe.encodedCount++;
+    }
+    return std::exchange(slot.encoded, encodedValue);
+  }
+
+  if ((stripe.count + 1) * 4 > stripe.slots.size() * 3)
+    grow(stripe);
+
+  placeSlot(stripe.slots, Slot{hash, string{key}, nullptr, encodedValue});
+  stripe.count++;
+  stripe.encodedCount++;
+  m_size++;
+  return nullopt;
+}
+
+optional<string_view> KeyValueTable::eraseEncoded(string_view key) {
+  const size_t hash = hashKey(key);
+  auto &stripe = stripeFor(hash);
+
+  unique_lock<shared_mutex> lock(stripe.mutex);
+  const size_t i = findSlot(stripe, hash, key);
+  if (i == NotFound)
+    return nullopt;
+
+  const auto previous = stripe.slots[i].encoded;
+  if (previous.data())
+    stripe.encodedCount--;
+  removeSlot(stripe, i);
+  m_size--;
+  return previous;
+}
+
+void KeyValueTable::decodeAll() const {
+  for (auto &stripe : m_stripes) {
+    unique_lock<shared_mutex> lock(stripe.mutex);
+    decodeStripe(stripe);
+  }
+}
+
+void KeyValueTable::clear() {
+  for (auto &stripe : m_stripes) {
+    unique_lock<shared_mutex> lock(stripe.mutex);
+    m_size -= stripe.count;
+    stripe.slots.clear();
+    stripe.slots.resize(InitialStripeCapacity);
+    stripe.count = 0;
+    stripe.encodedCount = 0;
+  }
+}
+
+size_t KeyValueTable::size() const noexcept {
+  return m_size;
+}
+
+} // namespace react
+} // namespace facebook
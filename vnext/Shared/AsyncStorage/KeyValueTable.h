@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// In-memory table backing KeyValueStorage.
+//
+// Keys are spread over a fixed number of stripes. Each stripe is an
+// open-addressing (linear probing) hash table with its own reader/writer lock,
+// so concurrent readers never block each other and only contend with a writer
+// touching the same stripe.
+//
+// Values are immutable and reference counted. Lookups hand out a reference to
+// the stored string rather than a copy, and replacing or erasing a value does
+// not invalidate references that readers already hold.
+//
+// Values may also be stored in their encoded on-disk form (see assignEncoded).
+// Those are decoded on first access, so a freshly loaded table only pays for
+// the values that are actually read.
+class KeyValueTable {
+ public:
+  using Value = std::shared_ptr<const std::string>;
+  using Decoder = std::string (*)(std::string_view encoded);
+
+  explicit KeyValueTable(Decoder decoder = nullptr);
+
+  // Returns nullptr if the key is not present.
+  Value find(std::string_view key) const;
+
+  // Both return the value previously stored for the key, or nullptr.
+  Value insertOrAssign(std::string_view key, Value value);
+  Value erase(std::string_view key);
+
+  void clear();
+  size_t size() const noexcept;
+
+  // Bulk loading support. Stores a value in its encoded form, to be decoded by
+  // the table's Decoder on first access. The encoded text must stay valid until
+  // decodeAll returns. Both return the encoded text of the entry they replaced
+  // and are only meant to be used before any value was read.
+  std::optional<std::string_view> assignEncoded(std::string_view key, std::string_view encodedValue);
+  std::optional<std::string_view> eraseEncoded(std::string_view key);
+
+  // Decodes every value still in encoded form, after which the encoded text is
+  // no longer referenced.
+  void decodeAll() const;
+
+  // Calls fn(std::string_view key, const std::string &value) for every entry.
+  // Stripes are visited one at a time under their read lock, so fn must not
+  // call back into the table.
+  template <typename TFunc>
+  void forEach(TFunc &&fn) const {
+    for (auto &stripe : m_stripes) {
+      std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+      if (stripe.encodedCount > 0) {
+        lock.unlock();
+        {
+          std::unique_lock<std::shared_mutex> writeLock(stripe.mutex);
+          decodeStripe(stripe);
+        }
+        lock.lock();
+      }
+
+      for (const auto &slot : stripe.slots) {
+        if (slot.occupied())
+          fn(std::string_view{slot.key}, *slot.value);
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t StripeCount = 16; // must be a power of two
+  static constexpr size_t StripeBits = 4;
+  static constexpr size_t InitialStripeCapacity = 16; // must be a power of two
+
+  // A slot holds either a decoded value or the encoded text of one, and is
+  // empty when it holds neither.
+  struct Slot {
+    size_t hash{0};
+    std::string key;
+    Value value;
+    std::string_view encoded;
+
+    bool occupied() const noexcept {
+      return value || encoded.data();
+    }
+  };
+
+  struct Stripe {
+    mutable std::shared_mutex mutex;
+    std::vector<Slot> slots;
+    size_t count{0};
+    size_t encodedCount{0};
+  };
+
+  static constexpr size_t NotFound = static_cast<size_t>(-1);
+
+  static size_t hashKey(std::string_view key) noexcept;
+  static size_t findSlot(const Stripe &stripe, size_t hash, std::string_view key) noexcept;
+  static void placeSlot(std::vector<Slot> &slots, Slot &&slot) noexcept;
+  static void grow(Stripe &stripe);
+  static void removeSlot(Stripe &stripe, size_t i) noexcept;
+
+  // Callers must hold the stripe's write lock.
+  void decodeSlot(Stripe &stripe, Slot &slot) const;
+  void decodeStripe(Stripe &stripe) const;
+
+  Stripe &stripeFor(size_t hash) const noexcept;
+
+  // Decoding happens on lookup, hence mutable.
+  mutable std::array<Stripe, StripeCount> m_stripes;
+  std::atomic<size_t> m_size{0};
+  Decoder m_decoder;
+};
+
+} // namespace react
+} // namespace facebook
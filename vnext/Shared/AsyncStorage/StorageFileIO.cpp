@@ -92,44 +92,10 @@ StorageFileIO::StorageFileIO(const WCHAR *storageFileName) {
 
 StorageFileIO::~StorageFileIO() {}
 
-bool StorageFileIO::getLine(std::string &line) {
-  line = "";
-  auto startingIdx = m_fileBufferIdx;
-  char c = '\0';
-  do {
-    if (!m_fileBufferInited || (m_fileBufferIdx == IOHelperBufferSize)) {
-      line.append(&m_fileBuffer[startingIdx], m_fileBufferIdx - startingIdx);
-      m_fileBufferSize = fread(m_fileBuffer, sizeof(char), IOHelperBufferSize, m_storageFile.get());
-      m_fileBufferInited = true;
-      m_fileBufferIdx = 0;
-      startingIdx = 0;
-    }
-
-    if (m_fileBufferIdx == m_fileBufferSize)
-      return false;
-
-    c = m_fileBuffer[m_fileBufferIdx];
-    m_fileBufferIdx++;
-  } while (c != '\n');
-
-  // Note that the -1 is to exclude the \n character.
-  line.append(&m_fileBuffer[startingIdx], m_fileBufferIdx - startingIdx - 1);
-  return true;
-}
-
-void StorageFileIO::resetLine() {
+void StorageFileIO::clear() {
   if (fseek(m_storageFile.get(), 0, SEEK_SET))
     throwLastErrorMessage();
 
-  m_fileBufferInited = false;
-  memset(m_fileBuffer, 0, IOHelperBufferSize * sizeof(char));
-  m_fileBufferIdx = 0;
-  m_fileBufferSize = IOHelperBufferSize;
-}
-
-void StorageFileIO::clear() {
-  resetLine();
-
   bool success = SetEndOfFile(m_storageFileHandle);
   if (!success)
     throwLastErrorMessage();
@@ -144,6 +110,50 @@ void StorageFileIO::flush() {
   fflush(m_storageFile.get());
 }
 
+// Moves the seek pointer to the end of the file so that append can follow
+// reads, and returns the file size in bytes.
+size_t StorageFileIO::seekToEnd() {
+  if (fseek(m_storageFile.get(), 0, SEEK_END))
+    throwLastErrorMessage();
+
+  const auto position = _ftelli64(m_storageFile.get());
+  if (position < 0)
+    throwLastErrorMessage();
+
+  return static_cast<size_t>(position);
+}
+
+std::string_view StorageFileIO::mapView() {
+  unmapView();
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(m_storageFileHandle, &fileSize))
+    throwLastErrorMessage();
+
+  // Mapping an empty file fails, and there is nothing to read anyway.
+  if (fileSize.QuadPart == 0)
+    return {};
+
+  std::unique_ptr<void, decltype(&CloseHandle)> fileMapping{
+      CreateFileMappingFromApp(
+          m_storageFileHandle, nullptr /* SecurityAttributes */, PAGE_READONLY, 0 /* MaximumSize */, nullptr /* Name */),
+      &CloseHandle};
+  if (!fileMapping)
+    throwLastErrorMessage();
+
+  // The view keeps the mapping alive after its handle is closed.
+  m_fileView.reset(
+      MapViewOfFileFromApp(fileMapping.get(), FILE_MAP_READ, 0 /* FileOffset */, 0 /* NumberOfBytesToMap */));
+  if (!m_fileView)
+    throwLastErrorMessage();
+
+  return {static_cast<const char *>(m_fileView.get()), static_cast<size_t>(fileSize.QuadPart)};
+}
+
+void StorageFileIO::unmapView() noexcept {
+  m_fileView.reset();
+}
+
 void StorageFileIO::throwLastErrorMessage() {
   char errorMessageBuffer[IOHelperBufferSize + 1] = {0};
   FormatMessageA(
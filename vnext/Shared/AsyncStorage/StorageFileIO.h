@@ -8,6 +8,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace facebook {
@@ -19,22 +20,28 @@ class StorageFileIO {
 
   void clear();
   void append(const std::string &fileContent);
-  void resetLine();
-  bool getLine(std::string &line);
   void flush();
+  size_t seekToEnd();
+
+  // Maps the file contents as they are now for reading. The view stays valid
+  // until unmapView is called or this object is destroyed. The file cannot be
+  // cleared while it is mapped.
+  std::string_view mapView();
+  void unmapView() noexcept;
 
   static void throwLastErrorMessage();
 
  private:
+  static void FileViewDeleter(void *p) {
+    UnmapViewOfFile(p);
+  }
+
   HANDLE m_storageFileHandle;
   std::unique_ptr<FILE, std::function<void(FILE *)>> m_storageFile;
+  std::unique_ptr<void, decltype(&FileViewDeleter)> m_fileView{nullptr, &FileViewDeleter};
 
  private:
   static const size_t IOHelperBufferSize = 1024;
-  char m_fileBuffer[IOHelperBufferSize + 1] = {0};
-  size_t m_fileBufferIdx = 0;
-  size_t m_fileBufferSize = IOHelperBufferSize;
-  bool m_fileBufferInited = false;
 };
 } // namespace react
 } // namespace facebook
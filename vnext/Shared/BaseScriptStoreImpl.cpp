@@ -6,13 +6,17 @@
 #include "BaseScriptStoreImpl.h"
 #include "MemoryMappedBuffer.h"
 
-#include <CppRuntimeOptions.h>
-
-// C++/WinRT
-#include <winrt/base.h>
-
 // Standard Library
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
 
 namespace facebook {
 namespace react {
@@ -78,8 +82,202 @@ class BufferViewBuffer : public facebook::jsi::Buffer {
   size_t size_;
 };
 
-constexpr const char *PERSIST_MAGIC = "RNWPREP";
+// Streaming implementation of the XXH64 hash.
+// It hashes several GB per second, so versioning a bundle by its content costs little more than reading it.
+class ContentHash {
+ public:
+  void update(const uint8_t *data, size_t size) noexcept {
+    totalSize_ += size;
+
+    if (bufferSize_ + size < StripeSize) {
+      memcpy(buffer_ + bufferSize_, data, size);
+      bufferSize_ += size;
+      return;
+    }
+
+    const uint8_t *end = data + size;
+    if (bufferSize_ > 0) {
+      const size_t fill = StripeSize - bufferSize_;
+      memcpy(buffer_ + bufferSize_, data, fill);
+      data += fill;
+      consumeStripe(buffer_);
+      bufferSize_ = 0;
+    }
+
+    for (; data + StripeSize <= end; data += StripeSize) {
+      consumeStripe(data);
+    }
+
+    bufferSize_ = static_cast<size_t>(end - data);
+    memcpy(buffer_, data, bufferSize_);
+  }
+
+  uint64_t digest() const noexcept {
+    uint64_t hash;
+    if (totalSize_ >= StripeSize) {
+      hash = rotl(acc_[0], 1) + rotl(acc_[1], 7) + rotl(acc_[2], 12) + rotl(acc_[3], 18);
+      for (uint64_t acc : acc_) {
+        hash = (hash ^ round(0, acc)) * Prime1 + Prime4;
+      }
+    } else {
+      hash = Prime5;
+    }
+
+    hash += totalSize_;
+
+    const uint8_t *data = buffer_;
+    const uint8_t *end = buffer_ + bufferSize_;
+    for (; data + 8 <= end; data += 8) {
+      hash = rotl(hash ^ round(0, read64(data)), 27) * Prime1 + Prime4;
+    }
+
+    if (data + 4 <= end) {
+      hash = rotl(hash ^ (read32(data) * Prime1), 23) * Prime2 + Prime3;
+      data += 4;
+    }
+
+    for (; data < end; ++data) {
+      hash = rotl(hash ^ (*data * Prime5), 11) * Prime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= Prime2;
+    hash ^= hash >> 29;
+    hash *= Prime3;
+    hash ^= hash >> 32;
+    return hash;
+  }
+
+  static uint64_t of(const uint8_t *data, size_t size) noexcept {
+    ContentHash hash;
+    hash.update(data, size);
+    return hash.digest();
+  }
+
+ private:
+  static constexpr uint64_t Prime1 = 11400714785074694791ULL;
+  static constexpr uint64_t Prime2 = 14029467366897019727ULL;
+  static constexpr uint64_t Prime3 = 1609587929392839161ULL;
+  static constexpr uint64_t Prime4 = 9650029242287828579ULL;
+  static constexpr uint64_t Prime5 = 2870177450012600261ULL;
+  static constexpr size_t StripeSize = 32;
+
+  static uint64_t rotl(uint64_t value, int bits) noexcept {
+    return (value << bits) | (value >> (64 - bits));
+  }
+
+  static uint64_t round(uint64_t acc, uint64_t input) noexcept {
+    return rotl(acc + input * Prime2, 31) * Prime1;
+  }
+
+  static uint64_t read64(const uint8_t *data) noexcept {
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+  }
+
+  static uint64_t read32(const uint8_t *data) noexcept {
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+  }
+
+  void consumeStripe(const uint8_t *data) noexcept {
+    for (size_t i = 0; i < 4; ++i) {
+      acc_[i] = round(acc_[i], read64(data + i * 8));
+    }
+  }
+
+  uint64_t acc_[4]{Prime1 + Prime2, Prime2, 0, 0 - Prime1};
+  uint8_t buffer_[StripeSize];
+  size_t bufferSize_{0};
+  uint64_t totalSize_{0};
+};
+
+// Hashes size bytes of the file, starting at offset, without keeping the file in memory.
+// Returns false if the file cannot be read.
+bool hashFile(const std::string &path, uint64_t offset, uint64_t size, uint64_t &hash) noexcept {
+  std::ifstream file(fs::u8path(path), std::ios::binary);
+  if (!file || !file.seekg(static_cast<std::streamoff>(offset), std::ios::beg)) {
+    return false;
+  }
+
+  ContentHash contentHash;
+  std::vector<char> chunk(64 * 1024);
+  while (size > 0) {
+    auto chunkSize = static_cast<std::streamsize>(std::min<uint64_t>(size, chunk.size()));
+    if (!file.read(chunk.data(), chunkSize)) {
+      return false;
+    }
+
+    contentHash.update(reinterpret_cast<const uint8_t *>(chunk.data()), static_cast<size_t>(chunkSize));
+    size -= static_cast<uint64_t>(chunkSize);
+  }
+
+  hash = contentHash.digest();
+  return true;
+}
+
+// Zero means that the version is not available.
+jsi::ScriptVersion_t toScriptVersion(uint64_t contentHash) noexcept {
+  return contentHash != 0 ? contentHash : 1;
+}
+
+// Content hashes are kept by path, and reused while the file keeps its size and modification time, so that
+// a bundle is hashed once per process. Files modified shortly before they were hashed are hashed again: another
+// write within the resolution of the file times would not change the modification time.
+jsi::ScriptVersion_t getFileContentVersion(const std::string &path) noexcept {
+  struct FileVersion {
+    uint64_t size;
+    fs::file_time_type lastWriteTime;
+    jsi::ScriptVersion_t version;
+  };
+
+  constexpr auto FileTimeResolution = std::chrono::seconds{2};
+  static std::mutex s_mutex;
+  static std::unordered_map<std::string, FileVersion> s_fileVersions;
+
+  try {
+    std::error_code ec;
+    auto filePath = fs::u8path(path);
+    auto size = fs::file_size(filePath, ec);
+    if (ec) {
+      return 0;
+    }
+
+    auto lastWriteTime = fs::last_write_time(filePath, ec);
+    const bool isCacheable = !ec;
+    if (isCacheable) {
+      std::scoped_lock lock{s_mutex};
+      auto it = s_fileVersions.find(path);
+      if (it != s_fileVersions.end() && it->second.size == size && it->second.lastWriteTime == lastWriteTime) {
+        return it->second.version;
+      }
+    }
+
+    auto hashTime = fs::file_time_type::clock::now();
+    uint64_t hash;
+    if (!hashFile(path, 0, size, hash)) {
+      return 0;
+    }
+
+    auto version = toScriptVersion(hash);
+    if (isCacheable && lastWriteTime + FileTimeResolution < hashTime) {
+      std::scoped_lock lock{s_mutex};
+      s_fileVersions[path] = {size, lastWriteTime, version};
+    }
+
+    return version;
+  } catch (const std::exception &) {
+    return 0;
+  }
+}
+
+// The last character is the version of the file format.
+constexpr const char *PERSIST_MAGIC = "RNWPRE2";
 constexpr const char *PERSIST_EOF = "EOF";
+constexpr const char *PERSIST_FILE_PREFIX = "prep_";
+constexpr const char *PERSIST_FILE_EXTENSION = ".cache";
 
 int constexpr length__(const char *str) {
   return *str ? 1 + length__(str + 1) : 0;
@@ -92,6 +290,7 @@ struct PreparedScriptPrefix {
   jsi::ScriptVersion_t scriptVersion;
   jsi::JSRuntimeVersion_t runtimeVersion;
   uint64_t sizeInBytes;
+  uint64_t checksum; // Content hash of the prepared script.
 };
 
 struct PreparedScriptSuffix {
@@ -101,42 +300,55 @@ struct PreparedScriptSuffix {
 } // namespace
 
 jsi::VersionedBuffer BaseScriptStoreImpl::getVersionedScript(const std::string &url) noexcept {
-  std::ifstream file(url, std::ios::binary | std::ios::ate);
-
-  if (!file) {
-    return {nullptr, 0};
+  // Map the bundle instead of copying it, so that its pages are loaded only when the engine reads them.
+  // The version is not hashed from the mapping for the same reason.
+  try {
+    auto buffer = Microsoft::JSI::MakeMemoryMappedBuffer(url);
+    auto version = versionProvider_ ? versionProvider_->getVersion(url) : getFileContentVersion(url);
+    return {std::move(buffer), version};
+  } catch (const std::exception &) {
+    // Fall back to reading the file, e.g. when it is empty.
   }
 
-  std::streamsize size = file.tellg();
-  file.seekg(0, std::ios::beg);
+  // The URL is a UTF-8 path, the same as for the memory mapping.
+  // Invalid UTF-8 and allocation failures are reported as a missing script.
+  try {
+    std::ifstream file(fs::u8path(url), std::ios::binary | std::ios::ate);
 
-  auto buffer = std::make_unique<ByteArrayBuffer>(static_cast<size_t>(size));
-  if (!file.read(reinterpret_cast<char *>(buffer->data()), size)) {
-    return {nullptr, 0};
-  }
+    if (!file) {
+      return {nullptr, 0};
+    }
 
-  file.close();
+    std::streamsize size = file.tellg();
+    file.seekg(0, std::ios::beg);
 
-  return {std::move(buffer), versionProvider_ ? versionProvider_->getVersion(url) : static_cast<uint64_t>(size)};
+    auto buffer = std::make_unique<ByteArrayBuffer>(static_cast<size_t>(size));
+    if (!file.read(reinterpret_cast<char *>(buffer->data()), size)) {
+      return {nullptr, 0};
+    }
+
+    file.close();
+
+    auto version = versionProvider_ ? versionProvider_->getVersion(url)
+                                    : toScriptVersion(ContentHash::of(buffer->data(), buffer->size()));
+    return {std::move(buffer), version};
+  } catch (const std::exception &) {
+    return {nullptr, 0};
+  }
 }
 
 jsi::ScriptVersion_t BaseScriptStoreImpl::getScriptVersion(const std::string &url) noexcept {
   if (versionProvider_) {
     return versionProvider_->getVersion(url);
   } else {
-    std::ifstream file(url, std::ios::binary | std::ios::ate);
-
-    if (!file) {
-      return 0;
-    }
-
-    std::streamsize size = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    return static_cast<uint64_t>(size);
+    return getFileContentVersion(url);
   }
 }
 
+jsi::ScriptVersion_t LocalFileSimpleScriptVersionProvider::getVersion(const std::string &url) noexcept {
+  return getFileContentVersion(url);
+}
+
 std::unique_ptr<const jsi::Buffer> LocalFileSimpleBufferStore::getBuffer(const std::string &bufferId) noexcept {
   // 1. Store path must be set
   // 2. It must be a directory that exists. TODO :: Figure out a cross platform
@@ -146,29 +358,11 @@ std::unique_ptr<const jsi::Buffer> LocalFileSimpleBufferStore::getBuffer(const s
     std::terminate();
   }
 
-  if (Microsoft::React::GetRuntimeOptionBool("JSI.MemoryMappedScriptStore")) {
-    try {
-      return Microsoft::JSI::MakeMemoryMappedBuffer(winrt::to_hstring(storeDirectory_ + bufferId).c_str());
-    } catch (const facebook::jsi::JSINativeException &) {
-      return nullptr;
-    }
-  } else {
-    // Treat buffer id as the relative path fragment.
-    std::ifstream file(storeDirectory_ + bufferId, std::ios::binary | std::ios::ate);
-
-    if (!file) {
-      return nullptr;
-    }
-
-    std::streamsize size = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    auto buffer = std::make_unique<ByteArrayBuffer>(static_cast<size_t>(size));
-    if (!file.read(reinterpret_cast<char *>(buffer->data()), size)) {
-      return nullptr;
-    }
-
-    return buffer;
+  // Treat buffer id as the relative path fragment.
+  try {
+    return Microsoft::JSI::MakeMemoryMappedBuffer(storeDirectory_ + bufferId);
+  } catch (const std::exception &) {
+    return nullptr;
   }
 }
 
@@ -179,14 +373,34 @@ bool LocalFileSimpleBufferStore::persistBuffer(
   if (storeDirectory_.empty())
     std::terminate();
 
+  // Write to a file that is unique to this thread, and rename it when it is complete.
+  // Readers see either the previous buffer or the new one, never a partially written one.
+  const std::string path = storeDirectory_ + relativeUrl;
+  const std::string temporaryPath = path + ".tmp" +
+      std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()) ^
+                     static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+
   std::ofstream file;
-  file.open(storeDirectory_ + relativeUrl, std::ios::binary | std::ios::trunc);
+  file.open(fs::u8path(temporaryPath), std::ios::binary | std::ios::trunc);
   if (!file)
     return false;
 
   file.write(reinterpret_cast<const char *>(buffer->data()), buffer->size());
   file.close();
 
+  std::error_code ec;
+  if (!file) {
+    fs::remove(fs::u8path(temporaryPath), ec);
+    return false;
+  }
+
+  // Fails if the previous buffer is still mapped on Windows. It is then kept.
+  fs::rename(fs::u8path(temporaryPath), fs::u8path(path), ec);
+  if (ec) {
+    fs::remove(fs::u8path(temporaryPath), ec);
+    return false;
+  }
+
   return true;
 }
 
@@ -197,7 +411,7 @@ std::string BasePreparedScriptStoreImpl::getPreparedScriptFileName(
   // Essentially, we are trying to construct,
   // prep_<source_url>_<runtime_id>_<preparation_tag>.cache
 
-  std::string prparedScriptFileName("prep_");
+  std::string prparedScriptFileName(PERSIST_FILE_PREFIX);
 
   const std::string &scriptUrl = scriptSignature.url;
 
@@ -228,7 +442,7 @@ std::string BasePreparedScriptStoreImpl::getPreparedScriptFileName(
   // https://en.wikipedia.org/wiki/Base64#Filenames
 
   // extension
-  prparedScriptFileName.append(".cache");
+  prparedScriptFileName.append(PERSIST_FILE_EXTENSION);
 
   return prparedScriptFileName;
 }
@@ -245,6 +459,11 @@ std::shared_ptr<const jsi::Buffer> BasePreparedScriptStoreImpl::tryGetPreparedSc
     return nullptr;
   }
 
+  if (buffer->size() < sizeof(PreparedScriptPrefix) + sizeof(PreparedScriptSuffix)) {
+    // The store is corrupted.
+    return nullptr;
+  }
+
   const PreparedScriptPrefix *prefix = reinterpret_cast<const PreparedScriptPrefix *>(buffer->data());
 
   if (strncmp(prefix->magic, PERSIST_MAGIC, sizeof(prefix->magic)) != 0) {
@@ -277,6 +496,28 @@ std::shared_ptr<const jsi::Buffer> BasePreparedScriptStoreImpl::tryGetPreparedSc
     return nullptr;
   }
 
+  uint64_t checksum;
+  if (!storeDirectory_.empty()) {
+    // Read the file instead of the mapped buffer, so that the verification does not load the whole prepared script
+    // into the working set before the engine needs it.
+    const std::string path = storeDirectory_ + preparedScriptFilePath;
+    if (!hashFile(path, sizeof(PreparedScriptPrefix), prefix->sizeInBytes, checksum))
+      return nullptr;
+  } else {
+    checksum = ContentHash::of(buffer->data() + sizeof(PreparedScriptPrefix), static_cast<size_t>(prefix->sizeInBytes));
+  }
+
+  if (checksum != prefix->checksum) {
+    // The prepared script is corrupted.
+    return nullptr;
+  }
+
+  if (!storeDirectory_.empty()) {
+    // The modification time orders the cache files for eviction.
+    std::error_code ec;
+    fs::last_write_time(fs::u8path(storeDirectory_ + preparedScriptFilePath), fs::file_time_type::clock::now(), ec);
+  }
+
   return std::make_shared<BufferViewBuffer>(
       std::move(buffer), sizeof(PreparedScriptPrefix), static_cast<size_t>(prefix->sizeInBytes));
 }
@@ -296,6 +537,7 @@ void BasePreparedScriptStoreImpl::persistPreparedScript(
   prefix->scriptVersion = scriptMetadata.version;
   prefix->runtimeVersion = runtimeMetadata.version;
   prefix->sizeInBytes = preparedScript->size();
+  prefix->checksum = ContentHash::of(preparedScript->data(), preparedScript->size());
 
   memcpy_s(
       newBuffer->data() + sizeof(PreparedScriptPrefix),
@@ -309,7 +551,67 @@ void BasePreparedScriptStoreImpl::persistPreparedScript(
 
   std::string preparedScriptFilePath = getPreparedScriptFileName(scriptMetadata, runtimeMetadata, prepareTag);
 
-  bufferStore_->persistBuffer(preparedScriptFilePath, std::move(newBuffer));
+  if (bufferStore_->persistBuffer(preparedScriptFilePath, std::move(newBuffer))) {
+    evictPreparedScripts(preparedScriptFilePath);
+  }
+}
+
+void BasePreparedScriptStoreImpl::evictPreparedScripts(const std::string &keptFileName) noexcept {
+  if (storeDirectory_.empty()) {
+    return;
+  }
+
+  struct CacheFile {
+    fs::path path;
+    uint64_t size;
+    fs::file_time_type lastUsed;
+  };
+
+  // The store directory may be shared with other files, e.g. when it is the temporary folder.
+  // Only the files named like prepared scripts are considered. Temporary files may still be written by another
+  // runtime, so they are left alone.
+  const std::string extension{PERSIST_FILE_EXTENSION};
+  std::error_code ec;
+  std::vector<CacheFile> cacheFiles;
+  uint64_t storeSize = 0;
+  for (fs::directory_iterator it{fs::u8path(storeDirectory_), ec}, end; !ec && it != end; it.increment(ec)) {
+    std::string fileName = it->path().filename().u8string();
+    if (fileName.rfind(PERSIST_FILE_PREFIX, 0) != 0 || fileName.size() < extension.size() ||
+        fileName.compare(fileName.size() - extension.size(), extension.size(), extension) != 0) {
+      continue;
+    }
+
+    std::error_code fileEc;
+    uint64_t size = it->file_size(fileEc);
+    auto lastUsed = it->last_write_time(fileEc);
+    if (fileEc) {
+      continue;
+    }
+
+    storeSize += size;
+    if (fileName != keptFileName) {
+      cacheFiles.push_back({it->path(), size, lastUsed});
+    }
+  }
+
+  if (storeSize <= maxStoreSize_) {
+    return;
+  }
+
+  std::sort(cacheFiles.begin(), cacheFiles.end(), [](const CacheFile &a, const CacheFile &b) {
+    return a.lastUsed < b.lastUsed;
+  });
+
+  for (const auto &cacheFile : cacheFiles) {
+    if (storeSize <= maxStoreSize_) {
+      break;
+    }
+
+    // Fails while another runtime maps the file. It is evicted by a later call.
+    if (fs::remove(cacheFile.path, ec)) {
+      storeSize -= cacheFile.size;
+    }
+  }
 }
 
 } // namespace react
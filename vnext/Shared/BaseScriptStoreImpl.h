@@ -19,6 +19,8 @@ struct BufferStore {
   virtual bool persistBuffer(const std::string &bufferId, std::unique_ptr<const facebook::jsi::Buffer>) noexcept = 0;
 };
 
+// Buffers are memory mapped. A persisted buffer is written to a temporary file that is renamed when it is complete,
+// so a partially written buffer is never returned.
 class LocalFileSimpleBufferStore : public BufferStore {
  public:
   LocalFileSimpleBufferStore(const std::string &storeDirectory) : storeDirectory_(storeDirectory) {}
@@ -34,6 +36,7 @@ struct ScriptVersionProvider {
   virtual facebook::jsi::ScriptVersion_t getVersion(const std::string &url) noexcept = 0;
 };
 
+// The version is a hash of the file content.
 class LocalFileSimpleScriptVersionProvider : public ScriptVersionProvider {
  public:
   facebook::jsi::ScriptVersion_t getVersion(const std::string &url) noexcept override;
@@ -45,8 +48,13 @@ struct PreparedScriptStoreNameGenerator {
 
 // Dead simple implementation with local filesystem storage using standard c++
 // fileio but with optional extension point with custom bufferStore.
+// Prepared scripts are stored with a hash of their content, and are not returned if it does not match.
+// With the local filesystem storage, the least recently used prepared scripts are deleted when the total size of
+// the stored prepared scripts exceeds maxStoreSize.
 class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
  public:
+  static constexpr uint64_t DefaultMaxStoreSize = 64 * 1024 * 1024;
+
   std::shared_ptr<const facebook::jsi::Buffer> tryGetPreparedScript(
       const facebook::jsi::ScriptSignature &scriptSignature,
       const facebook::jsi::JSRuntimeSignature &runtimeSignature,
@@ -58,8 +66,10 @@ class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
       const facebook::jsi::JSRuntimeSignature &runtimeSignature,
       const char *prepareTag) noexcept override;
 
-  BasePreparedScriptStoreImpl(const std::string &storeDirectory)
-      : bufferStore_(std::make_shared<LocalFileSimpleBufferStore>(storeDirectory)) {}
+  BasePreparedScriptStoreImpl(const std::string &storeDirectory, uint64_t maxStoreSize = DefaultMaxStoreSize)
+      : bufferStore_(std::make_shared<LocalFileSimpleBufferStore>(storeDirectory)),
+        storeDirectory_(storeDirectory),
+        maxStoreSize_(maxStoreSize) {}
 
   BasePreparedScriptStoreImpl(std::shared_ptr<BufferStore> bufferStore) : bufferStore_(std::move(bufferStore)) {}
 
@@ -69,11 +79,17 @@ class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
       const facebook::jsi::JSRuntimeSignature &runtimeMetadata,
       const char *prepareTag);
 
+  void evictPreparedScripts(const std::string &keptFileName) noexcept;
+
   std::shared_ptr<BufferStore> bufferStore_;
+
+  // Empty when a custom bufferStore is used.
+  std::string storeDirectory_;
+  uint64_t maxStoreSize_{0};
 };
 
 // Dead simple script store implementation assuming that the script url is a
-// local filesystam path and assuming the script version is the script size, but
+// local filesystam path and assuming the script version is a hash of the script content, but
 // with extension point to provide custom version provider.
 class BaseScriptStoreImpl : public facebook::jsi::ScriptStore {
  public:
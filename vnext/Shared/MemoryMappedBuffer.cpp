@@ -4,32 +4,69 @@
 #include "pch.h"
 #include "MemoryMappedBuffer.h"
 
+#include <cstring>
+#include <limits>
+
+#ifdef _WIN32
+#include <unicode.h>
 #include <werapi.h>
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
 
 namespace {
 
-class MemoryMappedBuffer : public facebook::jsi::Buffer {
+uint32_t GetPageSize() noexcept {
+#ifdef _WIN32
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  return systemInfo.dwPageSize;
+#else
+  return static_cast<uint32_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// Read-only view of a whole file.
+class MemoryMappedFile {
  public:
-  MemoryMappedBuffer(const wchar_t *const filename, uint32_t offset);
+#ifdef _WIN32
+  MemoryMappedFile(const wchar_t *const filename);
+#endif
+  MemoryMappedFile(const char *const filenameUtf8);
+  ~MemoryMappedFile();
 
-  size_t size() const override;
-  const uint8_t *data() const override;
+  MemoryMappedFile(const MemoryMappedFile &) = delete;
+  MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
 
- private:
-  static void FileDataDeleter(void *p) {
-    WerUnregisterMemoryBlock(p);
-    UnmapViewOfFile(p);
+  uint32_t size() const noexcept {
+    return m_fileSize;
   }
 
-  std::unique_ptr<void, decltype(&CloseHandle)> m_fileMapping;
-  std::unique_ptr<void, decltype(&FileDataDeleter)> m_fileData;
+  const uint8_t *data() const noexcept {
+    return static_cast<const uint8_t *>(m_fileData);
+  }
+
+ private:
+#ifdef _WIN32
+  std::unique_ptr<void, decltype(&CloseHandle)> m_fileMapping{nullptr, &CloseHandle};
+#endif
+  void *m_fileData = nullptr;
   uint32_t m_fileSize = 0;
-  uint32_t m_offset = 0;
 };
 
-MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, uint32_t offset)
-    : m_fileMapping{nullptr, &CloseHandle}, m_fileData{nullptr, &FileDataDeleter}, m_offset{offset} {
+#ifdef _WIN32
+
+MemoryMappedFile::MemoryMappedFile(const char *const filenameUtf8)
+    : MemoryMappedFile(
+          filenameUtf8 ? Microsoft::Common::Unicode::Utf8ToUtf16(filenameUtf8).c_str()
+                       : static_cast<const wchar_t *>(nullptr)) {}
+
+MemoryMappedFile::MemoryMappedFile(const wchar_t *const filename) {
   if (!filename) {
     throw facebook::jsi::JSINativeException("MemoryMappedBuffer constructor is called with nullptr filename.");
   }
@@ -58,9 +95,6 @@ MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, uint32_t o
   }
 
   m_fileSize = fileSize.LowPart;
-  if (m_offset > m_fileSize) {
-    throw facebook::jsi::JSINativeException("Invalid offset.");
-  }
 
   m_fileMapping.reset(CreateFileMappingFromApp(
       fileHandle.get(), nullptr /* SecurityAttributes */, PAGE_READONLY, m_fileSize, nullptr /* Name */));
@@ -70,31 +104,153 @@ MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, uint32_t o
         "CreateFileMapping/CreateFileMappingFromApp failed with last error " + std::to_string(GetLastError()));
   }
 
-  m_fileData.reset(
-      MapViewOfFileFromApp(m_fileMapping.get(), FILE_MAP_READ, 0 /* FileOffset */, 0 /* NumberOfBytesToMap */));
+  m_fileData = MapViewOfFileFromApp(m_fileMapping.get(), FILE_MAP_READ, 0 /* FileOffset */, 0 /* NumberOfBytesToMap */);
 
   if (!m_fileData) {
     throw facebook::jsi::JSINativeException(
         "MapViewOfFile/MapViewOfFileFromApp failed with last error " + std::to_string(GetLastError()));
   }
 
-  WerRegisterMemoryBlock(m_fileData.get(), m_fileSize);
+  WerRegisterMemoryBlock(m_fileData, m_fileSize);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (m_fileData) {
+    WerUnregisterMemoryBlock(m_fileData);
+    UnmapViewOfFile(m_fileData);
+  }
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const char *const filenameUtf8) {
+  if (!filenameUtf8) {
+    throw facebook::jsi::JSINativeException("MemoryMappedBuffer constructor is called with nullptr filename.");
+  }
+
+  int fd = open(filenameUtf8, O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    throw facebook::jsi::JSINativeException("open failed with errno " + std::to_string(errno));
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) == -1) {
+    int error = errno;
+    close(fd);
+    throw facebook::jsi::JSINativeException("fstat failed with errno " + std::to_string(error));
+  }
+
+  if (fileStat.st_size == 0) {
+    close(fd);
+    throw facebook::jsi::JSINativeException("Cannot memory map an empty file.");
+  }
+
+  if (static_cast<uint64_t>(fileStat.st_size) > std::numeric_limits<uint32_t>::max()) {
+    close(fd);
+    throw facebook::jsi::JSINativeException(
+        "MemoryMappedBuffer only supports files whose size can fit within an "
+        "uint32_t.");
+  }
+
+  m_fileSize = static_cast<uint32_t>(fileStat.st_size);
+
+  // The mapping stays valid after the file descriptor is closed.
+  void *fileData = mmap(nullptr, m_fileSize, PROT_READ, MAP_PRIVATE, fd, 0 /* offset */);
+  int error = errno;
+  close(fd);
+
+  if (fileData == MAP_FAILED) {
+    throw facebook::jsi::JSINativeException("mmap failed with errno " + std::to_string(error));
+  }
+
+  m_fileData = fileData;
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (m_fileData) {
+    munmap(m_fileData, m_fileSize);
+  }
+}
+
+#endif // _WIN32
+
+class MemoryMappedBuffer : public facebook::jsi::Buffer {
+ public:
+  template <typename TChar>
+  MemoryMappedBuffer(const TChar *const filename, uint32_t offset);
+
+  size_t size() const override;
+  const uint8_t *data() const override;
+
+ private:
+  MemoryMappedFile m_file;
+  uint32_t m_offset = 0;
+};
+
+template <typename TChar>
+MemoryMappedBuffer::MemoryMappedBuffer(const TChar *const filename, uint32_t offset)
+    : m_file{filename}, m_offset{offset} {
+  if (m_offset > m_file.size()) {
+    throw facebook::jsi::JSINativeException("Invalid offset.");
+  }
 }
 
 size_t MemoryMappedBuffer::size() const {
-  return m_fileSize - m_offset;
+  return m_file.size() - m_offset;
 }
 
 const uint8_t *MemoryMappedBuffer::data() const {
-  return static_cast<const uint8_t *>(m_fileData.get()) + m_offset;
+  return m_file.data() + m_offset;
+}
+
+class MemoryMappedBigString : public facebook::react::JSBigString {
+ public:
+  MemoryMappedBigString(const char *const filenameUtf8);
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char *c_str() const override {
+    return m_copy ? m_copy.get() : reinterpret_cast<const char *>(m_file.data());
+  }
+
+  size_t size() const override {
+    return m_file.size();
+  }
+
+ private:
+  MemoryMappedFile m_file;
+
+  // Null-terminated copy of the file when the mapping has no room for the terminator.
+  std::unique_ptr<char[]> m_copy;
+};
+
+MemoryMappedBigString::MemoryMappedBigString(const char *const filenameUtf8) : m_file{filenameUtf8} {
+  static const uint32_t s_pageSize = GetPageSize();
+  if (m_file.size() % s_pageSize == 0) {
+    m_copy = std::make_unique<char[]>(static_cast<size_t>(m_file.size()) + 1);
+    memcpy(m_copy.get(), m_file.data(), m_file.size());
+    m_copy[m_file.size()] = '\0';
+  }
 }
 
 } // anonymous namespace
 
 namespace Microsoft::JSI {
 
+#ifdef _WIN32
 std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, uint32_t offset) {
   return std::make_unique<MemoryMappedBuffer>(filename, offset);
 }
+#endif
+
+std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const std::string &filenameUtf8, uint32_t offset) {
+  return std::make_unique<MemoryMappedBuffer>(filenameUtf8.c_str(), offset);
+}
+
+std::unique_ptr<const facebook::react::JSBigString> MakeMemoryMappedBigString(const std::string &filenameUtf8) {
+  return std::make_unique<const MemoryMappedBigString>(filenameUtf8.c_str());
+}
 
 } // namespace Microsoft::JSI
@@ -3,14 +3,27 @@
 
 #pragma once
 
+#include <cxxreact/JSBigString.h>
 #include <jsi/jsi.h>
 
 #include <memory>
+#include <string>
 
 namespace Microsoft::JSI {
 
 // We only support files whose size can fit within an uint32_t. Memory
 // mapping an empty or a larger file fails.
+#ifdef _WIN32
 std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, uint32_t offset = 0);
+#endif
+
+// Same as above for a UTF-8 encoded file name. Available on all platforms.
+std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const std::string &filenameUtf8, uint32_t offset = 0);
+
+// Maps a JavaScript bundle so that it is passed to the JavaScript engine without a copy.
+// JSBigString must be null-terminated. The mapping is zero-filled up to the end of the last page, so the file
+// is copied only when its size is a multiple of the page size.
+// Fails for the same files as MakeMemoryMappedBuffer.
+std::unique_ptr<const facebook::react::JSBigString> MakeMemoryMappedBigString(const std::string &filenameUtf8);
 
 } // namespace Microsoft::JSI
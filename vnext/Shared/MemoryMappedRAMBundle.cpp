@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "MemoryMappedRAMBundle.h"
+
+#include <cxxreact/JsBundleType.h>
+#include "MemoryMappedBuffer.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+constexpr size_t HeaderSize = 3 * sizeof(uint32_t);
+
+uint32_t readUInt32(const char *data) noexcept {
+  uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+// Null-terminated part of a bundle that keeps the bundle alive.
+struct JSBigStringView final : JSBigString {
+  JSBigStringView(std::shared_ptr<const JSBigString> bundle, const char *data, size_t size) noexcept
+      : m_bundle{std::move(bundle)}, m_data{data}, m_size{size} {}
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char *c_str() const override {
+    return m_data;
+  }
+
+  size_t size() const override {
+    return m_size;
+  }
+
+ private:
+  std::shared_ptr<const JSBigString> m_bundle;
+  const char *m_data;
+  size_t m_size;
+};
+
+} // namespace
+
+MemoryMappedRAMBundle::MemoryMappedRAMBundle(std::shared_ptr<const JSBigString> bundle) : m_bundle{std::move(bundle)} {
+  if (!isIndexedRAMBundle(*m_bundle) || m_bundle->size() < HeaderSize) {
+    throw std::runtime_error("Not an indexed RAM bundle.");
+  }
+
+  const char *data = m_bundle->c_str();
+  m_moduleCount = readUInt32(data + sizeof(uint32_t));
+  m_startupCodeSize = readUInt32(data + 2 * sizeof(uint32_t));
+
+  // Checks the module table against the bundle before computing its end, which can overflow a 32-bit size_t.
+  if (m_moduleCount > (m_bundle->size() - HeaderSize) / sizeof(ModuleData)) {
+    throw std::runtime_error("Indexed RAM bundle is truncated.");
+  }
+  m_baseOffset = HeaderSize + static_cast<size_t>(m_moduleCount) * sizeof(ModuleData);
+
+  if (m_startupCodeSize == 0 || m_startupCodeSize > m_bundle->size() - m_baseOffset) {
+    throw std::runtime_error("Indexed RAM bundle is truncated.");
+  }
+}
+
+/*static*/ std::unique_ptr<MemoryMappedRAMBundle> MemoryMappedRAMBundle::fromPath(const std::string &bundlePath) {
+  return std::make_unique<MemoryMappedRAMBundle>(Microsoft::JSI::MakeMemoryMappedBigString(bundlePath));
+}
+
+/*static*/ bool MemoryMappedRAMBundle::isIndexedRAMBundle(const JSBigString &bundle) noexcept {
+  if (bundle.size() < sizeof(BundleHeader)) {
+    return false;
+  }
+
+  BundleHeader header;
+  memcpy(&header, bundle.c_str(), sizeof(header));
+  return parseTypeFromHeader(header) == ScriptTag::RAMBundle;
+}
+
+std::unique_ptr<const JSBigString> MemoryMappedRAMBundle::getStartupCode() const {
+  // The startup code size includes the null character that terminates it.
+  const char *startupCode = m_bundle->c_str() + m_baseOffset;
+  const size_t size = m_startupCodeSize - 1;
+  if (startupCode[size] != '\0') {
+    return std::make_unique<const JSBigStdString>(std::string{startupCode, size});
+  }
+
+  return std::make_unique<const JSBigStringView>(m_bundle, startupCode, size);
+}
+
+JSModulesUnbundle::Module MemoryMappedRAMBundle::getModule(uint32_t moduleId) const {
+  const ModuleData moduleData = getModuleData(moduleId);
+  if (moduleData.length == 0 || moduleData.offset > m_bundle->size() - m_baseOffset ||
+      moduleData.length > m_bundle->size() - m_baseOffset - moduleData.offset) {
+    throw ModuleNotFound(moduleId);
+  }
+
+  // Only the code of the required module is read from the file.
+  // The length includes the null character that terminates the code.
+  const char *code = m_bundle->c_str() + m_baseOffset + moduleData.offset;
+  return Module{std::to_string(moduleId) + ".js", std::string{code, moduleData.length - 1}};
+}
+
+uint32_t MemoryMappedRAMBundle::moduleCount() const noexcept {
+  return m_moduleCount;
+}
+
+MemoryMappedRAMBundle::ModuleData MemoryMappedRAMBundle::getModuleData(uint32_t moduleId) const noexcept {
+  if (moduleId >= m_moduleCount) {
+    return {0, 0};
+  }
+
+  const char *entry = m_bundle->c_str() + HeaderSize + static_cast<size_t>(moduleId) * sizeof(ModuleData);
+  return {readUInt32(entry), readUInt32(entry + sizeof(uint32_t))};
+}
+
+} // namespace react
+} // namespace facebook
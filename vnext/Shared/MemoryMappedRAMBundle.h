@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/JSModulesUnbundle.h>
+
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+// Indexed RAM bundle read in place from a memory mapped file.
+// Like JSIndexedRAMBundle, but the startup code is not copied, and only the modules required by the
+// application are read from the file.
+//
+// Format (little-endian):
+//   uint32_t magic, module count, startup code size
+//   {uint32_t offset, uint32_t length} for every module, relative to the end of this table
+//   startup code, then the code of every module, each followed by a null character
+struct MemoryMappedRAMBundle final : JSModulesUnbundle {
+  // Throws std::runtime_error if the bundle is not a valid indexed RAM bundle.
+  MemoryMappedRAMBundle(std::shared_ptr<const JSBigString> bundle);
+
+  // Throws facebook::jsi::JSINativeException if the file cannot be mapped.
+  static std::unique_ptr<MemoryMappedRAMBundle> fromPath(const std::string &bundlePath);
+
+  static bool isIndexedRAMBundle(const JSBigString &bundle) noexcept;
+
+  std::unique_ptr<const JSBigString> getStartupCode() const;
+
+  // Throws ModuleNotFound for an invalid module ID.
+  Module getModule(uint32_t moduleId) const override;
+
+  uint32_t moduleCount() const noexcept;
+
+ private:
+  struct ModuleData {
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  ModuleData getModuleData(uint32_t moduleId) const noexcept;
+
+  std::shared_ptr<const JSBigString> m_bundle;
+  uint32_t m_moduleCount{0};
+  uint32_t m_startupCodeSize{0};
+  size_t m_baseOffset{0};
+};
+
+} // namespace react
+} // namespace facebook
@@ -6,7 +6,10 @@
 #include "AsyncStorageModuleWin32.h"
 #include "AsyncStorageModuleWin32Config.h"
 
+#include <AsyncStorage/JsonMerge.h>
+
 #include <cstdio>
+#include <map>
 
 /// Implements AsyncStorageModule using winsqlite3.dll (requires Windows version 10.0.10586)
 
@@ -102,60 +105,46 @@ bool CheckArgs(sqlite3 *db, folly::dynamic &args, const CxxModule::Callback &cal
   return true;
 }
 
-// RAII object to manage SQLite transaction. On destruction, if
-// Commit() has not been called, rolls back the transactions
-// The provided sqlite connection handle & Callback must outlive
-// the Sqlite3Transaction object
-class Sqlite3Transaction final {
+// RAII object scoping one task inside the batch transaction, so that a failing
+// task only undoes its own changes. On destruction, if Release() has not been
+// called, rolls back to the savepoint. The error that caused the rollback has
+// already been reported, so a failing rollback is not reported again.
+// The provided sqlite connection handle & Callback must outlive the
+// Sqlite3Savepoint object
+class Sqlite3Savepoint final {
   sqlite3 *m_db{nullptr};
   const CxxModule::Callback *m_callback{nullptr};
 
  public:
-  Sqlite3Transaction() = default;
-  Sqlite3Transaction(sqlite3 *db, const CxxModule::Callback &callback) : m_db(db), m_callback(&callback) {
-    if (!Exec(m_db, *m_callback, "BEGIN TRANSACTION")) {
+  Sqlite3Savepoint(sqlite3 *db, const CxxModule::Callback &callback) : m_db(db), m_callback(&callback) {
+    if (!Exec(m_db, *m_callback, "SAVEPOINT task")) {
       m_db = nullptr;
       m_callback = nullptr;
     }
   }
-  Sqlite3Transaction(const Sqlite3Transaction &) = delete;
-  Sqlite3Transaction(Sqlite3Transaction &&other) noexcept : m_db(other.m_db), m_callback(other.m_callback) {
-    other.m_db = nullptr;
-    other.m_callback = nullptr;
-  }
-  Sqlite3Transaction &operator=(const Sqlite3Transaction &) = delete;
-  Sqlite3Transaction &operator=(Sqlite3Transaction &&rhs) noexcept {
-    if (this != &rhs) {
-      Commit();
-      std::swap(m_db, rhs.m_db);
-      std::swap(m_callback, rhs.m_callback);
-    }
-  }
+  Sqlite3Savepoint(const Sqlite3Savepoint &) = delete;
+  Sqlite3Savepoint &operator=(const Sqlite3Savepoint &) = delete;
 
   explicit operator bool() const {
     return m_db != nullptr;
   }
 
-  void Rollback() {
-    if (m_db) {
-      Exec(m_db, *m_callback, "ROLLBACK");
-      m_db = nullptr;
-      m_callback = nullptr;
-    }
-  }
-
-  bool Commit() {
+  bool Release() {
     if (!m_db) {
       return false;
     }
-    auto result = Exec(m_db, *m_callback, "COMMIT");
-    m_db = nullptr;
-    m_callback = nullptr;
+    auto result = Exec(m_db, *m_callback, "RELEASE task");
+    if (result) {
+      m_db = nullptr;
+      m_callback = nullptr;
+    }
     return result;
   }
 
-  ~Sqlite3Transaction() {
-    Rollback();
+  ~Sqlite3Savepoint() {
+    if (m_db) {
+      sqlite3_exec(m_db, "ROLLBACK TO task; RELEASE task", nullptr, nullptr, nullptr);
+    }
   }
 };
 
@@ -185,6 +174,10 @@ bool CheckSQLiteResult(sqlite3 *db, const CxxModule::Callback &callback, int sql
 
 using Statement = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>;
 
+// A statement borrowed from the StatementCache. Resets it when going out of
+// scope so that it does not hold on to a read transaction.
+using CachedStatement = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_reset)>;
+
 // Creates a prepared SQLite statement. On error, returns nullptr
 Statement PrepareStatement(sqlite3 *db, const CxxModule::Callback &callback, const char *stmt) {
   sqlite3_stmt *pStmt{nullptr};
@@ -198,7 +191,7 @@ Statement PrepareStatement(sqlite3 *db, const CxxModule::Callback &callback, con
 bool BindString(
     sqlite3 *db,
     const CxxModule::Callback &callback,
-    const Statement &stmt,
+    const CachedStatement &stmt,
     int index,
     const std::string &str) {
   return CheckSQLiteResult(db, callback, sqlite3_bind_text(stmt.get(), index, str.c_str(), -1, SQLITE_TRANSIENT));
@@ -209,7 +202,57 @@ bool BindString(
 namespace facebook {
 namespace react {
 
-AsyncStorageModuleWin32::AsyncStorageModuleWin32() {
+// Prepared statements reused across tasks instead of being prepared and
+// finalized for every call.
+// Statements taking a list of keys are cached per arity. The arity is rounded
+// up to a power of two so that only a handful of them ever exist; the extra
+// variables are left bound to NULL, which matches no key.
+class AsyncStorageModuleWin32::StatementCache {
+ public:
+  enum class Kind { multiGet, multiSet, multiRemove };
+
+  // On error, reports it to the callback and returns nullptr.
+  CachedStatement Get(sqlite3 *db, const CxxModule::Callback &callback, Kind kind, int argCount) {
+    const int arity = kind == Kind::multiSet ? 2 : RoundUpArity(db, argCount);
+
+    auto it = m_statements.find({kind, arity});
+    if (it == m_statements.end()) {
+      auto pStmt = PrepareStatement(db, callback, MakeStatement(kind, arity).c_str());
+      if (!pStmt) {
+        return {nullptr, &sqlite3_reset};
+      }
+      it = m_statements.emplace(std::make_pair(kind, arity), std::move(pStmt)).first;
+    }
+
+    sqlite3_clear_bindings(it->second.get());
+    return {it->second.get(), &sqlite3_reset};
+  }
+
+ private:
+  static int RoundUpArity(sqlite3 *db, int argCount) {
+    const int varLimit = sqlite3_limit(db, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+    int arity = 1;
+    while (arity < argCount && arity <= varLimit / 2) {
+      arity *= 2;
+    }
+    return arity < argCount ? varLimit : arity;
+  }
+
+  static std::string MakeStatement(Kind kind, int arity) {
+    switch (kind) {
+      case Kind::multiGet:
+        return MakeSQLiteParameterizedStatement("SELECT key, value FROM AsyncLocalStorage WHERE key IN ", arity);
+      case Kind::multiRemove:
+        return MakeSQLiteParameterizedStatement("DELETE FROM AsyncLocalStorage WHERE key IN ", arity);
+      default:
+        return "INSERT OR REPLACE INTO AsyncLocalStorage VALUES(?, ?)";
+    }
+  }
+
+  std::map<std::pair<Kind, int>, Statement> m_statements;
+};
+
+AsyncStorageModuleWin32::AsyncStorageModuleWin32() : m_statements{std::make_unique<StatementCache>()} {
   if (sqlite3_open_v2(
           AsyncStorageDBPath().c_str(),
           &m_db,
@@ -252,6 +295,8 @@ AsyncStorageModuleWin32::~AsyncStorageModuleWin32() {
       m_cv.wait(m_lock, [this]() { return m_action == nullptr; });
     }
   }
+  // Cached statements must be finalized before the connection can be closed.
+  m_statements.reset();
   sqlite3_close(m_db);
 }
 
@@ -267,6 +312,7 @@ std::vector<CxxModule::Method> AsyncStorageModuleWin32::getMethods() {
   return {
       Method("multiGet", this, &AsyncStorageModuleWin32::multiGet),
       Method("multiSet", this, &AsyncStorageModuleWin32::multiSet),
+      Method("multiMerge", this, &AsyncStorageModuleWin32::multiMerge),
       Method("multiRemove", this, &AsyncStorageModuleWin32::multiRemove),
       Method("clear", this, &AsyncStorageModuleWin32::clear),
       Method("getAllKeys", this, &AsyncStorageModuleWin32::getAllKeys)};
@@ -288,6 +334,14 @@ void AsyncStorageModuleWin32::multiSet(folly::dynamic args, Callback jsCallback)
   }
   AddTask(DBTask::Type::multiSet, std::move(kvps), std::move(jsCallback));
 }
+void AsyncStorageModuleWin32::multiMerge(folly::dynamic args, Callback jsCallback) {
+  auto &kvps = args[0];
+  if (kvps.size() == 0) {
+    jsCallback({});
+    return;
+  }
+  AddTask(DBTask::Type::multiMerge, std::move(kvps), std::move(jsCallback));
+}
 void AsyncStorageModuleWin32::multiRemove(folly::dynamic args, Callback jsCallback) {
   auto &keys = args[0];
   if (keys.size() == 0) {
@@ -316,7 +370,8 @@ void AsyncStorageModuleWin32::AddTask(
 }
 
 // On a background thread, while the async task  has not been cancelled and
-// there are more tasks to do, run the tasks. When there are either no more
+// there are more tasks to do, run the tasks. All tasks that piled up while the
+// previous batch was running are run as one batch, see RunBatch. When there are either no more
 // tasks or cancellation has been requested, set m_action to null to report
 // that and complete the coroutine. N.B., it is important that detecting that
 // m_tasks is empty and acknowledging completion is done atomically; otherwise
@@ -327,7 +382,6 @@ winrt::Windows::Foundation::IAsyncAction AsyncStorageModuleWin32::RunTasks() {
   co_await winrt::resume_background();
   while (!cancellationToken()) {
     decltype(m_tasks) tasks;
-    sqlite3 *db{nullptr};
     {
       winrt::slim_lock_guard guard(m_lock);
       if (m_tasks.empty()) {
@@ -336,136 +390,230 @@ winrt::Windows::Foundation::IAsyncAction AsyncStorageModuleWin32::RunTasks() {
         co_return;
       }
       std::swap(tasks, m_tasks);
-      db = m_db;
     }
 
-    for (auto &task : tasks) {
-      task(db);
-      if (cancellationToken())
-        break;
-    }
+    RunBatch(tasks, [&cancellationToken]() { return cancellationToken(); });
   }
   winrt::slim_lock_guard guard(m_lock);
   m_action = nullptr;
   m_cv.notify_all();
 }
 
-void AsyncStorageModuleWin32::DBTask::operator()(sqlite3 *db) {
+// Runs a batch of tasks in a single transaction so that they share one commit
+// (and one fsync) instead of paying for one each. Every task runs inside its
+// own savepoint, so a failing task only rolls back its own changes and only
+// its own callback gets the error. Results of the other tasks are delivered
+// once the transaction has committed.
+void AsyncStorageModuleWin32::RunBatch(std::vector<DBTask> &tasks, const std::function<bool()> &isCancelled) {
+  // Tasks waiting on the outcome of the batch transaction. Errors affecting
+  // the whole batch are reported to them, but not to tasks that already
+  // reported their own error.
+  std::vector<DBTask *> pending;
+  pending.reserve(tasks.size());
+  Callback batchCallback = [&pending](std::vector<folly::dynamic> error) {
+    for (auto *task : pending) {
+      task->GetCallback()(error);
+    }
+    pending.clear();
+  };
+
+  for (auto &task : tasks) {
+    pending.push_back(&task);
+  }
+  if (!Exec(m_db, batchCallback, "BEGIN TRANSACTION")) {
+    return;
+  }
+  pending.clear();
+
+  for (auto &task : tasks) {
+    if (isCancelled())
+      break;
+
+    Sqlite3Savepoint savepoint(m_db, task.GetCallback());
+    if (savepoint && task(m_db, *m_statements) && savepoint.Release()) {
+      pending.push_back(&task);
+    }
+  }
+
+  if (!Exec(m_db, batchCallback, "COMMIT")) {
+    sqlite3_exec(m_db, "ROLLBACK", nullptr, nullptr, nullptr);
+    return;
+  }
+
+  for (auto *task : pending) {
+    task->Complete();
+  }
+}
+
+bool AsyncStorageModuleWin32::DBTask::operator()(sqlite3 *db, StatementCache &statements) {
   switch (m_type) {
     case Type::multiGet:
-      multiGet(db);
-      break;
+      return multiGet(db, statements);
     case Type::multiSet:
-      multiSet(db);
-      break;
+      return multiSet(db, statements);
+    case Type::multiMerge:
+      return multiMerge(db, statements);
     case Type::multiRemove:
-      multiRemove(db);
-      break;
+      return multiRemove(db, statements);
     case Type::clear:
-      clear(db);
-      break;
+      return clear(db);
     case Type::getAllKeys:
-      getAllKeys(db);
-      break;
+      return getAllKeys(db);
   }
+  return false;
 }
 
-void AsyncStorageModuleWin32::DBTask::multiGet(sqlite3 *db) {
+void AsyncStorageModuleWin32::DBTask::Complete() {
+  m_callback(std::move(m_result));
+}
+
+bool AsyncStorageModuleWin32::DBTask::multiGet(sqlite3 *db, StatementCache &statements) {
   folly::dynamic result = folly::dynamic::array;
   if (!CheckArgs(db, m_args, m_callback)) {
-    return;
+    return false;
   }
 
   auto argCount = static_cast<int>(m_args.size());
-  auto sql = MakeSQLiteParameterizedStatement("SELECT key, value FROM AsyncLocalStorage WHERE key IN ", argCount);
-  auto pStmt = PrepareStatement(db, m_callback, sql.data());
+  auto pStmt = statements.Get(db, m_callback, StatementCache::Kind::multiGet, argCount);
   if (!pStmt) {
-    return;
+    return false;
   }
   for (int i = 0; i < argCount; i++) {
     if (!BindString(db, m_callback, pStmt, i + 1, m_args[i].getString()))
-      return;
+      return false;
   }
   for (auto stepResult = sqlite3_step(pStmt.get()); stepResult != SQLITE_DONE; stepResult = sqlite3_step(pStmt.get())) {
     if (stepResult != SQLITE_ROW) {
       InvokeError(m_callback, sqlite3_errmsg(db));
-      return;
+      return false;
     }
 
     auto key = reinterpret_cast<const char *>(sqlite3_column_text(pStmt.get(), 0));
     if (!key) {
       InvokeError(m_callback, sqlite3_errmsg(db));
-      return;
+      return false;
     }
     auto value = reinterpret_cast<const char *>(sqlite3_column_text(pStmt.get(), 1));
     if (!value) {
       InvokeError(m_callback, sqlite3_errmsg(db));
-      return;
+      return false;
     }
     result.push_back(folly::dynamic::array(key, value));
   }
-  m_callback({{}, result});
+  m_result = {{}, std::move(result)};
+  return true;
 }
 
-void AsyncStorageModuleWin32::DBTask::multiSet(sqlite3 *db) {
-  Sqlite3Transaction transaction(db, m_callback);
-  if (!transaction) {
-    return;
-  }
-  auto pStmt = PrepareStatement(db, m_callback, "INSERT OR REPLACE INTO AsyncLocalStorage VALUES(?, ?)");
+// Runs inside the savepoint set up by RunBatch, which makes it atomic.
+bool AsyncStorageModuleWin32::DBTask::multiSet(sqlite3 *db, StatementCache &statements) {
+  auto pStmt = statements.Get(db, m_callback, StatementCache::Kind::multiSet, 2);
   if (!pStmt) {
-    return;
+    return false;
   }
   for (auto &&arg : m_args) {
     if (!BindString(db, m_callback, pStmt, 1, arg[0].getString()) ||
         !BindString(db, m_callback, pStmt, 2, arg[1].getString())) {
-      return;
+      return false;
     }
     auto rc = sqlite3_step(pStmt.get());
     if (rc != SQLITE_DONE && !CheckSQLiteResult(db, m_callback, rc)) {
-      return;
+      return false;
     }
     if (!CheckSQLiteResult(db, m_callback, sqlite3_reset(pStmt.get()))) {
-      return;
+      return false;
     }
   }
-  if (!transaction.Commit()) {
-    return;
+  m_result = {};
+  return true;
+}
+
+// Reads each stored value, merges the patch into it and writes it back, all
+// inside the savepoint set up by RunBatch. Values are parsed and serialized
+// once per key instead of round-tripping through JS.
+bool AsyncStorageModuleWin32::DBTask::multiMerge(sqlite3 *db, StatementCache &statements) {
+  for (auto &&arg : m_args) {
+    const auto &key = arg[0].getString();
+    std::string value = arg[1].getString();
+
+    {
+      auto pGetStmt = statements.Get(db, m_callback, StatementCache::Kind::multiGet, 1);
+      if (!pGetStmt || !BindString(db, m_callback, pGetStmt, 1, key)) {
+        return false;
+      }
+      auto rc = sqlite3_step(pGetStmt.get());
+      if (rc == SQLITE_ROW) {
+        auto storedValue = reinterpret_cast<const char *>(sqlite3_column_text(pGetStmt.get(), 1));
+        if (!storedValue) {
+          InvokeError(m_callback, sqlite3_errmsg(db));
+          return false;
+        }
+        try {
+          value = JsonMerge::mergeJson(storedValue, value);
+        } catch (const std::exception &e) {
+          InvokeError(m_callback, e.what());
+          return false;
+        }
+      } else if (rc == SQLITE_DONE) {
+        // The patch is stored as is, but must still be an object like any merged value.
+        try {
+          JsonMerge::validateObject(value);
+        } catch (const std::exception &e) {
+          InvokeError(m_callback, e.what());
+          return false;
+        }
+      } else {
+        InvokeError(m_callback, sqlite3_errmsg(db));
+        return false;
+      }
+    }
+
+    auto pSetStmt = statements.Get(db, m_callback, StatementCache::Kind::multiSet, 2);
+    if (!pSetStmt || !BindString(db, m_callback, pSetStmt, 1, key) ||
+        !BindString(db, m_callback, pSetStmt, 2, value)) {
+      return false;
+    }
+    auto rc = sqlite3_step(pSetStmt.get());
+    if (rc != SQLITE_DONE && !CheckSQLiteResult(db, m_callback, rc)) {
+      return false;
+    }
   }
-  m_callback({});
+  m_result = {};
+  return true;
 }
 
-void AsyncStorageModuleWin32::DBTask::multiRemove(sqlite3 *db) {
+bool AsyncStorageModuleWin32::DBTask::multiRemove(sqlite3 *db, StatementCache &statements) {
   if (!CheckArgs(db, m_args, m_callback)) {
-    return;
+    return false;
   }
 
   auto argCount = static_cast<int>(m_args.size());
-  auto sql = MakeSQLiteParameterizedStatement("DELETE FROM AsyncLocalStorage WHERE key IN ", argCount);
-  auto pStmt = PrepareStatement(db, m_callback, sql.data());
+  auto pStmt = statements.Get(db, m_callback, StatementCache::Kind::multiRemove, argCount);
   if (!pStmt) {
-    return;
+    return false;
   }
   for (int i = 0; i < argCount; i++) {
     if (!BindString(db, m_callback, pStmt, i + 1, m_args[i].getString()))
-      return;
+      return false;
   }
   for (auto stepResult = sqlite3_step(pStmt.get()); stepResult != SQLITE_DONE; stepResult = sqlite3_step(pStmt.get())) {
     if (stepResult != SQLITE_ROW) {
       InvokeError(m_callback, sqlite3_errmsg(db));
-      return;
+      return false;
     }
   }
-  m_callback({});
+  m_result = {};
+  return true;
 }
 
-void AsyncStorageModuleWin32::DBTask::clear(sqlite3 *db) {
-  if (Exec(db, m_callback, "DELETE FROM AsyncLocalStorage")) {
-    m_callback({});
+bool AsyncStorageModuleWin32::DBTask::clear(sqlite3 *db) {
+  if (!Exec(db, m_callback, "DELETE FROM AsyncLocalStorage")) {
+    return false;
   }
+  m_result = {};
+  return true;
 }
 
-void AsyncStorageModuleWin32::DBTask::getAllKeys(sqlite3 *db) {
+bool AsyncStorageModuleWin32::DBTask::getAllKeys(sqlite3 *db) {
   folly::dynamic result = folly::dynamic::array;
   auto getAllKeysCallback = [&](int cCol, char **rgszColText, char **) {
     if (cCol >= 1) {
@@ -474,9 +622,11 @@ void AsyncStorageModuleWin32::DBTask::getAllKeys(sqlite3 *db) {
     return SQLITE_OK;
   };
 
-  if (Exec(db, m_callback, "SELECT key FROM AsyncLocalStorage", getAllKeysCallback)) {
-    m_callback({{}, result});
+  if (!Exec(db, m_callback, "SELECT key FROM AsyncLocalStorage", getAllKeysCallback)) {
+    return false;
   }
+  m_result = {{}, std::move(result)};
+  return true;
 }
 
 } // namespace react
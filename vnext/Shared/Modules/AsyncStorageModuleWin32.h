@@ -10,6 +10,7 @@
 
 #include <winrt/Windows.Foundation.h>
 #include <winsqlite/winsqlite3.h>
+#include <functional>
 #include <memory>
 
 namespace facebook {
@@ -24,27 +25,39 @@ class AsyncStorageModuleWin32 : public facebook::xplat::module::CxxModule {
   std::vector<facebook::xplat::module::CxxModule::Method> getMethods() override;
 
  private:
+  class StatementCache;
+
   class DBTask {
    public:
-    enum class Type { multiGet, multiSet, multiRemove, clear, getAllKeys };
+    enum class Type { multiGet, multiSet, multiMerge, multiRemove, clear, getAllKeys };
     DBTask(Type type, folly::dynamic &&args, Callback &&callback)
         : m_type{type}, m_args{std::move(args)}, m_callback{std::move(callback)} {}
     DBTask(const DBTask &) = delete;
     DBTask(DBTask &&) = default;
     DBTask &operator=(const DBTask &) = delete;
     DBTask &operator=(DBTask &&) = default;
-    void operator()(sqlite3 *db);
+
+    // Runs the task. On failure the error has already been reported to the
+    // callback and false is returned. On success the result is held back
+    // until Complete() is called, once the batch transaction has committed.
+    bool operator()(sqlite3 *db, StatementCache &statements);
+    void Complete();
+    const Callback &GetCallback() const {
+      return m_callback;
+    }
 
    private:
     Type m_type;
     folly::dynamic m_args;
     Callback m_callback;
+    std::vector<folly::dynamic> m_result;
 
-    void multiGet(sqlite3 *db);
-    void multiSet(sqlite3 *db);
-    void multiRemove(sqlite3 *db);
-    void clear(sqlite3 *db);
-    void getAllKeys(sqlite3 *db);
+    bool multiGet(sqlite3 *db, StatementCache &statements);
+    bool multiSet(sqlite3 *db, StatementCache &statements);
+    bool multiMerge(sqlite3 *db, StatementCache &statements);
+    bool multiRemove(sqlite3 *db, StatementCache &statements);
+    bool clear(sqlite3 *db);
+    bool getAllKeys(sqlite3 *db);
   };
   winrt::slim_mutex m_lock;
   winrt::slim_condition_variable m_cv;
@@ -52,10 +65,15 @@ class AsyncStorageModuleWin32 : public facebook::xplat::module::CxxModule {
   std::vector<DBTask> m_tasks;
   sqlite3 *m_db;
 
+  // Only used from RunTasks, so it needs no synchronization.
+  std::unique_ptr<StatementCache> m_statements;
+
   // params - array<std::string> Keys , Callback(error, returnValue)
   void multiGet(folly::dynamic args, Callback jsCallback);
   // params - array<array<std::string>> KeyValuePairs , Callback(error)
   void multiSet(folly::dynamic args, Callback jsCallback);
+  // params - array<array<std::string>> KeyValuePairs , Callback(error)
+  void multiMerge(folly::dynamic args, Callback jsCallback);
   // params - array<std::string> Keys , Callback(error)
   void multiRemove(folly::dynamic args, Callback jsCallback);
   // params - args is unused, Callback(error)
@@ -68,6 +86,7 @@ class AsyncStorageModuleWin32 : public facebook::xplat::module::CxxModule {
     AddTask(type, folly::dynamic{}, std::move(jsCallback));
   }
   winrt::Windows::Foundation::IAsyncAction RunTasks();
+  void RunBatch(std::vector<DBTask> &tasks, const std::function<bool()> &isCancelled);
 
   static std::string m_dbPath;
 };
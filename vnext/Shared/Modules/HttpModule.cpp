@@ -34,6 +34,7 @@ constexpr char moduleName[] = "Networking";
 constexpr char completedResponse[] = "didCompleteNetworkResponse";
 constexpr char receivedResponse[] = "didReceiveNetworkResponse";
 constexpr char receivedData[] = "didReceiveNetworkData";
+constexpr char receivedIncrementalData[] = "didReceiveNetworkIncrementalData";
 constexpr char receivedDataProgress[] = "didReceiveNetworkDataProgress";
 
 static void SetUpHttpResource(
@@ -72,6 +73,17 @@ static void SetUpHttpResource(
   };
   resource->SetOnData(std::move(onDataDynamic));
 
+  resource->SetOnIncrementalData(
+      [weakReactInstance](int64_t requestId, string &&responseData, int64_t progress, int64_t total) {
+        dynamic args = dynamic::array(requestId, std::move(responseData), progress, total);
+
+        SendEvent(weakReactInstance, receivedIncrementalData, std::move(args));
+      });
+
+  resource->SetOnDataProgress([weakReactInstance](int64_t requestId, int64_t progress, int64_t total) {
+    SendEvent(weakReactInstance, receivedDataProgress, dynamic::array(requestId, progress, total));
+  });
+
   resource->SetOnError([weakReactInstance](int64_t requestId, string &&message, bool isTimeout) {
     dynamic args = dynamic::array(requestId, std::move(message));
     if (isTimeout) {
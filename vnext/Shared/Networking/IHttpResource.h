@@ -68,6 +68,8 @@ struct IHttpResource {
   /// </param>
   /// <param name="useIncrementalUpdates">
   /// Response body to be retrieved in several iterations.
+  /// Text responses are passed to the incremental data handler as they arrive.
+  /// Other responses report their progress to the data progress handler before the full data is passed.
   /// </param>
   /// <param name="timeout">
   /// Request timeout in miliseconds.
@@ -95,6 +97,20 @@ struct IHttpResource {
   virtual void SetOnResponse(std::function<void(int64_t requestId, Response &&response)> &&handler) noexcept = 0;
   virtual void SetOnData(std::function<void(int64_t requestId, std::string &&responseData)> &&handler) noexcept = 0;
   virtual void SetOnData(std::function<void(int64_t requestId, folly::dynamic &&responseData)> &&handler) noexcept = 0;
+
+  /// <param name="handler">
+  /// Receives each decoded text segment of a request sent with incremental updates.
+  /// progress is the number of bytes received so far. total is the content length, or -1 if it is unknown.
+  /// </param>
+  virtual void SetOnIncrementalData(
+      std::function<void(int64_t requestId, std::string &&responseData, int64_t progress, int64_t total)>
+          &&handler) noexcept = 0;
+
+  /// <param name="handler">
+  /// Receives the download progress of a non-text request sent with incremental updates.
+  /// </param>
+  virtual void SetOnDataProgress(
+      std::function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept = 0;
   virtual void SetOnError(
       std::function<void(int64_t requestId, std::string &&errorMessage, bool isTimeout)> &&handler) noexcept = 0;
 };
@@ -12,8 +12,10 @@
 #include <boost/lexical_cast/try_lexical_convert.hpp>
 
 // Standard Library
+#include <algorithm>
 #include <queue>
 #include <regex>
+#include <vector>
 
 using std::set;
 using std::wstring;
@@ -262,25 +264,38 @@ bool OriginPolicyHttpFilter::ConstWcharComparer::operator()(const wchar_t *a, co
       c == 0x3f || c == 0x40 || c == 0x5b || c == 0x5c || c == 0x5d || c == 0x7b || c == 0x7d || c == 0x7f;
 }
 
-/*static*/ set<const wchar_t *> OriginPolicyHttpFilter::CorsUnsafeNotForbiddenRequestHeaderNames(
-    HttpRequestHeaderCollection const &headers) noexcept {
+/*static*/ set<wstring> OriginPolicyHttpFilter::CorsUnsafeNotForbiddenRequestHeaderNames(
+    HttpRequestMessage const &request) noexcept {
   constexpr size_t maxSafelistValueSize = 1024;
   size_t safelistValueSize = 0;
-  std::vector<const wchar_t *> potentiallyUnsafeNames;
-  set<const wchar_t *> result;
-  for (const auto &header : headers) {
-    const auto headerName = header.Key().c_str();
-
+  std::vector<wstring> potentiallyUnsafeNames;
+  set<wstring> result;
+  auto addHeader = [&](hstring const &name, hstring const &value) {
     // If header is not safe
-    if (boost::istarts_with(headerName, L"Proxy-") || boost::istarts_with(headerName, L"Sec-") ||
-        s_corsForbiddenRequestHeaderNames.find(headerName) != s_corsForbiddenRequestHeaderNames.cend())
-      continue;
-
-    if (!IsCorsSafelistedRequestHeader(header.Key(), header.Value())) {
-      result.emplace(header.Key().c_str());
+    auto nameView = std::wstring_view{name};
+    if (boost::istarts_with(nameView, L"Proxy-") || boost::istarts_with(nameView, L"Sec-") ||
+        s_corsForbiddenRequestHeaderNames.find(name.c_str()) != s_corsForbiddenRequestHeaderNames.cend())
+      return;
+
+    auto nameLower = boost::to_lower_copy(wstring{name});
+    if (!IsCorsSafelistedRequestHeader(name, value)) {
+      result.emplace(std::move(nameLower));
     } else {
-      potentiallyUnsafeNames.emplace_back(std::wstring_view{header.Key()}.data());
-      safelistValueSize += header.Value().size();
+      potentiallyUnsafeNames.emplace_back(std::move(nameLower));
+      safelistValueSize += value.size();
+    }
+  };
+
+  for (const auto &header : request.Headers()) {
+    addHeader(header.Key(), header.Value());
+  }
+
+  // WinRT separates request headers from request content headers
+  if (auto content = request.Content()) {
+    for (const auto &header : content.Headers()) {
+      // WinRT automatically appends Content-Length, which script cannot set. Skip it.
+      if (!boost::iequals(header.Key(), L"Content-Length"))
+        addHeader(header.Key(), header.Value());
     }
   }
 
@@ -290,6 +305,34 @@ bool OriginPolicyHttpFilter::ConstWcharComparer::operator()(const wchar_t *a, co
   return result;
 }
 
+// See https://fetch.spec.whatwg.org/#cors-preflight-fetch, section 4.8.7.5
+/*static*/ bool OriginPolicyHttpFilter::IsPreflightMethodAllowed(
+    hstring const &method,
+    set<wstring> const &allowedMethods,
+    bool withCredentials) noexcept {
+  // Preflight should always allow simple CORS methods
+  if (s_simpleCorsMethods.find(method.c_str()) != s_simpleCorsMethods.cend())
+    return true;
+
+  if (!withCredentials && allowedMethods.find(L"*") != allowedMethods.cend())
+    return true;
+
+  return allowedMethods.find(boost::to_lower_copy(wstring{method})) != allowedMethods.cend();
+}
+
+// See https://fetch.spec.whatwg.org/#cors-preflight-fetch, section 4.8.7.6-7
+/*static*/ bool OriginPolicyHttpFilter::IsPreflightHeaderAllowed(
+    wstring const &name,
+    set<wstring> const &allowedHeaders,
+    bool withCredentials) noexcept {
+  if (allowedHeaders.find(name) != allowedHeaders.cend())
+    return true;
+
+  // Allow through wildcard only if the request does not have credentials.
+  // "Authorization" is the only member of https://fetch.spec.whatwg.org/#cors-non-wildcard-request-header-name.
+  return !withCredentials && name != L"authorization" && allowedHeaders.find(L"*") != allowedHeaders.cend();
+}
+
 /*static*/ OriginPolicyHttpFilter::AccessControlValues OriginPolicyHttpFilter::ExtractAccessControlValues(
     winrt::Windows::Foundation::Collections::IMap<hstring, hstring> const &headers) {
   using std::wregex;
@@ -334,13 +377,27 @@ bool OriginPolicyHttpFilter::ConstWcharComparer::operator()(const wchar_t *a, co
     } else if (boost::iequals(header.Key(), L"Access-Control-Allow-Credentials")) {
       result.AllowedCredentials = header.Value();
     } else if (boost::iequals(header.Key(), L"Access-Control-Max-Age")) {
-      result.MaxAge = _wtoi(header.Value().c_str());
+      // Negative or invalid values disable caching.
+      auto maxAge = std::chrono::seconds{std::max(_wtoi(header.Value().c_str()), 0)};
+      result.MaxAge = std::min(maxAge, s_maxPreflightMaxAge);
     }
   }
 
   return result;
 } // ExtractAccessControlValues
 
+/*static*/ wstring OriginPolicyHttpFilter::GetPreflightCacheKey(HttpRequestMessage const &request) {
+  // Methods and headers are matched against the cached allow-lists instead of being part of the key.
+  bool withCredentials = request.Properties().Lookup(L"RequestArgs").as<RequestArgs>()->WithCredentials;
+
+  auto key = wstring{s_origin.AbsoluteCanonicalUri()};
+  key += L'\n';
+  key += request.RequestUri().AbsoluteCanonicalUri();
+  key += withCredentials ? L"\ninclude" : L"\nomit";
+
+  return key;
+}
+
 /*static*/ void OriginPolicyHttpFilter::RemoveHttpOnlyCookiesFromResponseHeaders(
     HttpResponseMessage const &response,
     bool removeAll) {
@@ -516,60 +573,89 @@ void OriginPolicyHttpFilter::ValidatePreflightResponse(
   // CORS preflight should always exclude credentials although the subsequent CORS request may include credentials.
   ValidateAllowOrigin(controlValues.AllowedOrigin, controlValues.AllowedCredentials, props);
 
-  // See https://fetch.spec.whatwg.org/#cors-preflight-fetch, section 4.8.7.5
-  // Check if the request method is allowed
-  bool withCredentials = props.Lookup(L"RequestArgs").as<RequestArgs>()->WithCredentials;
-  bool requestMethodAllowed = false;
-  for (const auto &method : controlValues.AllowedMethods) {
-    if (L"*" == method) {
-      if (!withCredentials) {
-        requestMethodAllowed = true;
-        break;
-      }
-    } else if (boost::iequals(method, request.Method().ToString())) {
-      requestMethodAllowed = true;
-      break;
+  auto toLower = [](const set<wstring> &values) {
+    set<wstring> result;
+    for (const auto &value : values) {
+      result.emplace(boost::to_lower_copy(value));
     }
-  }
-
-  // Preflight should always allow simple CORS methods
-  requestMethodAllowed |= s_simpleCorsMethods.find(request.Method().ToString().c_str()) != s_simpleCorsMethods.cend();
+    return result;
+  };
+  auto allowedMethods = toLower(controlValues.AllowedMethods);
+  auto allowedHeaders = toLower(controlValues.AllowedHeaders);
 
-  if (!requestMethodAllowed)
+  // Check if the request method is allowed
+  bool withCredentials = props.Lookup(L"RequestArgs").as<RequestArgs>()->WithCredentials;
+  if (!IsPreflightMethodAllowed(request.Method().ToString(), allowedMethods, withCredentials))
     throw hresult_error{
         E_INVALIDARG,
         L"Method [" + request.Method().ToString() +
             L"] is not allowed by Access-Control-Allow-Methods in preflight response"};
 
   // Check if request headers are allowed
-  // See https://fetch.spec.whatwg.org/#cors-preflight-fetch, section 4.8.7.6-7
-  // Check if the header should be allowed through wildcard, if the request does not have credentials.
-  bool requestHeadersAllowed = false;
-  if (!withCredentials && controlValues.AllowedHeaders.find(L"*") != controlValues.AllowedHeaders.cend()) {
-    // "Authorization" header cannot be allowed through wildcard alone.
-    // "Authorization" is the only member of https://fetch.spec.whatwg.org/#cors-non-wildcard-request-header-name.
-    if (request.Headers().HasKey(L"Authorization") &&
-        controlValues.AllowedHeaders.find(L"Authorization") == controlValues.AllowedHeaders.cend())
+  // Forbidden headers are excluded from the JavaScript layer.
+  // User agents may use these headers internally.
+  for (const auto &name : CorsUnsafeNotForbiddenRequestHeaderNames(request)) {
+    if (!IsPreflightHeaderAllowed(name, allowedHeaders, withCredentials))
       throw hresult_error{
           E_INVALIDARG,
-          L"Request header field [Authorization] is not allowed by Access-Control-Allow-Headers in preflight response"};
+          L"Request header field [" + to_hstring(name) +
+              L"] is not allowed by Access-Control-Allow-Headers in preflight response"};
+  }
 
-    requestHeadersAllowed = true;
+  CachePreflight(request, std::move(allowedMethods), std::move(allowedHeaders), controlValues.MaxAge);
+}
+
+bool OriginPolicyHttpFilter::IsPreflightCached(HttpRequestMessage const &request) const {
+  auto key = GetPreflightCacheKey(request);
+  bool withCredentials = request.Properties().Lookup(L"RequestArgs").as<RequestArgs>()->WithCredentials;
+
+  // Header values decide which names are CORS-unsafe, so recompute them for every request.
+  auto unsafeHeaderNames = CorsUnsafeNotForbiddenRequestHeaderNames(request);
+
+  std::scoped_lock lock{m_preflightCacheMutex};
+  auto entry = m_preflightCache.find(key);
+  if (entry == m_preflightCache.cend())
+    return false;
+
+  if (entry->second.Expiry <= std::chrono::steady_clock::now()) {
+    m_preflightCache.erase(entry);
+    return false;
   }
-  if (!requestHeadersAllowed) {
-    // Forbidden headers are excluded from the JavaScript layer.
-    // User agents may use these headers internally.
-    const set unsafeNotForbidenHeaderNames = CorsUnsafeNotForbiddenRequestHeaderNames(request.Headers());
-    for (const auto name : unsafeNotForbidenHeaderNames) {
-      if (controlValues.AllowedHeaders.find(name) == controlValues.AllowedHeaders.cend())
-        throw hresult_error{
-            E_INVALIDARG,
-            L"Request header field [" + to_hstring(name) +
-                L"] is not allowed by Access-Control-Allow-Headers in preflight response"};
+
+  if (!IsPreflightMethodAllowed(request.Method().ToString(), entry->second.AllowedMethods, withCredentials))
+    return false;
+
+  return std::all_of(unsafeHeaderNames.cbegin(), unsafeHeaderNames.cend(), [&](const wstring &name) {
+    return IsPreflightHeaderAllowed(name, entry->second.AllowedHeaders, withCredentials);
+  });
+}
+
+void OriginPolicyHttpFilter::CachePreflight(
+    HttpRequestMessage const &request,
+    set<wstring> &&allowedMethods,
+    set<wstring> &&allowedHeaders,
+    std::chrono::seconds maxAge) const {
+  if (maxAge <= std::chrono::seconds::zero())
+    return;
+
+  auto key = GetPreflightCacheKey(request);
+  auto now = std::chrono::steady_clock::now();
+
+  std::scoped_lock lock{m_preflightCacheMutex};
+  if (m_preflightCache.size() >= s_maxPreflightCacheEntries && m_preflightCache.find(key) == m_preflightCache.cend()) {
+    // Drop expired entries first. If the cache is still full, drop the entry that expires soonest.
+    for (auto it = m_preflightCache.begin(); it != m_preflightCache.end();) {
+      it = it->second.Expiry <= now ? m_preflightCache.erase(it) : std::next(it);
+    }
+
+    if (m_preflightCache.size() >= s_maxPreflightCacheEntries) {
+      auto expiresFirst = [](const auto &a, const auto &b) { return a.second.Expiry < b.second.Expiry; };
+      m_preflightCache.erase(std::min_element(m_preflightCache.begin(), m_preflightCache.end(), expiresFirst));
     }
   }
 
-  // #9770 - insert into preflight cache
+  m_preflightCache.insert_or_assign(
+      std::move(key), PreflightCacheEntry{now + maxAge, std::move(allowedMethods), std::move(allowedHeaders)});
 }
 
 // See 10.7.4 of https://fetch.spec.whatwg.org/#http-network-or-cache-fetch
@@ -742,8 +828,7 @@ ResponseOperation OriginPolicyHttpFilter::SendRequestAsync(HttpRequestMessage co
   }
 
   try {
-    // #9770 - Validate preflight cache
-    if (originPolicy == OriginPolicy::CrossOriginResourceSharing) {
+    if (originPolicy == OriginPolicy::CrossOriginResourceSharing && !IsPreflightCached(coRequest)) {
       // If inner filter can AllowRedirect, disable for preflight.
       winrt::impl::com_ref<IHttpBaseProtocolFilter> baseFilter;
       if (baseFilter = m_innerFilter.try_as<IHttpBaseProtocolFilter>()) {
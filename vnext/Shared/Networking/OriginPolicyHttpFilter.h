@@ -14,6 +14,9 @@
 #include <winrt/Windows.Web.Http.h>
 
 // Standard Library
+#include <chrono>
+#include <map>
+#include <mutex>
 #include <set>
 
 namespace Microsoft::React::Networking {
@@ -45,11 +48,28 @@ class OriginPolicyHttpFilter
     std::set<std::wstring> AllowedHeaders;
     std::set<std::wstring> AllowedMethods;
     std::set<std::wstring> ExposedHeaders;
-    size_t MaxAge;
+    std::chrono::seconds MaxAge{s_defaultPreflightMaxAge};
   };
 
+  // https://fetch.spec.whatwg.org/#http-access-control-max-age
+  static constexpr std::chrono::seconds s_defaultPreflightMaxAge{5};
+  static constexpr std::chrono::seconds s_maxPreflightMaxAge{7200};
+  static constexpr size_t s_maxPreflightCacheEntries{100};
+
   winrt::Windows::Web::Http::Filters::IHttpFilter m_innerFilter;
 
+  // Methods and header names allowed by a successful preflight, stored in lower case.
+  struct PreflightCacheEntry {
+    std::chrono::steady_clock::time_point Expiry;
+    std::set<std::wstring> AllowedMethods;
+    std::set<std::wstring> AllowedHeaders;
+  };
+
+  // Successful preflight checks keyed by origin, URL and credentials mode.
+  // See https://fetch.spec.whatwg.org/#cors-preflight-cache
+  mutable std::mutex m_preflightCacheMutex;
+  mutable std::map<std::wstring, PreflightCacheEntry> m_preflightCache;
+
  public:
   static void SetStaticOrigin(std::string &&url);
 
@@ -64,16 +84,31 @@ class OriginPolicyHttpFilter
   static bool AreSafeRequestHeaders(
       winrt::Windows::Web::Http::Headers::HttpRequestHeaderCollection const &headers) noexcept;
 
-  static std::set<const wchar_t *> CorsUnsafeNotForbiddenRequestHeaderNames(
-      winrt::Windows::Web::Http::Headers::HttpRequestHeaderCollection const &headers) noexcept;
+  // Returns the lower-cased names of the request and content headers a preflight response must allow.
+  static std::set<std::wstring> CorsUnsafeNotForbiddenRequestHeaderNames(
+      winrt::Windows::Web::Http::HttpRequestMessage const &request) noexcept;
 
   static AccessControlValues ExtractAccessControlValues(
       winrt::Windows::Foundation::Collections::IMap<winrt::hstring, winrt::hstring> const &headers);
 
+  static std::wstring GetPreflightCacheKey(winrt::Windows::Web::Http::HttpRequestMessage const &request);
+
   static bool IsCorsSafelistedRequestHeader(winrt::hstring const &name, winrt::hstring const &value) noexcept;
 
   static bool IsCorsUnsafeRequestHeaderByte(wchar_t c) noexcept;
 
+  // Expects lower-cased allow-lists.
+  static bool IsPreflightMethodAllowed(
+      winrt::hstring const &method,
+      std::set<std::wstring> const &allowedMethods,
+      bool withCredentials) noexcept;
+
+  // Expects lower-cased names and allow-lists.
+  static bool IsPreflightHeaderAllowed(
+      std::wstring const &name,
+      std::set<std::wstring> const &allowedHeaders,
+      bool withCredentials) noexcept;
+
   // Filter out Http-Only cookies from response headers to prevent malicious code from being sent to a malicious server
   static void RemoveHttpOnlyCookiesFromResponseHeaders(
       winrt::Windows::Web::Http::HttpResponseMessage const &response,
@@ -89,6 +124,14 @@ class OriginPolicyHttpFilter
       winrt::Windows::Web::Http::HttpRequestMessage const &request,
       winrt::Windows::Web::Http::HttpResponseMessage const &response) const;
 
+  bool IsPreflightCached(winrt::Windows::Web::Http::HttpRequestMessage const &request) const;
+
+  void CachePreflight(
+      winrt::Windows::Web::Http::HttpRequestMessage const &request,
+      std::set<std::wstring> &&allowedMethods,
+      std::set<std::wstring> &&allowedHeaders,
+      std::chrono::seconds maxAge) const;
+
   void ValidateResponse(
       winrt::Windows::Web::Http::HttpResponseMessage const &response,
       const OriginPolicy effectivePolicy) const;
@@ -41,7 +41,7 @@ using winrt::Windows::Foundation::Uri;
 using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 using winrt::Windows::Storage::StorageFile;
 using winrt::Windows::Storage::Streams::DataReader;
-using winrt::Windows::Storage::Streams::UnicodeEncoding;
+using winrt::Windows::Storage::Streams::InputStreamOptions;
 using winrt::Windows::Web::Http::HttpBufferContent;
 using winrt::Windows::Web::Http::HttpMethod;
 using winrt::Windows::Web::Http::HttpRequestMessage;
@@ -53,6 +53,41 @@ using winrt::Windows::Web::Http::Headers::HttpMediaTypeHeaderValue;
 
 namespace Microsoft::React::Networking {
 
+namespace {
+
+// Size of each read from the response stream.
+// Incremental updates are sent after each read, so only one segment is buffered at a time.
+constexpr uint32_t c_responseSegmentSize = 1024 * 1024;
+
+// Returns the length of the data prefix that does not end with an incomplete UTF-8 sequence.
+size_t CompleteUtf8Length(const string &data) noexcept {
+  // A UTF-8 sequence has at most 4 bytes, so only the last 3 bytes may start an incomplete sequence.
+  for (size_t i = 1; i <= std::min<size_t>(3, data.size()); ++i) {
+    auto c = static_cast<uint8_t>(data[data.size() - i]);
+    if ((c & 0xC0) == 0x80)
+      continue; // Continuation byte
+
+    size_t sequenceLength = (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 1;
+    return sequenceLength > i ? data.size() - i : data.size();
+  }
+
+  return data.size();
+}
+
+// Encodes the bytes of data in whole 3-byte groups, so the encoded segments can be concatenated.
+// The remaining 0-2 bytes are kept in data for the next segment.
+void AppendBase64(vector<uint8_t> &data, string &result, bool isLastSegment) {
+  size_t length = isLastSegment ? data.size() : data.size() - data.size() % 3;
+  if (length == 0)
+    return;
+
+  auto buffer = CryptographicBuffer::CreateFromByteArray({data.data(), data.data() + length});
+  result += winrt::to_string(CryptographicBuffer::EncodeToBase64String(buffer));
+  data.erase(data.begin(), data.begin() + length);
+}
+
+} // namespace
+
 // May throw winrt::hresult_error
 void AttachMultipartHeaders(IHttpContent content, const dynamic &headers) {
   HttpMediaTypeHeaderValue contentType{nullptr};
@@ -336,6 +371,18 @@ void WinRTHttpResource::SetOnData(function<void(int64_t requestId, dynamic &&res
   m_onDataDynamic = std::move(handler);
 }
 
+void WinRTHttpResource::SetOnIncrementalData(
+    function<void(int64_t requestId, string &&responseData, int64_t progress, int64_t total)> &&handler) noexcept
+/*override*/ {
+  m_onIncrementalData = std::move(handler);
+}
+
+void WinRTHttpResource::SetOnDataProgress(
+    function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept
+/*override*/ {
+  m_onDataProgress = std::move(handler);
+}
+
 void WinRTHttpResource::SetOnError(
     function<void(int64_t requestId, string &&errorMessage, bool isTimeout)> &&handler) noexcept
 /*override*/ {
@@ -466,25 +513,30 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
       }
     }
 
-    // #9534 - Support HTTP incremental updates
     if (response && response.Content()) {
       auto inputStream = co_await response.Content().ReadAsInputStreamAsync();
       auto reader = DataReader{inputStream};
 
-      // #9510 - We currently accumulate all incoming request data in 10MB chunks
-      const uint32_t segmentSize = 10 * 1024 * 1024;
+      // Content-Length is unknown for chunked responses.
+      int64_t total = -1;
+      if (auto contentLength = response.Content().Headers().ContentLength()) {
+        total = static_cast<int64_t>(contentLength.Value());
+      }
+      int64_t progress = 0;
 
       // Let response handler take over, if set
       if (auto responseHandler = self->m_responseHandler.lock()) {
         if (responseHandler->Supports(reqArgs->ResponseType)) {
-          // #9510
           vector<uint8_t> responseData{};
-          while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
-            auto length = reader.UnconsumedBufferLength();
-            auto data = vector<uint8_t>(length);
-            reader.ReadBytes(data);
+          if (total > 0) {
+            responseData.reserve(static_cast<size_t>(total));
+          }
 
-            responseData.insert(responseData.cend(), data.cbegin(), data.cend());
+          while (co_await reader.LoadAsync(c_responseSegmentSize)) {
+            auto length = reader.UnconsumedBufferLength();
+            auto offset = responseData.size();
+            responseData.resize(offset + length);
+            reader.ReadBytes({responseData.data() + offset, responseData.data() + offset + length});
           }
 
           auto blob = responseHandler->ToResponseData(std::move(responseData));
@@ -499,31 +551,70 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
       }
 
       auto isText = reqArgs->ResponseType == "text";
-      if (isText) {
-        reader.UnicodeEncoding(UnicodeEncoding::Utf8);
+      auto isIncrementalText = isText && reqArgs->IncrementalUpdates && self->m_onIncrementalData;
+      if (reqArgs->IncrementalUpdates) {
+        // Complete each read with the data received so far instead of waiting for a full segment.
+        reader.InputStreamOptions(InputStreamOptions::Partial);
       }
 
-      // #9510
+      // Incremental text is passed on after each read, so only the full body of other responses is kept.
       string responseData;
-      winrt::Windows::Storage::Streams::IBuffer buffer;
-      while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
-        auto length = reader.UnconsumedBufferLength();
-
-        if (isText) {
-          auto data = vector<uint8_t>(length);
-          reader.ReadBytes(data);
+      if (!isIncrementalText && total > 0) {
+        responseData.reserve(static_cast<size_t>(isText ? total : (total + 2) / 3 * 4));
+      }
 
-          responseData += string(Common::Utilities::CheckedReinterpretCast<char *>(data.data()), data.size());
+      // Bytes that could not be passed on yet: an incomplete UTF-8 sequence or an incomplete base64 group.
+      string pendingText;
+      vector<uint8_t> pendingBytes;
+      while (co_await reader.LoadAsync(c_responseSegmentSize)) {
+        auto length = reader.UnconsumedBufferLength();
+        progress += length;
+
+        if (isIncrementalText) {
+          auto offset = pendingText.size();
+          pendingText.resize(offset + length);
+          auto data = reinterpret_cast<uint8_t *>(pendingText.data()) + offset;
+          reader.ReadBytes({data, data + length});
+
+          auto segment = std::move(pendingText);
+          auto completeLength = CompleteUtf8Length(segment);
+          pendingText = segment.substr(completeLength);
+          segment.resize(completeLength);
+          if (!segment.empty()) {
+            self->m_onIncrementalData(reqArgs->RequestId, std::move(segment), progress, total);
+          }
+        } else if (isText) {
+          auto offset = responseData.size();
+          responseData.resize(offset + length);
+          auto data = reinterpret_cast<uint8_t *>(responseData.data()) + offset;
+          reader.ReadBytes({data, data + length});
         } else {
-          buffer = reader.ReadBuffer(length);
-          auto data = CryptographicBuffer::EncodeToBase64String(buffer);
+          auto offset = pendingBytes.size();
+          pendingBytes.resize(offset + length);
+          reader.ReadBytes({pendingBytes.data() + offset, pendingBytes.data() + offset + length});
+          AppendBase64(pendingBytes, responseData, /*isLastSegment*/ false);
 
-          responseData += winrt::to_string(std::wstring_view(data));
+          if (reqArgs->IncrementalUpdates && self->m_onDataProgress) {
+            self->m_onDataProgress(reqArgs->RequestId, progress, total);
+          }
         }
       }
 
-      if (self->m_onData) {
-        self->m_onData(reqArgs->RequestId, std::move(responseData));
+      if (isIncrementalText) {
+        // Pass on a truncated UTF-8 sequence at the end of the response as is.
+        if (!pendingText.empty()) {
+          self->m_onIncrementalData(reqArgs->RequestId, std::move(pendingText), progress, total);
+        }
+
+        if (self->m_onRequestSuccess) {
+          self->m_onRequestSuccess(reqArgs->RequestId);
+        }
+      } else {
+        AppendBase64(pendingBytes, responseData, /*isLastSegment*/ true);
+
+        if (self->m_onData) {
+          self->m_onData(reqArgs->RequestId, std::move(responseData));
+        }
       }
     } else {
       if (self->m_onError) {
@@ -9,6 +9,7 @@
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSExecutor.h>
 #include <cxxreact/JsBundleType.h>
+#include <cxxreact/RAMBundleRegistry.h>
 #include <cxxreact/ReactMarker.h>
 #include <folly/Bits.h>
 #include <folly/json.h>
@@ -41,6 +42,8 @@
 #include <DevSettings.h>
 #include <DevSupportManager.h>
 #include <IReactRootView.h>
+#include <MemoryMappedBuffer.h>
+#include <MemoryMappedRAMBundle.h>
 #include <Shlwapi.h>
 #include <WebSocketJSExecutorFactory.h>
 #include <safeint.h>
@@ -235,6 +238,35 @@ bool shouldStartHermesInspector(DevSettings &devSettings) {
   else
     return false;
 }
+
+// Loads an indexed RAM bundle through a single bundle registry, so that only its startup code is evaluated and
+// modules are read from the bundle when they are first required. Other bundles are loaded as a whole.
+void loadBundleString(
+    Instance &instance,
+    std::unique_ptr<const JSBigString> bundleString,
+    std::string sourceUrl,
+    bool synchronously,
+    const std::function<void(std::string)> &errorCallback) {
+  if (!MemoryMappedRAMBundle::isIndexedRAMBundle(*bundleString)) {
+    instance.loadScriptFromString(std::move(bundleString), std::move(sourceUrl), synchronously);
+    return;
+  }
+
+  std::unique_ptr<MemoryMappedRAMBundle> ramBundle;
+  try {
+    ramBundle = std::make_unique<MemoryMappedRAMBundle>(std::move(bundleString));
+  } catch (const std::exception &e) {
+    errorCallback(e.what());
+    return;
+  }
+
+  auto startupScript = ramBundle->getStartupCode();
+  instance.loadRAMBundle(
+      RAMBundleRegistry::singleBundleRegistry(std::move(ramBundle)),
+      std::move(startupScript),
+      std::move(sourceUrl),
+      synchronously);
+}
 } // namespace
 
 InstanceImpl::InstanceImpl(
@@ -521,7 +553,7 @@ void InstanceImpl::loadBundleInternal(std::string &&jsBundleRelativePath, bool s
     } else {
 #if (defined(_MSC_VER) && !defined(WINRT))
       std::string bundlePath = (fs::u8path(m_devSettings->bundleRootPath) / jsBundleRelativePath).u8string();
-      auto bundleString = FileMappingBigString::fromPath(bundlePath);
+      auto bundleString = Microsoft::JSI::MakeMemoryMappedBigString(bundlePath);
 #else
       std::string bundlePath;
       if (m_devSettings->bundleRootPath._Starts_with("resource://")) {
@@ -531,10 +563,30 @@ void InstanceImpl::loadBundleInternal(std::string &&jsBundleRelativePath, bool s
       } else {
         bundlePath = (fs::u8path(m_devSettings->bundleRootPath) / (jsBundleRelativePath + ".bundle")).u8string();
       }
-
-      auto bundleString = std::make_unique<::Microsoft::ReactNative::StorageFileBigString>(bundlePath);
+      std::unique_ptr<const JSBigString> bundleString =
+          std::make_unique<::Microsoft::ReactNative::StorageFileBigString>(bundlePath);
 #endif
-      m_innerInstance->loadScriptFromString(std::move(bundleString), std::move(jsBundleRelativePath), synchronously);
+      if (synchronously) {
+        loadBundleString(
+            *m_innerInstance,
+            std::move(bundleString),
+            std::move(jsBundleRelativePath),
+            synchronously,
+            m_devSettings->errorCallback);
+      } else {
+        // Reading the bundle header waits for a StorageFileBigString to finish loading, so the bundle type is
+        // detected in the JS thread, where the bundle is read anyway.
+        auto bundleHolder = std::make_shared<std::unique_ptr<const JSBigString>>(std::move(bundleString));
+        m_jsThread->runOnQueue([weakInstance = std::weak_ptr<Instance>(m_innerInstance),
+                                bundleHolder,
+                                sourceUrl = std::move(jsBundleRelativePath),
+                                errorCallback = m_devSettings->errorCallback]() mutable {
+          if (auto instance = weakInstance.lock()) {
+            loadBundleString(
+                *instance, std::move(*bundleHolder), std::move(sourceUrl), /*synchronously:*/ true, errorCallback);
+          }
+        });
+      }
     }
   } catch (const std::exception &e) {
     m_devSettings->errorCallback(e.what());
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "ParallelYogaLayout.h"
+
+#include <cxxreact/SystraceSection.h>
+#include <dispatchQueue/dispatchQueue.h>
+
+#include <memory>
+
+using facebook::react::SystraceSection;
+
+namespace Microsoft::React {
+
+thread_local ParallelYogaLayout *ParallelYogaLayout::s_workerLayout{nullptr};
+
+ParallelYogaLayout::ParallelYogaLayout(std::vector<Root> &&roots) noexcept : m_roots{std::move(roots)} {}
+
+/*static*/ void ParallelYogaLayout::CalculateLayout(const Root &root) {
+  SystraceSection s("NativeUIManager::DoLayout::YGNodeCalculateLayout");
+  // We must always run layout in LTR mode, which might seem unintuitive.
+  // We will flip the root of the tree into RTL by forcing the root XAML node's FlowDirection to RightToLeft
+  // which will inherit down the XAML tree, allowing all native controls to pick it up.
+  YGNodeCalculateLayout(root.Node, root.Width, root.Height, YGDirectionLTR);
+}
+
+/*static*/ void ParallelYogaLayout::Calculate(std::vector<Root> &&roots) {
+  auto layout = std::make_shared<ParallelYogaLayout>(std::move(roots));
+  for (size_t i = 0; i < layout->m_roots.size(); ++i) {
+    Mso::DispatchQueue::ConcurrentQueue().Post([layout]() noexcept { layout->RunWorker(); });
+  }
+
+  layout->RunMeasureRequests();
+
+  if (layout->m_error) {
+    std::rethrow_exception(layout->m_error);
+  }
+}
+
+/*static*/ YGSize ParallelYogaLayout::Measure(
+    YGMeasureFunc measureFunc,
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  if (ParallelYogaLayout *layout = s_workerLayout) {
+    return layout->MeasureInCallingThread(measureFunc, node, width, widthMode, height, heightMode);
+  }
+
+  return measureFunc(node, width, widthMode, height, heightMode);
+}
+
+bool ParallelYogaLayout::TryCalculateNext() noexcept {
+  const size_t index = m_nextIndex++;
+  if (index >= m_roots.size()) {
+    return false;
+  }
+
+  std::exception_ptr error;
+  try {
+    CalculateLayout(m_roots[index]);
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  std::lock_guard lock{m_mutex};
+  if (error && !m_error) {
+    m_error = std::move(error);
+  }
+
+  ++m_completedCount;
+  m_changed.notify_all();
+  return true;
+}
+
+void ParallelYogaLayout::RunWorker() noexcept {
+  s_workerLayout = this;
+  while (TryCalculateNext()) {
+  }
+  s_workerLayout = nullptr;
+}
+
+void ParallelYogaLayout::RunMeasureRequests() noexcept {
+  std::unique_lock lock{m_mutex};
+  for (;;) {
+    m_changed.wait(lock, [this]() { return !m_measureRequests.empty() || m_completedCount == m_roots.size(); });
+    if (m_measureRequests.empty()) {
+      return;
+    }
+
+    MeasureRequest *request = m_measureRequests.front();
+    m_measureRequests.pop_front();
+    lock.unlock();
+
+    YGSize result{};
+    std::exception_ptr error;
+    try {
+      result =
+          request->MeasureFunc(request->Node, request->Width, request->WidthMode, request->Height, request->HeightMode);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    request->Result = result;
+    request->Error = std::move(error);
+    request->IsDone = true;
+    m_changed.notify_all();
+  }
+}
+
+YGSize ParallelYogaLayout::MeasureInCallingThread(
+    YGMeasureFunc measureFunc,
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  MeasureRequest request{measureFunc, node, width, widthMode, height, heightMode};
+  std::unique_lock lock{m_mutex};
+  m_measureRequests.push_back(&request);
+  m_changed.notify_all();
+  m_changed.wait(lock, [&request]() { return request.IsDone; });
+
+  // The exception unwinds the layout of this tree, and Calculate rethrows it in the calling thread.
+  if (request.Error) {
+    std::rethrow_exception(request.Error);
+  }
+
+  return request.Result;
+}
+
+} // namespace Microsoft::React
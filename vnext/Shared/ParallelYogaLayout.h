@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <yoga/yoga.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace Microsoft::React {
+
+// Calculates layout of independent Yoga trees in parallel.
+// Worker threads take the trees from a shared list. The measure functions use XAML elements, so they can only run in
+// the thread that calls Calculate. Worker threads forward them to that thread, which does nothing else until the
+// workers complete, so that a measure request never waits for the layout of another tree.
+class ParallelYogaLayout {
+ public:
+  struct Root {
+    YGNodeRef Node;
+    float Width;
+    float Height;
+  };
+
+  explicit ParallelYogaLayout(std::vector<Root> &&roots) noexcept;
+
+  // Calculates the layout of a single tree in the calling thread.
+  static void CalculateLayout(const Root &root);
+
+  // Calculates the layout of the trees and returns when all of them are calculated.
+  // Rethrows the first exception thrown by a measure function.
+  static void Calculate(std::vector<Root> &&roots);
+
+  // Calls measureFunc. In a worker thread the call is forwarded to the thread that called Calculate.
+  static YGSize Measure(
+      YGMeasureFunc measureFunc,
+      YGNodeRef node,
+      float width,
+      YGMeasureMode widthMode,
+      float height,
+      YGMeasureMode heightMode);
+
+ private:
+  struct MeasureRequest {
+    YGMeasureFunc MeasureFunc;
+    YGNodeRef Node;
+    float Width;
+    YGMeasureMode WidthMode;
+    float Height;
+    YGMeasureMode HeightMode;
+    YGSize Result{};
+    std::exception_ptr Error;
+    bool IsDone{false};
+  };
+
+  bool TryCalculateNext() noexcept;
+  void RunWorker() noexcept;
+  void RunMeasureRequests() noexcept;
+  YGSize MeasureInCallingThread(
+      YGMeasureFunc measureFunc,
+      YGNodeRef node,
+      float width,
+      YGMeasureMode widthMode,
+      float height,
+      YGMeasureMode heightMode);
+
+ private:
+  static thread_local ParallelYogaLayout *s_workerLayout;
+
+  const std::vector<Root> m_roots;
+  std::atomic<size_t> m_nextIndex{0};
+  std::mutex m_mutex;
+  std::condition_variable m_changed;
+  size_t m_completedCount{0};
+  std::exception_ptr m_error;
+  std::deque<MeasureRequest *> m_measureRequests;
+};
+
+} // namespace Microsoft::React
@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::React {
+
+// Min-heap of timers ordered by due time, with an index from timer id to heap
+// position so that timers can be looked up in O(1) and cancelled in O(log n).
+//
+// TTimer is any movable type; IdMember and DueTimeMember name the data members
+// holding its unique id and its due time. Timers due at the same time come out
+// in the order they were pushed.
+//
+// Example:
+//           struct Timer { int64_t Id; TimePoint DueTime; };
+//           IndexedTimerHeap<Timer, &Timer::Id, &Timer::DueTime> timers;
+//           timers.Push(Timer{1, now + 100ms});
+//           timers.Push(Timer{2, now + 20ms});
+//           timers.Remove(1);
+//           timers.Pop(); // returns timer 2
+template <typename TTimer, auto IdMember, auto DueTimeMember>
+class IndexedTimerHeap {
+ public:
+  using Id = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<TTimer &>().*IdMember)>>;
+
+  // Adds a timer. A timer already queued with the same id is replaced.
+  void Push(TTimer timer) {
+    const Id id = timer.*IdMember;
+    auto found = m_index.find(id);
+    if (found != m_index.end()) {
+      const size_t position = found->second;
+      m_heap[position] = Node{std::move(timer), m_nextSequence++};
+      Restore(position);
+      return;
+    }
+
+    m_index.emplace(id, m_heap.size());
+    m_heap.push_back(Node{std::move(timer), m_nextSequence++});
+    SiftUp(m_heap.size() - 1);
+  }
+
+  // Removes and returns the timer with the earliest due time.
+  TTimer Pop() {
+    assert(!m_heap.empty());
+    TTimer timer = std::move(m_heap.front().Timer);
+    m_index.erase(timer.*IdMember);
+    RemoveAt(0);
+    return timer;
+  }
+
+  const TTimer &Front() const {
+    assert(!m_heap.empty());
+    return m_heap.front().Timer;
+  }
+
+  // Returns false if no timer with that id is queued.
+  bool Remove(const Id &id) {
+    auto found = m_index.find(id);
+    if (found == m_index.end())
+      return false;
+
+    const size_t position = found->second;
+    m_index.erase(found);
+    RemoveAt(position);
+    return true;
+  }
+
+  // Returns nullptr if no timer with that id is queued.
+  const TTimer *Find(const Id &id) const {
+    auto found = m_index.find(id);
+    return found != m_index.end() ? &m_heap[found->second].Timer : nullptr;
+  }
+
+  bool IsEmpty() const noexcept {
+    return m_heap.empty();
+  }
+
+  size_t Size() const noexcept {
+    return m_heap.size();
+  }
+
+  void Clear() noexcept {
+    m_heap.clear();
+    m_index.clear();
+  }
+
+ private:
+  struct Node {
+    TTimer Timer;
+    uint64_t Sequence;
+  };
+
+  static bool Less(const Node &left, const Node &right) {
+    const auto &leftDueTime = left.Timer.*DueTimeMember;
+    const auto &rightDueTime = right.Timer.*DueTimeMember;
+    if (leftDueTime < rightDueTime)
+      return true;
+    if (rightDueTime < leftDueTime)
+      return false;
+    return left.Sequence < right.Sequence;
+  }
+
+  // Moves the last node into the hole and restores the heap around it.
+  void RemoveAt(size_t position) {
+    const size_t last = m_heap.size() - 1;
+    if (position != last) {
+      m_heap[position] = std::move(m_heap[last]);
+      m_index[m_heap[position].Timer.*IdMember] = position;
+    }
+    m_heap.pop_back();
+
+    if (position < m_heap.size())
+      Restore(position);
+  }
+
+  void Restore(size_t position) {
+    if (position > 0 && Less(m_heap[position], m_heap[(position - 1) / 2]))
+      SiftUp(position);
+    else
+      SiftDown(position);
+  }
+
+  void SiftUp(size_t position) {
+    Node node = std::move(m_heap[position]);
+    while (position > 0) {
+      const size_t parent = (position - 1) / 2;
+      if (!Less(node, m_heap[parent]))
+        break;
+
+      Place(position, std::move(m_heap[parent]));
+      position = parent;
+    }
+    Place(position, std::move(node));
+  }
+
+  void SiftDown(size_t position) {
+    Node node = std::move(m_heap[position]);
+    const size_t size = m_heap.size();
+    for (;;) {
+      size_t child = position * 2 + 1;
+      if (child >= size)
+        break;
+
+      if (child + 1 < size && Less(m_heap[child + 1], m_heap[child]))
+        child++;
+      if (!Less(m_heap[child], node))
+        break;
+
+      Place(position, std::move(m_heap[child]));
+      position = child;
+    }
+    Place(position, std::move(node));
+  }
+
+  void Place(size_t position, Node &&node) {
+    m_index[node.Timer.*IdMember] = position;
+    m_heap[position] = std::move(node);
+  }
+
+  std::vector<Node> m_heap;
+  std::unordered_map<Id, size_t> m_index;
+  uint64_t m_nextSequence{0};
+};
+
+} // namespace Microsoft::React
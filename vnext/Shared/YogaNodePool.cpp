@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "YogaNodePool.h"
+
+namespace Microsoft::React {
+
+YogaNodePtr YogaNodePool::MakeNode(YGConfigRef config) {
+  if (!m_freeNodes.empty()) {
+    YogaNodePtr result = std::move(m_freeNodes.back());
+    m_freeNodes.pop_back();
+    return result;
+  }
+
+  return YogaNodePtr(YGNodeNewWithConfig(config));
+}
+
+void YogaNodePool::RecycleNode(YogaNodePtr &&node) {
+  if (m_freeNodes.size() >= MaxFreeNodes) {
+    return; // YogaNodePtr frees the node.
+  }
+
+  // YGNodeReset requires the node to be detached from its owner and children, the same way as YGNodeFree does it.
+  YGNodeRef yogaNode = node.get();
+  if (YGNodeRef owner = YGNodeGetOwner(yogaNode)) {
+    YGNodeRemoveChild(owner, yogaNode);
+  }
+
+  YGNodeRemoveAllChildren(yogaNode);
+  YGNodeReset(yogaNode);
+  m_freeNodes.push_back(std::move(node));
+}
+
+size_t YogaNodePool::FreeNodeCount() const noexcept {
+  return m_freeNodes.size();
+}
+
+} // namespace Microsoft::React
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <yoga/yoga.h>
+
+#include <memory>
+#include <vector>
+
+namespace Microsoft::React {
+
+struct YogaNodeDeleter {
+  void operator()(YGNodeRef node) {
+    YGNodeFree(node);
+  }
+};
+
+typedef std::unique_ptr<YGNode, YogaNodeDeleter> YogaNodePtr;
+
+// Keeps the Yoga nodes of removed views so that they are reused for new views.
+// It saves the allocations when lists mount and unmount many items.
+// A recycled node is detached from its owner and children, and reset to the state of a new node.
+class YogaNodePool {
+ public:
+  static constexpr size_t MaxFreeNodes = 1024;
+
+  // Returns a free node, or a new node with the config if there is none.
+  YogaNodePtr MakeNode(YGConfigRef config);
+
+  // Keeps the node for reuse, unless MaxFreeNodes nodes are already kept. Otherwise the node is freed.
+  void RecycleNode(YogaNodePtr &&node);
+
+  size_t FreeNodeCount() const noexcept;
+
+ private:
+  std::vector<YogaNodePtr> m_freeNodes;
+};
+
+} // namespace Microsoft::React